@@ -0,0 +1,11 @@
+/* effects_mem.cmd - GERADO por Host/tools/mem_plan: não editar.
+ * Catálogo em inc/mem_plan.h; regravar com
+ *   cmake --build build --target mem_plan_update
+ * DARAM: 16384 de 16384 palavras reservadas aos efeitos. */
+
+SECTIONS
+{
+   .efx:arena_fast    > DARAM  /*  16384 palavras */
+   .efx:arena         > CE0   align(0x10000)  /* 196608 palavras */
+   .efx:ir            > CE0   align(0x10000)  /*  16384 palavras */
+}
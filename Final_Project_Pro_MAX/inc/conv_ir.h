@@ -0,0 +1,1390 @@
+/* conv_ir.h - GERADO por Host/tools/conv_ir: não editar.
+ * Fonte: IR sintética (sala pequena, T60 de 0.3 s); regravar com
+ *   cmake --build build --target conv_ir_update
+ * Espectros no formato de conv_reverb.h: valor * 2^CONV_IR_EXP. */
+
+#ifndef CONV_IR_H_
+#define CONV_IR_H_
+
+#define CONV_IR_PARTITIONS  32
+#define CONV_IR_FRAMES      8192      // 170.7 ms
+#define CONV_IR_EXP         (-14)
+#define CONV_IR_GUARD       6       // Bits de guarda da soma das partições
+
+#endif /* CONV_IR_H_ */
+
+// Tabela: só em conv_reverb.c (#define CONV_IR_TABLE antes do #include)
+#if defined(CONV_IR_TABLE) && !defined(CONV_IR_TABLE_H_)
+#define CONV_IR_TABLE_H_
+
+#pragma DATA_SECTION(s_convIr, ".efx:ir")
+static const Int16 s_convIr[CONV_IR_PARTITIONS * CONV_IR_PART_WORDS] = {
+     17531,  17531,  20445,  -6534,   4588,   2962,  26724,   5521,  14500,  -6284,  15596,  -1616,
+     10037,   6007,  28841,    -29,   8126,  -7476,  16452,   5356,  16141,   2972,  24853,  -4691,
+      4147,  -3007,  22167,   8672,  17570,  -3929,  18196,  -3838,   6220,   2671,  27529,   5862,
+     13198,  -9037,  14633,   2241,  12669,   4046,  27594,   -116,   7100,  -8267,  17130,   8595,
+     17973,   -553,  22082,  -3505,   4930,  -2741,  23223,  10007,  17673,  -7461,  15627,   -876,
+      8891,   2218,  27212,   5626,  12329, -10936,  13663,   5825,  15777,   1820,  25228,   -279,
+      7025,  -8256,  17594,  11000,  19816,  -3931,  18676,  -2118,   6841,  -2135,  23551,  10372,
+     17801, -10238,  12990,   2047,  12338,   1692,  25835,   4784,  11935, -11769,  12806,   8780,
+     19055,   -432,  21985,   -552,   7867,  -7397,  17845,  12318,  21468,  -6830,  14971,   -694,
+      9671,  -1197,  23168,   9694,  17899, -11982,  10558,   4640,  16217,   1176,  23565,   3373,
+     11999, -11428,  12185,  10818,  22171,  -2484,  18197,   -942,   9503,  -5734,  17915,  12408,
+     22734,  -8971,  11341,    620,  13123,     15,  22161,   8010,  17900, -12520,   8597,   6660,
+     20136,    733,  20655,   1496,  12458,  -9928,  11912,  11747,  24798,  -4145,  14248,  -1428,
+     11731,  -3402,  17858,  11252,  23444, -10164,   8158,   1705,  16838,   1401,  20679,   5460,
+     17745, -11806,   7337,   7932,  23698,    401,  17415,   -682,  13212,  -7401,  12072,  11495,
+     26648,  -5280,  10538,  -1958,  14300,   -610,  17737,   8963,  23479, -10318,   5755,   2481,
+     20439,   2826,  18906,   2282,  17389,  -9920,   6943,   8367,  26538,    185,  14182,  -2951,
+     14142,  -4090,  12705,  10109,  27509,  -5819,   7440,  -2459,  16937,   2371,  17615,   5769,
+     22784,  -9452,   4389,   2916,  23565,   4133,  17044,  -1214,  16816,  -7060,   7496,   7966,
+     28368,     66,  11277,  -5074,  15122,   -322,  13799,   7750,  27266,  -5759,   5262,  -2843,
+     19375,   5239,  17541,   1990,  21382,  -7690,   4214,   3020,  25914,   5160,  15286,  -4677,
+     16043,  -3525,   8979,   6816,  29000,      0,   8979,  -6816,  16043,   3525,  15286,   4677,
+     25914,  -5160,   4214,  -3020,  21382,   7690,  17541,  -1990,  19375,  -5239,   5262,   2843,
+     27266,   5759,  13799,  -7750,  15122,    322,  11277,   5074,  28368,    -66,   7496,  -7966,
+     16816,   7060,  17044,   1214,  23565,  -4133,   4389,  -2916,  22784,   9452,  17615,  -5769,
+     16937,  -2371,   7440,   2459,  27509,   5819,  12705, -10109,  14142,   4090,  14182,   2951,
+     26538,   -185,   6943,  -8367,  17389,   9920,  18906,  -2282,  20439,  -2826,   5755,  -2481,
+     23479,  10318,  17737,  -8963,  14300,    610,  10538,   1958,  26648,   5280,  12072, -11495,
+     13212,   7401,  17415,    682,  23698,   -401,   7337,  -7932,  17745,  11806,  20679,  -5460,
+     16838,  -1401,   8158,  -1705,  23444,  10164,  17858, -11252,  11731,   3402,  14248,   1428,
+     24798,   4145,  11912, -11747,  12458,   9928,  20655,  -1496,  20136,   -733,   8597,  -6660,
+     17900,  12520,  22161,  -8010,  13123,    -15,  11341,   -620,  22734,   8971,  17915, -12408,
+      9503,   5734,  18197,    942,  22171,   2484,  12185, -10818,  11999,  11428,  23565,  -3373,
+     16217,  -1176,  10558,  -4640,  17899,  11982,  23168,  -9694,   9671,   1197,  14971,    694,
+     21468,   6830,  17845, -12318,   7867,   7397,  21985,    552,  19055,    432,  12806,  -8780,
+     11935,  11769,  25835,  -4784,  12338,  -1692,  12990,  -2047,  17801,  10238,  23551, -10372,
+      6841,   2135,  18676,   2118,  19816,   3931,  17594, -11000,   7025,   8256,  25228,    279,
+     15777,  -1820,  13663,  -5825,  12329,  10936,  27212,  -5626,   8891,  -2218,  15627,    876,
+     17673,   7461,  23223, -10007,   4930,   2741,  22082,   3505,  17973,    553,  17130,  -8595,
+      7100,   8267,  27594,    116,  12669,  -4046,  14633,  -2241,  13198,   9037,  27529,  -5862,
+      6220,  -2671,  18196,   3838,  17570,   3929,  22167,  -8672,   4147,   3007,  24853,   4691,
+     16141,  -2972,  16452,  -5356,   8126,   7476,  28841,     29,  10037,  -6007,  15596,   1616,
+     14500,   6284,  26724,  -5521,   4588,  -2962,  20445,   6534,   7905,  -3651,  -5365,  -4044,
+      2416,   3704,  -2394,  -3652,    263,   5537,   3866,  -3372,  -2781,  -1325,   -851,    290,
+     -2054,   2528,   5956,   2916,    649,  -9490,  -9541,   3832,   5609,   5471,   2642,  -2108,
+      1742,  -5469, -10133,   -116,   4662,  10032,   5948,  -5917,  -3199,  -4011,  -5348,   1779,
+      2892,   5457,   3313,  -2432,    433,  -3021,  -5454,  -1372,    810,   6033,   2999,  -1438,
+      1947,   -813,  -2514,  -5512,  -6104,   5189,   6221,   5863,   6452,  -7638, -10353,  -5089,
+      -795,  10295,   5362,  -1245,   2937,   -991,  -3056,  -8878,  -9559,   9119,  12348,   5002,
+       517, -10904,  -7896,   1523,   2404,   4801,    943,  -1968,   1122,   2197,   2044,  -5067,
+     -6331,    216,    761,   5129,   5058,   1025,   1959,  -7337,  -9282,   -295,   1999,   8631,
+      6304,  -2330,   -309,  -4794,  -5815,  -2238,  -2517,   8752,  10160,   -483,  -3229,  -7135,
+     -2629,    825,  -5103,   3386,   9826,   6430,    184, -13232,  -7956,   5311,   2050,    993,
+      2046,   4965,   5132,  -8419,  -9363,   1171,   3718,   3146,  -1087,    925,   5035,  -1173,
+     -3576,  -3738,  -2471,   1367,   -320,   5889,   8829,  -3542,  -7968,  -5312,    469,   5754,
+      -387,   -282,   5132,   1708,  -3273,  -7170,  -2061,   6876,   3297,  -4365,  -5098,   4361,
+      9247,    190,  -5025,  -8983,  -6779,   7047,   7396,   6081,   6134,  -9136, -11727,  -3775,
+       930,  11347,   6914,  -3528,  -1418,  -2859,  -3037,  -1697,  -1324,   4720,   3229,   -555,
+       856,   -111,   -405,  -4337,  -4562,   3273,   3153,   1983,   2437,   -217,   -823,  -6044,
+     -5660,   5719,   7063,   -719,  -5177,  -1086,   5148,   2225,  -2612,  -5118,  -2772,   2706,
+       967,   4235,   6982,  -2978,  -6255,  -5630,  -2598,   5259,   2148,   3742,   7369,  -3119,
+     -7156,  -6956,  -2531,   7521,   2896,    670,   4182,   1041,    384,  -9194, -11736,   3432,
+      7767,  10915,   6869, -10373,  -8496,  -1679,   -443,   2591,  -1090,   5173,   9772,  -1988,
+     -6889,  -7713,  -2206,   5890,    308,   1303,   5386,   2300,    428,  -8024,  -7413,    825,
+        96,   7656,   9396,  -1160,  -4192,  -8648,  -5250,   4942,   3093,   3391,   3230,  -2511,
+     -2725,  -1012,   2025,   -538,  -5695,   -531,   4270,   6240,   2548,  -5102,  -1435,  -2170,
+     -6331,    828,   5011,   7480,   3422,  -6371,  -2205,  -1847,  -6001,    248,   4285,   8136,
+      3930,  -6561,  -2192,  -1180,  -5422,   -918,   3641,   8610,   3125,  -7824,  -2544,   3428,
+       577,  -5638,  -5344,   6550,   6185,    356,   2767,  -1128,  -4242, -10719, -10200,  15316,
+     19604,  -1364,  -9896, -11049,  -1343,   6295,  -1202,   1149,   5602,   2055,  -1316,  -5349,
+     -1376,    954,  -3017,    508,   3359,   4697,   2739,  -5021,  -3593,   -825,  -1008,   1372,
+        73,   2303,   3723,    287,   -204,  -4648,  -4280,    643,   -613,   3636,   5277,   2572,
+      1582,  -8522,  -8565,   2517,   4038,   3730,   -132,    757,   6888,  -2883,  -9677,  -6781,
+     -1070,  11995,   8052,  -2391,     56,  -4548,  -6370,  -3142,  -1167,   9668,   8134,  -3475,
+     -4111,  -2517,    615,   -312,  -3899,   1476,   3999,   2598,   -107,  -2006,   2439,  -1246,
+     -6084,  -3815,  -1370,   9406,   9708,   -848,  -1346, -10184, -11894,   3116,   7054,  11338,
+      7042,  -8944,  -6112,  -3492,  -4672,   2582,   3299,   7583,   6826,  -6516,  -6831,  -2882,
+      -767,   3567,   1001,   2093,   3559,  -1331,  -2289,  -2768,  -1016,   1600,   -327,    192,
+       644,   2299,   3510,  -2227,  -4233,  -2855,   -241,   4471,   1514,  -1667,    -56,   2394,
+      3604,  -4023,  -7044,  -1732,    700,   7641,   6986,  -2247,  -3059,  -5778,  -4190,   2749,
+      1242,   3526,   4310,   -431,  -1263,  -4183,  -1657,    832,  -3285,    142,   3398,   7632,
+      7141,  -8672, -10149,  -3303,  -1926,   8066,   7800,   3564,   3192, -10243, -10405,    356,
+      2028,   6576,   3571,    687,   3704,  -4604,  -6657,  -3594,  -2377,   6743,   6384,   2061,
+       821,  -6458,  -3993,   1501,    302,  -1426,  -3825,   6308,  12072,  -1025,  -8063, -10444,
+     -4146,   9384,   5084,   1042,   3110,  -1851,  -2820,  -5331,  -4185,   4570,   3627,   1775,
+      1331,  -1012,    417,  -2749, -21159,   -642,  -3779,   9924,  -9257,   5397,   3386,  12881,
+        68,   -354,  -1500,   8638,   1679,   6354,   7308,   8409,   5012,  -1047,   4450,   8903,
+     16907,  -1177,   5749, -12546,  -5268,  -5213,   2515,   4446,   8046,  -5747,    890,  -9413,
+     -7246,  -8390,  -6508,   4933,   4989,  -2451,  -8110,  -7235,  -9085,   5689,   -162,   6535,
+     -1011,   3137,   2154,   6920,   4339,   -194,    610,   2628,   2714,   -821,  -1152,   5493,
+      9820,     42,  -4197,  -2905,   5284,   9178,   9463,  -2175,   7749,  -3349,   3905,  -9688,
+      -920,  -5934,  -2322,  -6322,  -4215,  -2565,  -5644,   -756,   -745,   6899,   6618,  -1305,
+       925,  -4370,   -568,  -5148,  -4347,  -3085,  -4522,  -1051,  -3216,   2162,  -3106,  -1143,
+     -5846,   6252,   2303,   4437,   -736,   6019,   9655,   2488,   -904,  -5346,   -888,   4031,
+      2682,   3383,   8147,    672,   1421,  -6793,  -1539,    854,   3554,   1540,   7279,  -5653,
+     -7165,  -9459,  -4180,   6282,   1999,  -1016,    583,   1681,   -145,  -4988,  -4400,   5244,
+      6475,  -2081,  -8938,  -2624,    -64,  11305,   8593,   1669,   1680,  -4194,  -2736,   4134,
+     10057,   4445,   3346,  -8439,  -1238,   3814,   9291,  -3221,  -1927,  -3518,   8612,   -982,
+     -2231, -11837,  -2459,   3061,   5062,  -6107,  -4188,  -6999,  -6471,   -414,   2511,   2654,
+     -2191,  -8302,  -6525,   3664,    466,   -913,  -3444,   1579,  -3712,  -1078,  -5021,  11654,
+     10654,   4351,   2625,   -227,   5469,  -2514,  -2424,   1471,   9365,   1228,   -868,  -5113,
+      4391,   4660,   8577,  -3832,   4589,  -6478,   2948,  -4889,   5328,  -8835,  -1044, -10437,
+     -2715, -12592, -14738,  -5246,  -1494,   3415,  -5718,  -6813,  -6215,   3715,    107,  -2731,
+     -9073,  -4695, -11438,   8025,   3408,  10014,   3058,   1528,   6128,   -581,  -3792,  -8111,
+     -5479,   5564,   3378,   1003,  -1441,  -1658,  -2615,   3070,   7064,   3317,   1924, -11429,
+    -11158,   -184,    671,   6442,   2825,  -1235,  -1087,  -3019,  -3590,   -772,  -2724,    989,
+     -2969,   2010,   -751,   3937,   1402,   2513,   3000,    430,  -1427,  -4761,  -7803,   4018,
+      2605,   8488,   5065,   1004,   -618,   -832,    134,   8745,  13464,   1825,   2798,  -6563,
+      4978,    -61,   5309,  -7033,   2172,  -9762, -10320, -10333,  -9114,   6804,   1830,   3819,
+      2261,   1267,    852,  -3281,  -1452,   2040,   4598,  -3649,  -8217,  -4529,  -2253,   9676,
+      7602,    451,    673,  -3266,   -474,  -1359,   -411,   2226,   5399,  -1807,  -4128,  -4543,
+     -1306,   7181,  10767,   2163,   6069, -10617,  -3389,  -4745,   2003,  -5644,  -6823,  -3286,
+      4704,   -453,  -5757,  -9653,  -1624,   2578,  -2153,  -9890,  -9561,   -521,  -6961,   -600,
+     -5152,   6413,  -2290,  -1527,  -8993,   8932,   6660,   7352,   -843,   -212,   2392,   6897,
+      6263,    252,   4077,   -728,   4365,  -5645,  -4260,  -4382,   -309,   1257,   -740,  -1936,
+        79,     68,  -1934,  -1341,   2068,   3408,   5331,  -5604,  -3681,  -8565,  -9453,   -211,
+      1347,   4499,  -1701,  -7600, -10782,   1335,  -3385,   7772,   3202,   1790,  -7380,  -1671,
+     -2908,  10870,    763,   4108,   2567,  11005,   9103,   2377,   6606,   1992,   5215,  -4170,
+      3280,   2759,   8028,  -5841,    552,  -2563,   4778,  -6509,  -3428,  -4814,  -1680,  -2122,
+       991,   2223,   3246,  -9453, -10273,    873,   6454,   1571,  -5027,  -6833,  -4034,   2726,
+     -2178,   3765,   4051,   2254,  -1503,    260,   5817,   4798,   6067,  -5299,   -932,  -4968,
+     -1792,   1232,   5565,   -481,    338,  -5073,    517,   -848,   2565,  -1000,   6181,  -5810,
+     -3030,  -9949,  -3997,  -2106,  -1348,  -1742,   2854,  -3763,  -4279, -11325, -10978,      6,
+       314,   2240,  -3964,  -7249, -10995,   3073,    181,   6072,     94,    186,  -2317,   -870,
+     -4887,   7755,  14326,   4785,    384, -15661,  -8794,   3387,   3605,   1806,   3746,   -679,
+      2256, -10074,  -9408,   -139,   7586,   2278,   -265, -12214,  -6149,  -3553,  -2814,  -3417,
+     -2884,  -6318, -12154,  -6049,  -7460,   6091,  -2822,  -3565, -12376,   1923,  -5732,   7436,
+     -3186,   7417,    525,   6606,   3530,   5016,   2329,  -1735,  -1886,   3817,   5050,    601,
+     -2440,   9204,   6177,   2434,    996,  -6742,  -1395,   2505,   4856,  -4888,  -6938,  -4036,
+     -3313,   3782,  -1828,   5596,   7587,   6458,   7691,  -4950,    115,  -5013,   -919,  -2294,
+     -1450,   -734,    642,   1305,   1942,  -1900,  -2242,   -336,   2482,   5266,  10951,  -1618,
+      3522, -11227,  -1051,  -7124,  -4951, -10550, -10497,    -34,  -2319,    373,  -6213,   1025,
+        36,   4335,   2904,  -2392,  -6362,  -7027,  -9115,   7297,   3489,   3612,  -1939,    516,
+     -1328,   -640,  -6623,   8154,  11926,   7023,   2748,  -7385,   1206,   -189,    545,  -5964,
+     -4711,  -2734,  -3963,   1085,  -1475,    287,  -4766,   1857,    -64,   5185,   2630,   2781,
+      3175,  -2110,  -1758,   -622,   1303,  -2592,  -6419,   -182,   1752,   2053,  -6897,  -2852,
+     -5807,   9004,   2643,  11137,  12472,   1950,   -670,  -5570,   2675,   4386,   4072,  -2976,
+      2239,  -3505,  -6114,  -3318,    573,   7788,   4846,  -1227,   3152,  -1203,  -1371,  -4133,
+      2735,   2706,    890, -10307, -10638,   1856,    436,   5149,   -170,   4250,   5786,   2646,
+      2171,   -655,   7333,   1105,   4771, -10847,  -6327,  -5199,  -2927,  -1705,  -4589,   1558,
+       400,    -59,  -4617,   4514,  10844,   2615,   -226, -10200,   -896,  -5360, -14754,  -8036,
+     -9155,  12863,  -2748,   4885,    282,  14824,   9283,   3439,   4240,   5472,  11441,   1823,
+     11375,  -5052,   2714, -13212,  -3950,  -4567,  -3153,  -5070,  -4046,   1510,   -899,  -1483,
+     -1943,   2288,   -975,   -461,   1722,   6243,   6016,  -6436,  -6191,    133,   3638,   1647,
+      -751,   -304,   2858,    802,   2823,    699,   6001,  -5248,  -3294,  -4252,   3548,   -556,
+        95,  -8546,  -6852,  -3705,  -3349,   2826,    554,   -548,  -1313,    852,   2672,  -1267,
+     -1061,  -3476,  -2608,  -1723,      4,   2169,   3308,  -6748, -10061,  -4186,  -3647,   6186,
+      1341,   3381,   4094,   -294,     38,  -3053,   1328,  -1834,  -1329,  -5303,  -4235,  -2554,
+     -3763,   -441,  -2834,   -839,  -5039,    556,  -2970,   3178,   -607,   4290,   3949,    -10,
+     -2658,  -3485,  -2093,    785,  -4857,  -1114,  -3997,   7143,   3546,   3702,   1026,    590,
+       242,    583,    265,   2783,   3252,   -967,  -4327,    355,   4341,   7004,   4735,  -5086,
+     -3832,   1178,   4652,   4061,   4864,  -2563,   1330,  -1348,   6488,  -1894,    483, -10532,
+     -5000,  -1360,   1010,  -4266,  -7477,  -3909,  -4711,   4454,   2548,   3743,   2244,  -3392,
+     -1539,   -624,    651,  -3561,  -4639,  -1356,  -3099,  -1224,  -6535,   7324,  11339,   4401,
+     -1577, -10427,  -4870,   3895,   1993,    332,   -252,   -570,  -1032,     42,   1503,    531,
+     -2388,  -2279,  -1239,   5742,   6819,   2080,   5678,  -4162,   1839,  -5379,   2814,  -8182,
+    -10479, -10952,  -8974,   6824,   -229,   -246,  -5366,   5932,   6444,   3055,   -664,   -801,
+      7229,   3428,   8490, -10117,  -3612, -13392, -10015,  -6976, -11689,   -515,  -5506,   7621,
+      1350,   -875,  -8167,    966,    737,   6176,    569,  -1914,  -3517,  -2017,  -8144,   1268,
+     -5352,   8366,   1829,  11178,  10736,   1910,  -1257,  -4316,   1966,   4606,   2246,  -2901,
+      -577,   2880,   5259,   1417,   6480,  -4271,  -2364,  -9361,  -6176,    570,  -1192,   1930,
+      2050,   2244,   1678,  -3173,    332,    618,   3816,  -5186,  -3760,  -5823,  -4257,  -2728,
+     -5389,   -330,  -3833,   1275,  -3680,   3589,   1938,   5388,   5705,  -1915,  -2025,  -4895,
+       227,   -564,  -3912,  -8275, -12412,   3625,    106,  10296,   6807,   1866,    474,  -4591,
+      -681,   1370,   1709,  -4674,  -5365,  -1743,  -1643,    -62,  -4107,   -523,  -4074,   1627,
+     -2727,   4873,   1526,   3640,   3432,   1914,   2194,  -5038,  -4640,  -1658,  -3223,  -1162,
+     -7274,   4160,    -95,   7118,   2692,   7586,  10593,   -227,   -292,  -5477,   2229,   -432,
+     -1397,  -4565,   -495,   -205,  -2842,  -4083,  -4572,   2725,    653,   2774,   2772,   -596,
+     -2966,  -4329,  -3578,   4781,   5051,   -161,  -2094,  -5035,  -4565,  -1454,  -6934,   2759,
+      1041,   7611,   2615,  -1233,  -2055,   2006,   1668,   1427,    610,   1156,   1622,  -2057,
+     -4428,    406,   1274,   3732,  -1104,    177,   1171,   6773,   -144,   1607,  -8889,   2174,
+      2967,   6592,  -4291,   1999,   5258,  10735,   6084,   -134,   5588,   1715,   2292,  -2181,
+      4854,   2179,   2113,  -4346,   1462,   2775,   3175,  -2291,   1641,   3036,   6166,  -1774,
+      1963,  -1000,   4177,  -1531,   3692,  -1781,   2694,  -5740,  -2164,  -1714,    483,  -1067,
+     -1076,   3457,   9129,   1231,   2241,  -7206,     -5,   -687,   2528,  -2518,   -260,  -1980,
+      2592,   1988,   7585,  -5001,  -2383,  -6502,   3376,  -1368,  -2780,  -9800,  -4984,   2308,
+       303,  -2250,  -1457,   3531,   6380,  -2931,   -819,  -4723,   -572,  -5406,  -4706,   -910,
+       677,  -3645,  -7688,  -1768,  -2072,   1009,  -7310,   3803,   5223,   6173,  -1593,  -3021,
+        60,   4219,  -1700,   1243,   4385,   7223,   4905,  -1919,   5147,    935,   2009,  -7595,
+     -3375,   1272,   1784,   1509,   6385,   1987,   3739,  -9108,  -1935,   -413,   2592,  -7338,
+     -5376,  -1037,    557,  -6826, -14207,   2850,   6830,   7529,  -5034,  -4012,   3156,   8927,
+      1027,  -5678,  -2483,   7721,   6394,   1317,   4515,   2968,   8873,  -4931,    267,  -5188,
+      2025,  -2629,   3603,  -4029,  -1112,  -9812,  -5388,    156,   3305,  -4731,  -6942,  -5290,
+     -2208,    131,  -3287,  -2505,  -2967,  -2114,  -6568,  -1726,  -7130,   1931,  -5138,   8830,
+      6791,   4591,  -1485,  -4930,  -6365,   4376,   3343,   8961,   7483,  -4152,  -6929,  -1171,
+      3951,   6469,   3116,  -3078,    227,  -2673,  -5322,    689,   5335,   4882,    516,  -6639,
+     -1396,   1142,  -1761,  -5099,  -6114,   2365,  -2075,   1349,  -3800,   3741,  -2592,   4322,
+      -153,   9167,   6846,   5469,   6927,    349,   2344,  -4133,  -1099,    886,   1388,    490,
+       195,   1844,   1566,   1970,   3147,   4367,   8810,    419,   5889,  -6534,  -1522,  -6100,
+       402,    163,   2934,  -6700,  -6488,  -5468,  -4136,   1709,  -1081,   -646,  -4232,   -761,
+     -3735,   1970,  -3635,   3431,    -43,   3373,  -6250,   2400,    755,  15328,  12687,   2064,
+       787,  -2144,   2768,   4452,   6841,   1646,   5770,  -1827,   5742,  -3085,   1152,  -7496,
+     -2768,   -733,   1939,  -1047,    728,  -1923,    413,  -4041,  -2858,  -2542,  -4531,  -1947,
+     -3991,   6407,   6413,    319,  -4521,  -5224,  -5915,   4371,   -492,   6861,   2028,   3680,
+      1318,   7641,  11351,   2487,   1387,  -3419,   6154,   3868,   6181,  -4580,   5385,  -2163,
+      3408,  -9685,  -3150,  -4945,  -3408,  -4579,  -4248,   3149,   4882,   -696,  -1213,  -5640,
+     -3768,  -3677,  -6394,    650,  -1319,   2335,  -3796,    439,  -2734,   5115,   2136,   4163,
+       -11,   -864,  -2827,   6675,   7303,   2882,  -1581,    124,   6084,   5266,   2843,  -2322,
+      5049,   2747,   5100,  -3779,   5660,  -3395,   -848,  -9759,  -1724,  -1765,  -4301,  -8379,
+     -7998,   3258,  -2116,   -983,  -6569,   3872,  -4080,   3307,  -2966,  12891,   9101,   5412,
+      4102,   3420,   6874,  -2440,  -1202,   3331,  11083,   -749,  -2742,  -5073,   4013,   2651,
+       106,  -2075,   5995,   2953,   4716,  -6173,   1721,  -4795,  -3357,  -6034,  -3287,    924,
+      -818,   1331,   3781,    137,  -2099,  -4653,   -381,   3060,   2345,  -3681,  -2402,  -3077,
+     -6411,  -1466,  -2871,   7799,   2782,   2010,   2147,   5177,   7882,  -3574,  -3707,  -3647,
+        79,   1656,   -311,   2529,   7166,     44,  -1362,  -5756,   1703,    983,  -1622,  -6871,
+     -4310,   3564,   3403,  -1566,  -2736,  -4026,  -7329,  -2029,  -6141,   8760,   3004,   4218,
+     -1152,   6192,   9168,   3713,   2442,  -3866,   1528,  -2147,  -5216,  -1375,    153,   7499,
+      4745,   1766,   4200,    814,   3917,  -2832,     -2,  -3271,  -1138,   -170,    640,  -1283,
+     -3492,   1095,   3562,   3284,     86,  -2930,   -236,   1539,  -2191,  -1223,  -1931,   6828,
+      5360,   3538,   3758,     97,    996,   -370,   3058,   3230,   3486,  -2338,   -447,   3659,
+      9205,   2633,   6400,  -5769,    564,  -4921,    978,   -259,   4640,  -3341,    157,  -4804,
+      1027,  -2970,  -1080,  -4600,  -1166,   -990,    779,  -4397,  -5654,  -2424,    881,   2483,
+     -1134,  -5765,  -5242,   2786,   2770,   -615,  -4796,  -2184,  -1734,   3187,  -1032,   1367,
+       483,   3084,   2156,    890,   1382,   -972,  -5720,  -1922,  -1988,   2113,  -5899,     14,
+     -2084,   7085,    976,   1630,   -679,   2515,  -1062,   2338,   2772,   4800,   2191,  -2467,
+      -538,   3228,   4286,  -3114,  -5039,   -820,   1464,   2139,  -2723,     39,   2188,   3760,
+       590,  -1916,   -468,   1508,    103,    593,   1963,   1037,  -1177,  -1469,   2213,   4130,
+      4416,  -5998,  -5802,  -3336,  -3532,   2194,    219,   3613,    808,  -2312,  -4148,   3258,
+      4248,    713,  -5578,  -1537,   1428,   7629,   3965,  -2557,  -2618,   -694,  -2068,   1581,
+     -1767,   4814,   4674,   5735,   5911,  -3117,  -3091,  -1564,   2018,   2737,   -759,   -462,
+      3431,   4258,   2458,  -3834,   -336,   2794,   3968,  -1698,   1114,   1037,   5726,  -5585,
+     -6259,  -4500,    377,   2198,  -2152,  -3679,  -4158,   2322,  -1173,   3502,   2349,   3780,
+      2583,   -752,    154,    198,    426,     81,    -14,   2248,   4097,   1170,   1925,  -2660,
+       161,  -1688,  -2213,  -1221,    -79,   3822,   3630,  -1481,  -1885,   -511,   1568,    392,
+     -2627,    977,   5326,   4561,   2181,  -5982,  -2439,   3475,   6354,  -1123,  -2115,  -2405,
+      4652,   1254,   -617,  -7757,  -4935,   3082,   4428,   -149,  -4221,  -3373,  -1596,   6646,
+      6822,    919,   -338,  -4289,  -1436,   3838,   6238,   1452,   3195,  -3557,   1057,  -2658,
+         3,   -916,   3353,   -131,   3383,  -4366,   -278,  -5186,  -1380,  -2043,   1060,  -4368,
+     -6168,  -3512,    -53,   3499,   -127,  -4273,  -2282,   2683,   3949,  -3301,  -4126,  -3285,
+     -1220,   -848,  -4814,    882,   3745,   3958,   1304,  -6050,  -3662,    -94,   -138,  -1303,
+     -3169,   1226,   3905,    752,  -1849,  -5866,  -3409,   1911,   1074,  -1933,  -3752,  -1513,
+     -2949,   -122,  -4160,   3933,   3187,   3568,   1055,    167,   4790,  -1106,  -1964,  -6296,
+     -1853,  -1063,  -6850,  -4865,  -7394,   9252,   6261,   5004,   3044,  -2549,  -1560,  -4353,
+     -5430,    467,  -3767,   3026,   -217,   7556,   5253,     69,  -2693,   1201,   3298,   3906,
+      2389,   2133,   7521,   -914,  -1265,  -4646,   3832,   1577,   -519,  -8173,  -4784,   4075,
+      5638,   -554,  -2593,  -3537,   -142,   3002,   4402,   -943,    719,  -4250,    303,  -2344,
+     -2202,  -5556,  -5429,   1558,   1413,    636,  -2270,   -285,   2373,    598,  -1482,  -3316,
+       127,    534,  -1010,  -4586,  -4071,   -206,  -2536,  -1700,  -6784,   1799,  -2668,   7005,
+      4195,   7396,   8907,  -1875,  -1089,  -6365,  -1522,   1809,   4214,  -2073,  -1367,  -6459,
+     -4945,  -2622,  -5002,   -512,  -4844,   2984,    -41,   3911,    126,   -720,  -4297,    971,
+     -2109,   5580,   3263,   5894,   6932,  -1149,  -1010,  -4978,  -1837,   -175,  -3405,   -652,
+     -1558,   3827,  -1456,   1349,   1553,   6414,   3694,  -3173,  -5556,   3616,   5748,   7074,
+      6515,   -909,   2443,  -3973,  -1111,    694,   4827,      5,    692,  -4319,  -2398,   -819,
+       765,   3879,   6049,  -1587,    725,  -4302,  -1285,  -3888,  -3824,   2021,   4192,   1053,
+      -273,  -2351,   1426,   -731,   -926,   -835,   2763,   -357,    114,  -2223,   2276,  -2905,
+     -3956,  -2977,   1684,   1812,    781,  -4196,  -1471,  -3154,  -4290,    125,   3986,    619,
+     -2995,  -6773,  -3213,    663,  -4040,  -1822,  -2141,   3101,  -2800,    154,    793,   4961,
+       383,  -2743,  -2992,   3757,   1674,   3438,   5557,   2387,   1502,  -5034,    506,   3079,
+      4002,  -4870,  -2681,   1384,   7212,  -1091,     30,  -6573,    118,  -2292,    662,  -5817,
+     -5143,  -4685,  -2091,    267,  -2673,  -2972,    -40,   1937,   1805,  -9167, -12242,  -5074,
+     -7904,   6092,   1184,   5367,   -814,  -3580,  -6278,   4516,   3576,   2939,  -1770,  -1202,
+       153,   1639,  -1098,  -1392,  -3013,   1813,   1680,   3389,   1873,  -3389,  -4880,     92,
+      1661,   3316,    493,  -2925,  -2568,    561,    346,   -551,  -3415,   -533,   -771,   1671,
+     -2876,    741,   1474,   3577,   -674,  -2572,  -2194,   3169,    464,    978,   1274,   1653,
+     -1565,  -2034,   -278,   4787,   1512,  -2222,   -862,   3696,   1664,  -2699,  -1854,   5937,
+      8313,  -3153,  -4207,  -2246,   3549,  -1124,  -4977,  -2562,   1028,   2377,  -1004,  -1663,
+      1163,  -4344,   3559,  -1743,  -2216,  -4117,  -1834,   1045,   -576,    485,   3100,    251,
+     -1533,  -7167,  -7267,   1514,  -1286,   2887,   -576,   3065,    144,   -182,  -2138,   5071,
+      6317,   1919,    921,  -1790,   3147,  -1140,   -762,  -3178,     33,  -1720,  -3231,  -1028,
+      1391,    953,  -2092,  -3276,  -2115,   1580,   -980,     41,   -406,   1246,   -280,    -39,
+       207,   -355,  -3022,   -548,    175,   3610,   1364,  -1445,  -2622,   -255,  -2251,   4332,
+      5998,   4238,   3153,  -4774,    -81,   -322,   1063,  -3442,  -1628,   -170,   1169,  -2655,
+     -3528,   -792,   1650,   1275,   1620,  -3855,  -2836,  -5826,  -7967,  -1078,  -3701,   4227,
+      -850,   2248,   -797,   1199,  -1993,   1571,    485,   2995,    258,   -662,  -2408,   2423,
+      2282,   3195,   2275,   -598,    750,  -1336,   -789,  -1964,  -3561,   -761,  -2992,   4569,
+      3904,   3224,    246,  -2070,   -495,   3666,   5413,     36,    700,  -4100,  -1230,  -2015,
+     -3125,   -715,   -188,   3193,   2272,  -1621,  -1676,  -1400,  -1315,   -898,  -3134,   1280,
+      -151,   2339,     91,   2969,   4927,    267,  -1554,  -3780,   -177,   3285,   3865,  -2751,
+     -2973,  -3636,  -2182,   1567,    604,   -668,  -2792,   -401,    -10,   2259,    883,   -702,
+      -997,  -1588,  -3157,    585,   -275,   1959,  -1413,   1273,   1577,   2078,  -1615,    -70,
+      2589,   5082,   4058,  -3644,  -1860,   -455,   1210,   -119,    560,   -675,  -1724,  -2493,
+     -2282,   5843,   9257,     92,   -693,  -7557,  -1735,  -1077,  -2872,  -2535,  -1954,   2670,
+      1256,   -363,    146,     13,    712,  -2561,  -2419,   -377,   1016,   -408,  -1226,  -1634,
+         2,  -1169,  -1839,  -1803,   -929,  -1728,  -4531,   -731,   1146,   2261,   -955,  -5413,
+     -5817,   -596,  -4218,    848,  -3037,   3404,   -788,   1133,  -2387,   1676,  -1431,   1651,
+     -1537,   2775,   1129,   1313,  -2493,  -1717,  -5603,   4471,   2172,   6648,   2516,   1114,
+      2129,    110,  -3560,  -1504,  -1023,   7878,   5552,    639,   -344,   1013,   4204,   1274,
+       761,  -2597,   -583,   1367,   3267,   -199,  -1550,  -2578,    556,   2529,     27,  -2545,
+      -402,   4512,   5510,  -3682,  -4723,  -1522,   2420,   1919,   -526,  -2371,   -599,    214,
+      -381,    880,   2593,   -705,  -1441,  -2429,    427,    496,    483,  -3445,  -3886,  -2736,
+     -3542,   1165,  -2797,    280,  -3029,   4665,   2586,   1848,  -1119,   1229,   2588,    708,
+     -1544,   -679,   1018,    526,  -2448,   -356,     45,   1279,  -3759,   2408,   5010,   5276,
+       700,  -3515,    614,   3192,    885,  -1976,     77,   3732,   4286,   -417,   2851,  -1416,
+        -5,  -4644,  -1652,    733,     41,  -1147,   1524,   3104,   5377,  -5490,  -3087,  -4099,
+      -650,  -3901,  -6262,  -1853,  -2209,   1968,   -668,   1537,    940,  -3344,  -7950,     59,
+      2168,   6524,   2174,  -3982,  -2969,  -1235,  -2667,   -355,  -1695,   1338,  -2431,  -1292,
+     -4731,   4245,   3759,   3441,  -1424,  -4075,  -4756,   3849,   1523,   2577,  -1604,   1579,
+      1546,   3412,   2221,    776,   2515,  -1745,  -3227,  -2460,   -809,   3806,   2034,  -1535,
+     -2369,    278,   2040,     95,  -3078,  -3588,  -3422,   3261,    785,   -389,  -5385,     50,
+     -2103,   6786,   4583,   3655,   2524,  -3042,  -3161,  -1445,  -2413,   1885,   -894,   2866,
+       802,   1536,    -90,   1063,    311,   -261,  -3075,    430,  -1453,   3429,    -43,   2913,
+       492,   2013,   -349,   2252,   -423,   2365,    286,   6194,   6949,   2195,    885,  -1172,
+      3559,   1717,   1617,  -2232,    453,   -209,   -529,   1688,   6412,   1736,   2571,  -6621,
+      -987,  -5040,  -9146,  -4297,  -3985,   9412,   2949,   -106,  -2514,   4038,   4484,   1035,
+     -1672,   -541,   1359,   2392,   1119,   -760,  -1037,    173,    822,   1414,   -726,  -1368,
+      -915,   3150,   2453,  -2076,  -5618,  -1050,  -2529,   4722,  -1323,   3842,    816,   5776,
+      2740,   2591,    509,   3966,   5645,   3171,    688,  -1120,   2060,   5036,   4554,    628,
+      4339,   1128,   1778,  -3181,    747,   3677,   4893,  -1423,   1525,   1386,   5555,  -2815,
+        31,  -2492,    -27,  -3158,  -2132,   3414,   5322,  -2034,   6045,   -717,   -863,  -2341,
+      3791,  -1248,  -4552,  -4743,   -875,   4862,   1517,  -1528,   -290,   1669,   1449,   -857,
+       100,    993,   2163,   -416,   1431,   -917,    553,  -2428,   -533,   -307,    406,  -1333,
+      -552,    658,   2360,   -168,   2132,   -810,   4439,  -4082,   -732,  -7814,  -4566,  -5195,
+     -6051,  -1748,  -3156,   1159,  -1675,  -1725,  -5731,  -1578,  -4978,   3507,  -1286,   2743,
+     -1324,   2268,   -405,    812,  -2182,   1695,    -40,    912,  -4095,   1553,    710,   5721,
+      2202,    717,    742,    315,  -1404,     67,    583,   2588,   -432,   -979,  -1405,   3324,
+      1161,   1093,     51,   2963,   2919,    153,  -1365,    695,   2351,   3145,   3253,   -868,
+      -341,  -1898,   -921,   2503,   4323,   1204,   1795,  -3809,  -2882,  -1608,   -955,   3000,
+      2390,    806,   1140,    245,   2674,  -1079,   -636,  -2155,    709,    998,   2382,  -3066,
+     -3251,  -3018,  -1715,   1851,    663,    157,    508,  -1318,  -3600,  -1681,   -818,   4928,
+      3164,  -1885,  -3105,    173,   1806,   1575,    -37,  -1621,  -2475,   -405,  -1316,   4638,
+      4411,    444,  -1485,   -209,   3768,   2154,    798,  -3138,    196,   1526,   3044,  -1113,
+       985,  -2028,   1116,  -1941,     39,  -2308,   1915,  -1532,    544,  -7958,  -7942,  -4066,
+     -4858,    711,  -5489,   2663,   1062,   4470,    488,  -1995,  -3098,   -485,  -3469,   1500,
+     -1600,   4036,   2056,   2297,   -467,  -1230,   -974,   3205,   2819,  -2051,  -5707,  -1061,
+     -1608,   4012,  -2765,   4054,   4385,   7265,   5570,  -1463,    912,  -1812,   -682,    -38,
+      1323,   1620,   2448,    272,   2714,  -2972,  -2608,  -1344,   3141,   -292,  -4244,  -4832,
+     -1224,   4659,    685,  -2988,  -2836,   2531,   1137,    -29,   -686,   2158,   3034,  -1450,
+     -2506,  -1786,  -1236,    619,  -1676,   1616,   1117,   1953,   1066,    379,    994,   -389,
+       858,    592,   3614,  -3093,  -3804,  -5382,  -3178,    899,  -2845,  -2175,  -5610,   2622,
+     -1282,   3597,   -688,   3272,    520,   1791,    -22,   2650,   1092,    354,  -1162,   3437,
+      4776,    900,  -1042,  -1194,   2499,    714,  -1470,  -2048,    772,    491,  -3571,  -1525,
+       541,   4176,   -292,  -2042,   -424,   2533,  -1667,  -2869,  -4474,   5808,   3181,   2997,
+        23,   2392,   3512,   2198,   2980,   -820,     71,  -2816,  -1792,   1395,   1425,   -269,
+     -2404,    728,   2901,   3031,   2280,  -4777,  -6622,  -2060,  -3014,   6264,   2813,   3341,
+      1915,    -47,   -818,   -466,   -712,   1970,    212,   1343,    537,   1624,    306,    297,
+     -1262,    988,  -1115,   3854,   3782,   2296,  -2505,  -1002,    489,   8687,   8179,   1187,
+      3327,  -2541,    266,  -3599,  -3512,    474,  -1249,   4840,   6050,   5487,   5631,  -5032,
+     -2740,   -677,   2659,   1327,    713,  -1394,    224,    310,   1387,   -217,  -1800,  -1752,
+     -2437,   4722,   3812,   4454,   6018,    867,   2235,  -4581,   -934,   1762,   3917,  -1511,
+     -1151,     28,   4302,   -555,  -1887,  -3538,  -1426,   2373,   1691,   2674,   4434,    357,
+      2401,  -2783,   -701,  -2244,    218,   2028,   3540,  -2422,  -2109,   -884,   2658,   -253,
+     -2266,  -1460,   2324,   1968,   -509,  -2099,   2292,   2799,   2339,  -4773,  -2787,    480,
+      2135,    -19,   -318,   -369,   2450,  -1346,  -3212,  -2528,    -96,   3969,   2370,  -1321,
+      -659,    996,   2767,    678,   2793,  -1114,    883,  -4080,  -1629,    187,   2491,  -2618,
+     -4105,  -2192,    105,   1490,  -2139,   -948,    -66,   3330,   1583,   -223,    -60,   1193,
+      2895,   1285,   2812,  -2761,  -1833,  -2027,    -49,   2015,   3943,    377,   2695,  -5996,
+     -6120,  -3226,  -1159,   4262,   2031,   -544,   -945,   -300,   1509,   2158,   3729,  -3622,
+     -4707,  -1848,   3664,   3323,    -28,  -6886,  -3653,   3027,   3568,  -2239,  -4399,  -1380,
+      1986,   2211,   -186,  -4285,  -3947,    941,   1928,   1077,  -2580,  -3798,  -4001,   4919,
+      5036,    891,  -3096,  -3568,  -1652,   4254,   2168,    -66,  -1307,    225,    560,   1636,
+       776,    579,   1362,    634,   1263,  -1360,  -1470,   -437,   1048,   1935,   1918,  -1762,
+     -1125,  -1078,   -241,   -113,  -3049,   2763,  -1095,   2611,   1927,   -298,  -2080,  -1614,
+     -1214,   1410,    -73,    558,    328,   -663,  -2183,   -477,   -371,    921,  -2037,    771,
+      2547,   2075,  -1092,  -3504,   -851,   2299,   -843,  -2961,  -2455,   3704,   1558,  -1902,
+     -3516,   3191,   4625,    480,   -848,  -1713,   1162,  -3239,  -6869,  -1041,    390,   4202,
+      -849,   -666,    -40,   1607,   -338,   -149,    107,   -709,  -3588,   -342,   -939,   2561,
+     -1695,   1956,   2278,   2490,  -1665,  -1601,  -1588,   4524,   2161,   3072,   3870,   1475,
+      1570,  -2023,    300,    558,    795,    415,   3191,   1122,   1765,  -3651,   -973,    678,
+      3878,   -761,    653,  -4288,  -1585,  -1991,   -228,   -778,   -129,  -2425,  -2399,  -1545,
+      -625,    342,   -922,  -2005,  -1793,   1229,   1884,  -2038,  -4552,  -1978,   -243,   2520,
+      -750,  -1252,    179,    921,  -1131,  -2689,  -2240,   2009,   1246,   -658,  -1461,   -401,
+       331,  -1190,  -3538,  -1202,  -1347,   2634,   -134,    994,   2075,   2387,   3681,  -4020,
+     -2956,  -3975,  -2769,  -1682,  -4353,   1014,    686,   1403,  -2726,  -1404,   -560,   2334,
+      -796,  -2266,  -4187,   1404,   -145,   3330,   1246,   -572,  -3746,     45,    504,   5247,
+      3629,   -641,   -416,  -1486,   -708,    340,   1019,   1186,   2986,  -1269,    355,  -5350,
+     -5266,  -2174,  -1192,   1512,  -2083,  -1683,  -2466,   1967,    596,    518,   -632,  -1686,
+     -3095,   -228,     -6,    900,  -2506,  -2496,  -3823,   1969,   -979,   1980,    181,    454,
+     -3228,  -1108,  -2128,   4019,   1023,    185,  -2664,    -19,  -2924,   2846,    927,   4402,
+      1469,    574,   1826,   1486,    672,  -3750,  -4393,   1130,    521,   2003,   -649,    710,
+        -9,   -190,  -3262,   1046,    321,   4478,   3422,    438,   -558,  -2817,  -2833,   1135,
+      -739,   1162,  -1682,   2304,     77,   2256,   -112,   4008,   5167,   1995,   1248,  -2850,
+      -996,    112,   -351,   1861,   3353,   2046,   3039,  -2801,   -621,  -2714,  -1535,   -689,
+        92,    126,   -516,  -1463,  -1149,   -423,  -2181,   -731,  -1480,   3089,   2818,   -318,
+     -2222,  -2344,  -1789,   1278,  -1294,    362,  -1342,   1717,   -698,   1259,  -1164,   2933,
+      3285,   3727,   4080,  -3343,  -4245,  -2206,    353,   4511,   3024,  -2250,  -2571,  -1155,
+      -315,    847,  -1900,   -194,  -1390,   3124,   1223,   2786,   3622,   2251,   3994,  -4041,
+     -4100,  -2646,   -179,   3439,   2571,   -701,    205,  -2527,  -2839,   -743,    480,   2130,
+       906,  -2243,  -2436,  -1025,  -2128,    755,  -1178,   1819,     63,   1861,   1128,    199,
+     -1866,    300,   1452,   2955,    744,  -1507,   -555,   2275,   2627,   -240,   -132,   -813,
+       285,     19,   1051,    218,   1138,  -2499,  -2533,  -1804,  -2162,    923,   -648,   1708,
+       535,   1014,    756,   -144,  -1292,   -839,  -1400,   2458,   2264,   1998,   1900,  -1728,
+     -2080,   -285,   2419,   2166,    439,  -3786,  -1811,   2072,   3329,  -2072,  -4297,  -3308,
+     -2916,   3492,   1463,   1498,  -1442,     65,   1209,   3494,   2049,  -1993,  -1360,   1052,
+      1532,   -603,  -1623,    847,   2054,    108,  -2447,   -516,    379,   3507,   2847,   1835,
+      4451,  -2221,  -2332,  -3961,  -1374,   1864,   -195,   -125,   -291,   2500,   2775,    896,
+      1512,  -1150,   -563,   -325,   1690,   2620,   4413,  -1612,    367,  -2149,   2487,   -783,
+      1420,  -3386,   1500,  -2936,  -1380,  -6732,  -6818,  -1085,  -1536,   3268,    760,    491,
+      -310,     74,   1303,   1268,   2732,  -1975,    421,  -2246,   1775,  -4063,  -4241,  -5656,
+     -4721,    637,  -2070,    790,    -76,   1330,   -302,  -2872,  -3883,    -26,  -1970,    323,
+     -2921,   3963,   4770,   1719,   -585,  -2840,   1807,   -447,  -2194,  -5122,  -3059,   -341,
+     -4901,  -1902,  -3291,   4519,  -1176,    -17,  -2593,   4729,   2219,   1352,   -411,   1023,
+      -779,   -289,  -1366,   4905,   4740,    405,  -1026,    253,   4375,    914,    137,  -3989,
+     -1277,    596,   2710,   -210,    151,  -5726,  -5715,  -1045,  -1578,   1073,  -4107,   1391,
+       318,   5674,   4642,    969,   1320,  -3720,  -2669,   -836,   -928,    625,   -708,   2043,
+      2920,   2312,  -1007,  -2757,  -2924,   1078,   1031,   3577,   2797,  -1465,   -994,    524,
+      3644,  -1357,  -3755,  -3044,    109,   3956,   2617,  -1243,    705,  -1844,  -1821,  -1906,
+      -415,   1459,   1222,   -412,   1820,  -2425,  -4276,  -3386,   -219,   4346,   1977,  -4637,
+     -5182,    910,   2404,   1847,    329,  -2216,   -881,  -2102,  -2948,   -796,  -1565,   1196,
+       344,    645,  -1080,  -1915,  -2434,   1989,   1640,    220,  -1038,   -732,    293,  -1063,
+     -3071,  -1337,  -1889,   1737,   -533,   1555,    921,    668,    438,   -782,  -1062,  -1994,
+     -2513,   1409,   1937,   -838,  -4394,  -2396,  -1883,   2952,  -1507,    531,    -54,   2756,
+       206,   -540,   -301,    940,  -1277,  -1890,  -3728,   2978,   1429,   2792,    503,   1175,
+      2131,    304,    148,  -1750,  -1157,  -1558,  -4034,    481,    273,   4409,   2102,  -1318,
+     -2373,   -132,   -428,   1289,  -1280,   1548,   1731,   2487,   1728,  -1144,   -350,  -1075,
+     -1252,   -652,  -1244,    823,   -330,    606,   -328,    454,   -623,    -33,   -906,   1020,
+       380,    246,  -1257,   -448,  -1535,    952,   -874,   1901,   1260,   1084,   -656,  -1365,
+     -2425,    970,  -1135,   2527,   1354,   2069,   -239,   -811,  -1174,   2680,   2300,    509,
+     -1156,   -970,  -1277,   1218,   -641,   1779,    406,   1293,   -431,    981,    -11,   1606,
+       755,   1391,    146,  -1032,  -4621,   1923,    990,   8004,   6874,   1919,   2290,  -2734,
+      -346,    490,   2437,    728,    974,  -1559,   -127,    220,    964,    -63,    -38,    130,
+      1909,    330,   -424,  -2660,  -2008,   2179,   2405,    669,   -348,     90,   3089,    480,
+       280,  -4031,  -2783,   -575,   -721,    605,  -1282,   -547,  -2203,   1643,    244,   1613,
+      -887,    860,   -297,   1424,  -1447,   2030,   1071,   3737,   1979,   1903,   2795,   1097,
+       911,   -668,    665,   1620,   1993,   1032,   2908,    196,    915,  -2025,    236,   1100,
+      2162,  -1479,  -2249,     79,   2669,   3438,   3144,  -1919,   1354,     36,   3199,  -3560,
+     -3051,  -2776,   -144,    900,  -1344,   -498,   1300,   2589,   2003,  -1957,    124,    200,
+      2267,  -2128,  -1189,  -2517,  -1166,  -1617,  -2845,   -254,   -856,    821,  -2565,   1084,
+      1705,   3722,   1165,  -2582,  -2412,   2432,   3153,     13,  -3521,   -905,    623,   4694,
+      1320,    281,    789,   3752,   4863,   1333,   3337,   -437,   4437,  -1629,   2145,  -4058,
+       825,  -3222,   -550,  -4404,  -3358,  -2451,  -3228,    116,  -1632,   2396,   1076,   1641,
+      1759,    474,   1540,  -2204,  -1710,  -1450,  -1339,    314,   -544,   2517,   3483,    461,
+       417,  -1822,   1320,   -691,   -553,  -2270,   -218,    243,    971,  -2151,  -3343,  -2409,
+     -2547,   4334,   4956,    965,   -183,  -3494,   -713,   -302,   -709,   -243,    724,   -306,
+     -1141,     31,   3413,    224,   -935,  -5291,  -3294,    493,   -265,   1039,   1945,   -510,
+     -1423,  -3269,  -1043,    420,   -784,  -2555,  -2325,   -600,  -2877,  -1528,  -3782,   2116,
+      -953,   2308,    470,   1853,    -91,  -1003,  -2154,   1083,    133,   1421,   -425,   -629,
+     -3227,   1006,   -195,   3797,    987,   1775,   2515,    592,  -1682,  -2267,  -1452,   3474,
+       983,    483,   -470,   2231,   1402,   1267,   1412,   1351,   1263,   -499,    916,    706,
+       449,  -1918,  -2715,   1361,    924,   3859,   3993,   1123,    787,  -1114,   3174,   1697,
+      2198,  -4091,   -346,   -254,    305,  -3104,  -1967,   1376,   1656,  -1006,   -636,    840,
+      2815,  -2425,  -3241,  -2149,   -810,    828,   -864,    304,   -651,     35,   -448,   2024,
+      1072,  -1378,  -3373,   2441,   4247,   3358,   2214,  -1790,   1460,  -1086,    695,  -1133,
+      1753,  -2814,  -2681,  -2952,  -1063,   -531,  -3518,  -1661,  -2995,   3235,   1179,   2631,
+      1338,   -585,  -1497,    -40,    871,   1595,    405,  -1858,  -2922,    308,   -374,   2465,
+      -266,   1473,   1912,   2319,    205,  -1610,   -995,   4063,   4487,    632,    932,    287,
+      4458,  -1431,  -1110,  -3325,    333,     65,   -306,  -1261,    587,   -471,   -925,  -1310,
+       499,   -135,  -1727,  -2588,  -3125,   2194,   1346,   2631,   2375,   5873,   1642,  -2103,
+     -1003,   -606,   2221,   -729,  -1532,  -3442,  -1252,    290,  -1660,  -2482,  -4179,   2088,
+      1127,   2212,  -1321,  -1058,  -2654,   2733,   1003,   3827,   2848,    922,    207,   -988,
+      -384,   1665,   1108,    772,    380,   1768,   2882,    902,   1579,   -303,   2777,  -1393,
+     -1665,  -2819,   -711,   2607,   2702,   -503,   -179,  -1419,   -355,   -330,   -670,    605,
+      1106,   1174,    924,   -945,  -1183,    887,   2501,   2504,   3009,  -1430,   1601,   -981,
+      1581,  -3179,  -1668,  -1267,   1483,  -1111,  -2761,  -2692,   -534,   2772,   1845,  -2433,
+     -3471,   -609,    389,   3036,   2562,   -723,   -568,  -1756,   -232,    394,    175,   -472,
+       772,    407,   1276,  -2015,   -840,  -2132,  -2748,  -1365,   -933,   2562,   1023,  -2507,
+     -5148,    849,    714,   4274,   1580,   1939,   4287,    -52,     22,  -3579,   -825,   -197,
+      -867,   -863,   -606,   1167,    886,    200,    906,   -619,   -489,  -1958,  -2029,    195,
+       -28,    530,  -2088,   -215,   -499,   3917,   2594,    182,   -302,   1554,   4686,     26,
+      -794,  -3943,  -1296,    997,    282,    317,    817,    444,    576,   -169,   1392,   -457,
+      -335,  -1206,    520,    -65,   -573,   -575,   1553,    384,   -600,  -2506,   -876,   1259,
+       768,   -274,   1191,    256,    846,  -2673,  -1220,  -1034,  -1242,  -1656,  -2650,   1080,
+       -19,   1531,    308,   1309,   1141,    317,    751,    910,   3222,   -569,    470,  -3827,
+     -2368,  -1097,   -616,     86,  -1574,    504,   1550,   1873,    866,  -1651,    650,    597,
+      1073,  -2756,  -1702,    318,   2583,   -813,  -1173,  -3521,  -2328,   -153,    -30,    835,
+      1153,  -1190,   -322,  -2704,  -3097,  -2147,  -1986,   1686,    336,  -1441,  -3435,   -263,
+      -255,   1557,   -408,   -735,  -1229,   -932,  -2835,   -474,  -3018,   1351,  -1844,   3471,
+      1512,   2280,   -211,    261,    117,   1930,   1294,    963,   1487,    -77,    362,  -1356,
+      -972,   -158,    942,    264,   -574,  -2838,  -3274,    788,    240,    617,  -2332,    276,
+       352,   1512,  -1913,   -456,   -802,   2965,    730,   1003,   1121,    447,  -1407,  -1720,
+     -2645,   2680,    836,   3119,   3177,   1045,   -133,  -3496,  -3784,   1943,    820,   3077,
+      1590,   1683,   1855,   -337,    881,   -197,    270,  -2672,  -3533,     70,  -1337,   1420,
+     -1942,   3417,   2630,   2253,   -812,    453,   1504,   2447,     26,    163,    370,   2810,
+      2321,   2337,   3665,   -638,  -1422,   -923,   1834,   3172,   2090,    -67,   3868,    818,
+      1148,  -4389,  -1128,   1529,   3127,  -1322,   -813,  -1646,    660,    -84,    760,  -1865,
+     -2365,  -1924,  -1660,   1883,   -730,    919,   1313,   3752,   3348,  -2094,  -1173,    392,
+      2645,  -1615,  -3746,  -1029,    803,   2745,   -741,    668,   3195,   3119,   1708,  -2822,
+      -229,   1785,   2998,  -1103,   -775,   -483,   2293,   1211,   2747,  -1774,    788,  -3162,
+     -1856,  -1541,    238,    821,    998,  -1631,   -915,   -830,    607,   -279,   -256,  -1703,
+     -1000,   -146,    335,   -202,    239,   -962,   -572,  -1942,  -2471,    -46,    517,    907,
+      -827,  -1525,   -886,    697,   -740,  -1466,  -3082,   1466,   1001,   2408,   1010,   -731,
+     -1319,  -1297,  -3118,   1534,    343,   4076,   2865,   1262,   1660,   -752,    601,   -749,
+       481,  -1382,  -2637,  -1549,  -2330,   3987,   3962,   2188,    831,  -2441,  -1105,    647,
+      1036,   1074,   1568,   -676,   -420,  -1621,  -1697,   -113,  -1425,   2447,   3053,   2293,
+      1340,  -2349,   -874,    230,     35,    134,    228,   1752,   2706,    102,   1162,  -1968,
+      -920,  -1785,  -1357,     78,  -1462,    669,    182,   3028,   2264,    943,   3057,    789,
+      2717,  -4548,  -3592,  -1587,     89,    726,  -1625,    586,   2388,   1982,   1055,  -2215,
+       -79,   -171,    461,  -1032,    452,  -1398,  -2530,  -2864,  -3742,   2822,   1754,   2403,
+        15,   -540,  -1061,   1810,   2389,   3251,   4412,  -2354,  -2478,  -2292,   1553,   2382,
+      1329,  -3129,  -1053,     38,    411,  -1566,  -1392,   -119,   -560,   -660,  -1218,   1169,
+      -357,   -337,  -1242,   3908,   5872,  -1920,   4000,  -3421,   1074,  -3011,    815,  -2959,
+     -1733,  -2006,     78,    544,    918,  -1404,    -99,  -1103,    230,  -1390,   -914,  -1635,
+     -1489,   -424,   -736,    604,    397,     53,   -477,   -158,   1537,    335,   -145,  -3675,
+     -3686,    316,   -217,   1417,   -255,    942,    901,   -466,  -1725,   -445,  -1152,    907,
+     -1503,   2922,   3026,   2797,   1908,    -94,   2853,   -423,    136,  -2189,    837,   -131,
+      -323,  -1721,    894,    178,  -1076,  -3855,  -4339,   2584,   2582,   2687,    265,   -910,
+       538,   2147,   3283,   -298,    811,  -2009,    136,  -1124,   -523,    -75,   2229,    183,
+       425,  -3440,  -2122,   -350,    243,    846,   1399,   -169,   1139,  -1531,    854,  -2264,
+     -1674,  -3362,  -2423,     36,   -756,  -1068,  -2996,    297,   -127,   1771,   -390,   -162,
+      -403,   1347,   1161,    120,    186,   -370,   1074,  -1428,  -3165,  -2541,  -2488,   3885,
+      2826,    429,  -2056,   -543,   1482,   3006,   2127,  -1673,    238,   -759,   -119,  -2304,
+     -1964,    -73,   -984,   -827,  -3087,   2595,   3141,   2255,   -740,  -1662,    -74,   2824,
+      2459,    635,   2034,   -842,    139,   -998,   2166,     68,    721,  -3361,  -1085,   -944,
+      -545,   -940,    287,     14,   -201,  -2337,  -1757,    355,    896,   -288,   -836,  -1352,
+      -700,    710,   2385,   -815,  -1480,  -4329,  -2923,    531,   -517,   -864,  -2276,    210,
+      -410,    300,   -999,   -407,  -1823,   -512,  -1979,   1320,  -1265,   1182,    239,   3214,
+      2940,  -1111,  -1781,  -2006,  -1983,    158,  -1730,   1699,   -410,   1132,   -537,   2993,
+      3368,     40,  -2219,  -1546,   -109,   2887,    957,    256,    415,   1056,   1120,    757,
+      2205,    -20,    624,  -2349,  -1463,   -538,   -380,    852,    782,    487,    532,   -579,
+       -71,    155,   1751,   -303,   -406,  -3101,  -2543,    357,    -55,    232,  -1415,    926,
+      1560,    583,  -1577,  -1260,   -456,   2580,   1775,     22,   -176,   -615,   -348,    785,
+      1355,    687,    630,   -829,    377,    223,   1185,   -564,    594,  -1166,   -160,  -1390,
+      -819,   -341,    626,    100,    291,  -1666,   -965,   -314,    858,   -457,   -103,  -1719,
+      -389,  -1434,   -741,  -1813,  -1859,  -2607,  -4333,   -226,  -1124,   1756,  -1758,   -709,
+     -2601,   1851,   -383,   1708,   -848,    974,   -304,   1908,    811,    584,   -219,    282,
+       -71,   -709,  -3449,    844,    497,   4480,   2293,    860,   1852,    358,   1147,  -1634,
+      -781,  -1265,  -2072,    511,   1146,   2139,     68,  -1657,  -1133,   2417,   2792,    279,
+       375,  -1413,   -569,   -944,   -173,   1097,   1865,  -1910,  -2683,  -1740,   -629,    648,
+     -1926,   -740,  -1215,   2070,    459,    339,   -539,   -176,  -1796,   -198,  -1534,   2534,
+       602,    776,  -1916,   2148,   2923,   2853,    252,  -1428,    541,   2630,   2227,  -1497,
+     -1085,    158,    992,   -384,  -2019,    -62,    331,   2663,   1965,    -71,   -889,   -667,
+       463,   2107,   1191,  -1086,   -551,   1360,   2115,  -1738,  -4550,   -494,    -78,   5241,
+      3184,   2508,   4286,  -1107,  -1341,  -2329,    910,   2381,   1450,  -1349,    477,    872,
+      1496,  -1065,     -1,    260,   1804,     50,   1900,  -1510,   -717,  -3025,  -2050,    610,
+       139,    599,    -13,   1382,   2283,    613,   1566,  -1297,   -174,  -1407,    337,   1003,
+      2575,  -1630,  -1112,  -2181,     24,    375,    947,  -1363,   -815,  -1303,    414,     20,
+       175,  -2612,  -2383,   -625,   -867,    226,   -800,   1405,   2033,     54,   -131,  -1594,
+      -195,  -1038,  -1453,   -520,    -32,    118,   -946,   -409,   -547,    393,    -35,   1828,
+      4066,  -1100,  -1952,  -4344,  -1389,    528,  -1562,  -1542,  -1009,   1698,    769,  -1433,
+     -1760,  -1416,  -2995,   -211,   -847,   2438,   -132,  -1350,  -3540,   1055,   -775,   3003,
+       720,   1753,   -579,    692,    323,   3316,   2737,    935,   1930,   -117,    652,  -1849,
+      -639,    719,   1086,   -469,   -121,    527,   1519,  -1162,  -1578,   -285,   1289,    771,
+       145,  -1062,    347,   -235,     40,  -1235,  -1389,   -867,   -705,   1390,   1028,   -896,
+      2777,   -192,   -824,   -917,   1498,     77,   -987,   -294,   2702,    649,    -58,  -2689,
+       193,   -823,  -2513,  -1220,   1182,   2565,    820,  -3181,  -1961,    471,    245,   -159,
+      -138,    229,    -54,   -966,   -494,    352,   -128,  -1101,  -1324,    857,    956,    -76,
+     -1077,   -325,    653,    920,    750,  -1507,  -1584,   -930,   -458,    631,   -403,   -647,
+      -838,    278,   -664,   -355,  -1284,    721,   -666,    752,   -130,   1831,   1081,   -178,
+     -1296,    832,   1544,   1747,   1151,   -242,   1062,   -333,     35,   -107,   2327,    167,
+       906,  -3000,   -515,  -1787,  -1877,  -2391,  -2349,    706,   -858,     66,   -782,   1459,
+       725,   -905,  -2138,    631,   1702,    694,  -1362,  -1854,   -975,    974,  -1190,   -116,
+      -188,   1828,   -324,   -797,  -1390,   3207,   4306,    677,   -461,  -3036,   -675,   1023,
+      1523,   -726,     12,  -2442,  -2435,  -1624,  -1512,    332,  -2024,   -616,  -1915,   1698,
+      -853,    667,   -855,   2162,    952,     90,  -1435,    157,   -817,    690,  -1558,   2022,
+      1112,   1976,    366,    759,    907,    126,  -1472,    537,   1080,   2407,   1007,    148,
+      1500,    768,    903,  -1659,  -1073,   -147,    269,    446,   -272,   -696,  -1191,    994,
+      1155,    435,  -1561,   -654,    -16,   2284,    341,   -517,  -1031,   2017,   2157,   1159,
+       504,   -811,   -350,    271,     93,   1134,   1877,    771,    973,  -2114,  -2051,   -197,
+       393,   1288,   -155,    -71,    495,    829,    -46,   -589,   -434,    826,    -12,    351,
+       208,   1030,    131,   -228,  -1057,   1590,   1390,   2283,   2199,    501,   1162,    -64,
+      2386,    211,   1181,  -2838,  -1121,   -345,    491,   -996,  -2100,    260,   1213,   2147,
+      1612,   -642,    324,   -848,   -276,    392,   2065,    247,    494,  -2004,    270,   -377,
+       147,  -2182,  -1861,   -393,    -27,    575,    348,   -298,    168,   -878,   -540,  -1073,
+     -1320,   -565,   -739,    604,   -158,   -301,   -765,    309,    587,   -212,   -960,  -1870,
+     -3389,     18,  -1329,   3636,   2824,   1182,    344,  -2581,  -2904,   -994,  -2748,   1711,
+     -1372,   2877,    548,   3189,   1201,   1829,   2192,   2369,   3420,  -1335,   -773,  -1681,
+      -291,    333,   -638,    456,    406,   1425,   1047,    282,   -456,    -27,    449,   2767,
+      3352,   -322,   -370,   -560,   2403,    882,   1580,  -2158,   -181,  -2170,  -2205,    -95,
+      1111,   1250,   -243,   -988,    747,   1175,   1339,  -1734,  -1311,  -1451,  -1397,   1162,
+      1723,    221,  -1511,  -1517,   -455,   1550,   -626,    407,   1649,   2366,   1487,  -1903,
+      -148,    520,    882,  -1492,  -1203,    463,   1486,    242,    357,  -1374,   -925,   -687,
+       523,    489,   -205,  -2731,  -3903,    675,    137,   3409,   2107,    925,   1228,   -461,
+      1378,   -468,    626,  -2333,  -1401,  -1421,  -1448,   -325,   -576,    221,  -1706,  -1044,
+     -2519,   2489,   1162,   2162,    578,    892,   1885,    458,     39,  -1839,  -1544,   1285,
+      2216,    906,     13,  -1864,   -657,   -212,  -2025,    -74,    154,   3521,   2991,   -322,
+       311,  -1721,  -1642,   -768,     16,   1839,    375,  -1129,  -1055,   1781,   2023,    335,
+       577,   -447,    474,  -1222,    -78,    -59,    105,  -2632,  -3760,    441,    479,   1879,
+      -361,     86,    127,    267,   -968,     42,   -815,    664,  -1008,   1682,    225,   1803,
+      1167,   2710,   3332,   -406,     69,   -550,   2201,   -887,  -1580,  -2134,   -717,    955,
+      -556,    474,   1220,   1397,   1511,  -1508,  -1353,  -1922,  -2000,   1440,   1504,    206,
+     -2337,  -1152,   -707,   2430,   -285,    168,   -881,   2429,   2106,   1618,    545,  -1503,
+     -2459,   1506,   1661,   3061,   1421,    556,   1985,    341,   -536,   -632,   1299,   2564,
+      2389,  -1288,   -512,   -332,    602,   1224,   2556,   -117,   -640,  -2203,   -648,   2285,
+      2248,    322,   1442,    123,   1669,  -1793,   -430,   -186,   2412,  -1093,  -1386,  -3234,
+     -2022,    993,   1064,    176,  -1359,  -1702,  -2067,   1846,    651,   1337,   -441,   1191,
+      1395,   2018,   1994,    318,   1529,   -618,    330,   -903,   2977,    953,   1277,  -2088,
+      -399,   -278,   1660,   -608,   -883,  -1681,    272,   1215,   1593,  -1623,  -1061,  -1398,
+      -721,     15,    161,    286,    351,  -1250,  -1938,   -583,   -745,   1582,    613,    773,
+       530,    213,    502,   -156,   -174,   -440,   -448,    555,    272,    559,    395,   1281,
+      2930,     85,    286,  -2888,  -1094,    202,    832,   -649,   -943,   -591,    811,    276,
+       -65,  -2454,  -2949,   -184,   -172,   1884,    583,   -565,  -1233,   -822,  -2430,    872,
+       -40,   3137,   1660,    -37,  -1466,    221,    235,   2581,   1886,    827,    422,   -277,
+       212,   1417,   1963,    646,   1152,   -268,   1186,   -474,    185,   -436,    986,    309,
+      1219,   -787,    511,  -1193,   -301,   -839,     69,   -207,    276,   -792,   -747,   -976,
+      -750,    531,    227,   -576,  -2001,    718,   1967,   2488,   2207,  -2271,  -1256,  -2123,
+     -2310,     85,    -63,   1693,     14,   -570,   -847,   1193,    725,    305,   -307,    352,
+       386,    124,   -590,    303,    335,    875,    618,    196,    257,   -631,   -905,   -214,
+     -1171,    217,  -1570,   2345,   1807,   2385,    812,    114,    924,   1247,   1026,    143,
+       990,    933,   1686,   -183,    987,   -437,    700,  -1017,   -432,   -463,    -26,    206,
+       -27,    349,    678,    769,   1373,   -421,   -140,  -1243,   -840,    -43,   -741,    470,
+      -386,   1495,   1074,   1521,   1460,     -5,   -131,    309,   2048,   1195,    933,  -1974,
+      -544,    740,   1067,   -551,   -586,    842,   2240,    104,     -5,  -1356,   -173,   -903,
+     -2527,    419,    402,   3260,   1879,   1285,   2318,    332,    920,   -459,   1943,    154,
+       439,  -1237,   1679,   1075,   2379,  -2795,  -1026,  -1675,    137,  -1003,  -1442,  -1340,
+     -1694,    973,    421,   1622,   1059,    294,    896,   -268,    -55,   -915,   -875,    257,
+      -151,   1258,   1109,    860,    390,    131,    626,    940,    909,   1248,   3378,    861,
+      2026,  -2356,   1132,  -1506,  -1092,  -2859,  -1064,   1603,   1028,  -1491,  -2011,   1379,
+      2777,   1098,    617,  -1321,    354,   -787,   -806,    490,   1995,    487,     23,  -1176,
+       708,    539,    803,   -597,    786,   -218,    780,   -464,   1234,  -1042,   -365,  -1407,
+        42,   -362,   -676,   -453,    513,    753,    238,   -461,    971,   1319,   2748,  -1407,
+      -405,  -2040,    601,    491,   2379,  -2391,  -1519,  -3174,  -1124,   -572,  -1437,  -1332,
+     -1365,    724,   -134,   -200,   -919,    207,   -203,    562,    548,    522,    552,  -1054,
+      -948,   -396,   -323,    -92,  -1085,    531,    848,   1075,     60,   -997,  -1140,   1069,
+      1130,   1579,   1965,    156,   1464,  -1605,   -611,  -1308,   -180,   -119,   -248,    -44,
+      1022,    433,   1110,  -1630,   -624,  -1732,  -1678,   -793,   -945,   1149,    597,    -11,
+      -777,     23,    683,    919,    961,   -565,   1039,  -1084,   -864,  -3167,  -3633,    166,
+      -511,   1595,  -1052,    662,    347,   1738,    383,    -46,    -81,    606,   -371,    224,
+        54,   2076,   2421,    247,    -87,  -1303,   -204,   1227,   2154,   -196,   -352,  -1893,
+      -875,    243,   -712,    231,    110,   2070,   2492,    237,    864,  -1757,  -1041,   -814,
+       283,    827,    316,  -1292,   -907,    628,    893,   -581,  -1499,   -277,   -201,    767,
+      -719,   1114,   1244,   1092,   -115,    452,   1985,   1216,    646,  -1092,   1148,    646,
+       435,  -1811,   -296,   1260,   1777,  -1349,  -1728,    397,   3198,   1417,   1073,  -3704,
+     -1875,   -400,    669,    -21,   -613,  -1456,  -1618,    236,   -588,   1479,   1047,   1416,
+      1120,     93,   1633,    943,   3042,  -2392,  -1656,  -2571,    187,    -20,  -1425,  -1872,
+      -425,   1582,    336,  -2227,  -3006,   1237,   1516,   1626,    199,   -292,    662,    -22,
+      -491,    -53,    809,    778,    902,     -9,   1649,   -965,   -647,  -1600,    361,    -65,
+      -503,  -1473,   -149,    276,    -33,  -1681,  -1606,   -207,   -493,     88,   -900,   -182,
+     -1592,   1001,   1191,   2178,   1124,  -1409,   -770,    323,    492,   -252,   -110,    378,
+       604,  -1129,  -1458,    309,  -2732,  -1750,  -2057,   1900,    159,   2283,    892,    878,
+       264,    386,    461,   1236,   1925,    185,    514,  -1076,    430,   -154,    497,  -1492,
+     -2029,   -831,   -566,   2316,   1968,     70,    100,   -616,    910,   -813,  -1246,  -1251,
+      -255,    516,   -641,   -962,  -1559,    620,   -624,   1505,    782,   1233,    189,    574,
+      1566,    959,    346,   -997,    511,   1318,   1799,   -958,    -62,   -696,    133,    -33,
+      1645,    516,   1653,  -2734,  -1051,  -1852,  -1040,  -1513,  -1474,    -35,   -789,   -892,
+     -1973,    675,   -632,    447,   -993,   2280,   2727,    335,   -654,  -1849,  -1197,   -234,
+     -1959,   1418,   1125,   2247,   1287,    487,   1708,   -831,   -975,   -876,    669,    534,
+      -241,   -547,    761,     13,   -901,   -734,    946,    762,   -496,  -1886,   -963,    894,
+      -339,    -73,    157,   1435,    935,   -467,    386,     80,   -134,  -1321,   -981,   1341,
+      1955,    403,   1369,  -1341,   -223,  -3192,  -3483,   -581,   -839,   1704,   -149,    757,
+       817,    440,   -291,  -1289,  -1514,    710,    423,    480,  -1492,    145,    549,   2644,
+      2039,   -477,    147,   -798,   -234,   -840,   -923,    -60,   -999,    387,   -156,   1938,
+      1533,    438,    778,    -66,    831,  -1271,  -1432,   -614,   -390,    858,   -244,    950,
+      1726,   1297,   1662,  -2015,  -1949,   -835,    915,   1806,   1430,  -2184,  -1674,   -769,
+      -150,    -31,   -904,   -294,   -671,     65,  -1116,    738,    234,   1139,    500,    171,
+      -488,   -596,  -1310,   1656,   1552,   1191,    -87,    161,   1471,    952,     89,   -723,
+      1037,   1730,   2669,  -1635,   -666,  -2009,   -584,   -489,   -853,   -524,   -916,    704,
+       618,    678,    -17,   -774,   -973,    890,   1490,    603,   -909,  -1397,   -501,   2811,
+      3113,   -779,  -1582,  -1102,   1116,   1309,    465,  -1139,    383,   -275,  -1041,   -875,
+       148,   1470,    448,   -537,    783,   1056,   1079,  -1984,  -1265,    457,   1457,   -336,
+      -613,   -682,    470,   -599,  -1518,   -219,    780,    987,   -456,   -516,   1088,   1696,
+      2042,  -1789,   -161,  -1337,    -83,  -2354,  -3219,   -624,   -130,   1771,   -323,   -865,
+     -1075,   1107,    227,    223,   -771,   1051,   1286,   1097,    873,   -259,    967,   -636,
+      -602,  -1299,   -701,    662,    736,    -88,   -555,   -847,   -963,    690,    555,    957,
+       796,   -154,    280,   -688,   -857,   -359,     -3,   1105,    956,   -420,   -417,   -426,
+      -178,   -248,  -1242,    491,    591,   1657,    837,    192,   1117,    572,   1079,   -987,
+      -122,   -237,    727,    -15,    826,   -725,   -291,  -1239,   -517,    347,    519,   -148,
+       296,     23,    828,   -908,   -249,   -811,   -151,  -1230,  -1769,    -68,    211,    793,
+      -485,    -90,    419,    855,    394,   -297,    639,    138,    389,  -1337,  -1178,   -560,
+      -802,    670,    347,    748,   -121,   -232,   -349,   1451,   1858,    528,     57,   -603,
+       940,   1059,   1198,   -783,    789,    568,   2102,  -1471,   -361,   -846,   1725,   -754,
+      -362,  -1717,   1068,   -474,   -125,  -2536,   -719,   -928,  -1158,  -1266,   -520,    435,
+      -355,  -1192,  -1004,   1046,   1740,   -313,   -414,  -1622,   -186,   -353,   -121,  -1194,
+      -944,   -918,  -1283,   -168,   -233,   1049,    984,   -712,  -1032,   -401,   1248,    386,
+      -110,  -2293,  -1387,    296,    993,    416,   1501,  -1761,  -1303,  -2833,  -1427,    220,
+       543,  -1405,  -1811,  -2053,  -2035,   -202,   -912,   -344,  -2328,   -679,  -1445,   1745,
+       229,    -95,  -1326,   -308,  -1501,    343,  -1021,   1645,    477,    937,    639,    457,
+       406,  -1450,  -1946,    171,    988,    655,  -1007,  -1833,  -1812,   1016,    -28,    506,
+      -745,    319,   -216,    468,   -588,    528,    581,    520,   -737,   -896,  -1127,   1386,
+       632,    833,    656,    318,    336,  -1235,  -1875,    219,    594,   1563,    427,   -713,
+      -599,    759,   1501,    -72,  -1114,  -1371,   -188,   1500,    662,   -983,   -614,    525,
+       783,   -838,  -1068,    -37,    638,   -669,  -2296,   -415,    506,   2071,    861,  -1402,
+       536,   1536,   1405,    300,   1253,  -1408,   -273,   -465,    860,   -649,   -721,   -608,
+       418,    499,    662,     80,   1661,  -1215,  -1757,  -1675,    139,   1925,   1496,   -959,
+       564,   -618,     -5,  -2083,  -1266,    294,   1092,   -770,  -1547,  -1277,   -508,    865,
+       343,   -278,   -299,   -569,   -772,    132,    674,    565,    211,  -1487,  -1325,    371,
+      1225,    170,   -484,  -1432,   -236,   -210,  -1149,  -1206,   -980,    917,   -103,   -723,
+     -1713,    396,   -329,    968,   -134,    780,    181,    310,    200,    535,    264,   -661,
+      -915,    546,    668,    -56,  -1397,     18,    539,   1455,    340,   -516,   -624,    300,
+      -140,   1200,   1512,    513,    -26,  -1018,   -453,    809,   1014,    752,   1475,   -923,
+     -1039,  -1346,   -217,    987,    301,   -559,     79,    417,    254,  -1540,  -2400,    448,
+       458,   2011,    885,    456,   1175,     99,    443,  -1080,  -1102,   -246,    -61,   2076,
+      2963,    342,    841,  -2059,    297,   -822,    -78,  -1762,  -1134,   -684,   -752,     19,
+       376,    275,   -176,  -1596,  -1552,    454,    695,    -73,  -1388,   -730,   -363,   1202,
+       479,    -15,    131,   -330,   -300,   -489,   -141,   -342,  -1039,  -1060,  -2054,    978,
+       620,   1763,    288,   -756,   -900,   1243,   1709,    161,   -907,   -890,    268,    946,
+       -54,   -435,    600,    839,    904,  -1488,  -1018,   -796,   -581,   -163,   -537,   -248,
+     -1213,     69,    108,   1046,   -148,   -959,  -1266,    656,   -263,    310,   -752,   1208,
+       888,    836,    569,    -15,    138,   -784,   -817,    249,    231,   -138,  -1155,    200,
+       320,    886,    -85,     87,    677,    133,   -628,  -1126,  -1046,    507,   -838,    111,
+     -1061,   1630,    588,   1120,    -90,   1267,   2115,    906,    120,  -1504,   -381,   1212,
+      1414,   -190,    100,   -602,    -65,   -702,   -772,    151,    265,    230,    -42,   -262,
+      -306,   -372,   -541,    -63,  -1175,   -245,   -908,   2033,   1455,    170,  -1010,    -34,
+       593,    653,   -924,    -98,    473,   1387,     75,   -638,   -767,   1110,   1013,    682,
+      -172,   -876,  -1607,   1147,    925,   1896,    637,    154,    220,    834,    829,   1150,
+      2010,      3,     29,   -953,    786,    618,    656,  -1298,   -690,    -28,    298,    412,
+       849,   -199,   -268,  -1051,   -495,    387,     88,   -142,    -59,    164,   -353,   -607,
+     -1085,   1155,   1274,   1009,    869,   -955,  -1041,  -1243,  -1763,   1165,    352,   1482,
+       446,    851,    757,     55,   -568,    814,   2001,   1075,    347,  -1410,    220,    553,
+       -51,  -1332,  -1336,   1571,   1910,    584,   -402,   -759,     69,   1089,   1035,    343,
+       911,   -363,    225,   -837,   -714,   -208,    256,    681,   -243,   -644,   -668,   1912,
+      2358,    520,    595,   -742,    972,   -865,   -746,   -942,   -215,     87,   -105,    649,
+      1686,  -1037,  -2446,  -1528,   -394,   2233,    686,     90,    875,   -177,  -1477,  -1189,
+      -451,   2367,   1160,    -90,    328,    622,    895,   -701,    -19,   -294,   -531,  -1106,
+     -1452,   1167,    698,    916,    434,    401,    535,   -607,   -998,     22,   -224,    761,
+      -195,   1013,    821,    869,    354,    159,    415,    725,    796,   -131,   -787,    424,
+      1381,   1920,   1487,   -993,   -268,    382,   1235,    542,   1218,   -344,    347,   -783,
+       673,     26,    -84,  -1654,  -1584,   1176,   1326,   1257,   1129,    189,   1137,   -794,
+      -228,    -95,   1041,     15,    170,   -480,    371,   -156,   -192,    227,   1036,    987,
+      1970,   -292,    787,  -1585,     52,   -152,   1185,   -650,   1009,   -848,    582,  -2899,
+     -2362,   -526,   1053,   -216,  -2009,  -1626,   -478,   1434,   -387,   -348,    101,   1583,
+      1511,   -141,   1210,   -659,    200,  -2203,  -1234,   -421,     83,   -431,   -623,   -520,
+        15,   -529,  -1147,  -1243,  -1807,    464,   -491,    916,   -698,    703,    303,   1740,
+      1713,     76,    129,   -994,   -101,     97,    409,   -627,   -913,   -534,   -303,    676,
+       258,   -127,   -415,   -189,   -639,    406,    217,   1256,   -155,  -1788,    170,    431,
+       882,   -166,    634,   -847,   -251,  -2001,  -2353,   -222,      3,    936,   -656,   -578,
+      -669,    674,   -232,     37,   -804,    358,   -226,   1385,   1616,    251,   -191,  -1405,
+      -695,     -9,   -501,    -52,   -221,   -155,  -1596,     63,    468,   1665,   -125,  -1449,
+     -1860,   1519,    987,   1125,    257,    -54,   -640,   -337,   -832,   1893,   1695,    467,
+      -779,   -132,    748,   1677,   1472,   -159,    552,   -624,    120,   -358,     50,   -488,
+      -430,     81,     77,    -82,   -700,    910,   2172,    724,    -75,  -2266,  -1156,    899,
+       653,    275,    413,    675,   1691,   -696,   -119,  -1111,    509,   -835,   -973,  -1274,
+      -484,    237,   -287,   -337,    235,     70,   -215,  -1186,   -645,    -69,   -568,   -865,
+      -929,    697,    528,   -932,  -2282,   -358,    -76,   1429,   -123,   -403,   -640,    237,
+      -684,    317,   -162,    888,    227,    345,    445,    101,   -125,   -646,   -400,     57,
+      -422,   -603,  -1382,    524,      5,    848,   -391,    575,    853,    773,    108,   -828,
+      -448,    317,    -53,     25,    398,    267,   -354,  -1569,  -2045,   1118,   1206,    887,
+      -534,   -825,   -464,    478,   -453,     51,   -443,    483,   -283,    494,   -134,    304,
+      -440,    772,    708,    444,   -458,    -71,    596,    744,    -54,   -971,   -811,    661,
+       529,     23,   -745,   -623,  -1133,    544,   -377,    795,   -601,    590,   -384,   1259,
+       161,   1137,    404,   1165,    977,   1077,   1780,    235,    975,  -1498,  -1045,   -924,
+      -600,    664,     48,    139,   -332,    583,    695,    230,   -466,   -404,   -196,    788,
+       286,     60,   -179,    182,    -42,    169,   -306,    397,    396,    561,     13,   -498,
+      -813,    614,    313,    492,   -558,    491,    629,    944,    -38,   -153,    -87,   1093,
+      1056,    483,    366,   -642,   -680,    398,    830,    385,   -846,   -641,   -700,   1602,
+       522,   1259,   1237,   1214,   1573,    -25,   1251,   -663,     55,  -1188,     -2,   -386,
+     -1023,   -893,   -667,   1589,   1374,   -203,   -663,  -1107,  -1698,    170,   -770,   2139,
+      1114,   1142,    759,    233,    -94,   -621,  -1311,   1359,   1162,   1730,    641,    353,
+       681,   1035,   1190,    655,   1319,    302,   1243,   -264,    652,   -350,   1017,   -142,
+       525,  -1137,   -306,   -288,   -234,   -200,   -167,   1186,   1875,    203,    447,  -1233,
+      -319,   -669,   -899,    236,    238,   1046,    662,    346,    418,    101,    245,    638,
+      1048,    509,    976,    608,   2451,   -349,    343,  -1838,    421,    104,   1011,  -1294,
+      -250,   -948,   -111,   -290,    823,   -161,    302,  -1726,   -765,   -420,    150,   -949,
+     -1413,   -622,   -643,    506,   -403,    718,    982,    543,    247,   -929,   -500,     64,
+       370,    229,    200,   -671,   -773,    -27,    124,    530,     66,    248,    767,    339,
+       548,   -583,    -12,   -727,  -1065,    214,   1071,   1369,   1287,  -1137,   -100,   -921,
+      -707,   -534,    -16,    596,    109,   -254,    872,    563,    450,  -2157,  -1844,    613,
+      1233,    372,   -555,   -260,   1398,    651,    908,  -1915,  -1045,  -1399,  -1213,    202,
+       256,    386,     19,   -557,   -298,   -341,   -388,   -348,   -827,    -85,    -70,   1028,
+      1032,   -780,  -1300,   -762,   -310,    729,     77,     44,      6,   -485,  -1334,    212,
+       601,   1298,    453,   -399,    753,     31,   -181,  -1818,  -1451,    346,    137,    -53,
+      -843,    -54,   -314,   -160,  -1780,    517,    602,   2081,    815,   -964,  -1307,    484,
+       683,    584,  -1256,   -242,     26,   2522,   1777,   -215,   -558,    134,   1106,    398,
+      -761,   -441,    589,   1804,   1241,   -727,   -168,    307,    687,   -206,    -82,    456,
+       927,   -276,   -661,    518,   1891,    975,    980,   -909,   1295,   -481,    334,  -1728,
+       -25,  -1032,  -1357,  -1181,   -442,   1347,   1179,   -542,     -2,  -1003,   -809,  -1094,
+      -868,    370,   -458,   -424,  -1112,   1275,   1262,    921,    976,    -55,   1639,  -1365,
+      -817,  -2534,  -1865,   -832,    314,   2143,   -101,     60,    728,    -42,   -369,   -915,
+      -451,    523,    354,   -170,   -433,   -252,   -540,    220,   -293,    711,     67,    793,
+       905,    929,    997,   -441,    310,     41,    824,   -690,   -334,   -433,    351,   -293,
+      -249,   -540,   -503,   -729,  -1654,    945,   1363,   1331,    -25,   -926,   -194,    929,
+       581,    383,   1237,     90,    -85,  -1250,    -48,    771,    816,   -996,   -879,   -132,
+       293,    333,    424,    -82,     81,   -898,   -819,    187,    272,    125,   -382,    370,
+      1276,    242,   -262,  -1579,  -1019,    747,   1065,     57,   -596,  -1013,   -395,    460,
+      -266,   -440,   -662,    760,    530,   -106,  -1213,   -114,   -258,   1716,   1439,    716,
+       666,   -893,   -362,    -67,    387,   -296,   -958,   -470,   -571,   1116,    749,    739,
+       629,   -611,  -1091,   -328,   -219,   1422,    787,    171,    -87,    309,    731,    104,
+      -496,   -468,   -542,    804,   -154,   1210,   1496,   1373,   1031,   -845,    -82,    446,
+       843,     67,    337,    207,    645,     -9,    632,    334,    849,   -524,    409,    230,
+      1160,   -921,   -153,   -405,    672,  -1101,  -1373,   -328,    555,    426,   -463,   -436,
+      -109,    196,   -717,    935,   1742,    923,    102,   -639,   1235,    636,    327,  -1141,
+       685,    633,   1186,  -1317,     30,   -905,   -112,   -856,    310,   -727,  -1154,  -1596,
+     -1014,    826,     76,   -563,  -1163,    171,   -312,    512,   -395,    494,   -368,   1012,
+      1227,   1355,   1170,   -852,   -197,   -172,    210,     70,    451,    314,    756,   -384,
+       162,   -696,   -698,     73,   1276,    844,    464,  -1630,    -98,    343,    467,  -1529,
+     -1142,    418,   1191,   -495,  -1102,  -1021,   -530,    417,     94,    527,    739,   -615,
+      -709,   -591,   -270,    -84,   -492,    161,     84,   -255,  -1118,    150,    149,    964,
+       199,    346,    852,    173,    -41,   -881,   -659,    494,    998,    484,     59,  -1246,
+      -774,    830,   1608,   -116,   -380,  -1602,  -1009,   -160,   -297,    503,    287,   -597,
+     -1301,   -127,      5,    610,   -609,    108,    468,    767,     88,   -730,   -499,     10,
+      -487,   -294,  -1096,    258,   -752,   1056,     73,    957,   -180,    759,    468,   1069,
+       505,    372,    507,    449,    286,     12,      8,    576,    664,    712,    925,    223,
+       989,    -49,    816,  -1026,   -757,   -563,    394,    593,    421,  -1017,  -1020,    -94,
+       244,    627,    -62,   -337,      3,    693,    541,   -654,   -980,    429,   1142,    441,
+      -447,   -799,      7,    581,    -56,   -212,    317,    281,   -300,   -898,   -943,    538,
+      -234,    288,   -773,    860,    242,   1418,    984,    730,    626,      9,    350,    228,
+       586,    159,    548,   -499,   -813,   -406,   -417,   1143,    388,    753,    488,   1021,
+      1433,    600,   1189,   -545,    204,   -447,    442,     19,    454,    -95,    913,   -412,
+      -249,  -1115,   -479,    254,     53,    185,    712,    384,    456,  -1457,  -1816,   -117,
+      -128,   1571,    664,    718,   1160,    463,    856,  -1032,   -754,   -238,    415,    550,
+        90,   -320,    -41,    485,    395,    297,    605,    482,   1278,   -267,    227,  -1484,
+     -1474,   -119,    150,   1372,    696,    180,    638,    373,    728,   -361,    251,    -21,
+       580,   -345,   -363,   -131,    634,   1161,   1983,   -522,    312,  -1406,      6,   -723,
+      -207,   -272,    742,   -674,  -1208,   -973,    398,   1210,    884,  -1475,   -673,   -398,
+       310,   -782,   -864,  -1192,  -1582,   -248,   -858,    653,  -1209,    483,    152,   2316,
+      1762,   -402,   -557,   -762,   -794,    103,   -447,   1310,    849,    401,   -147,    347,
+       780,    607,    679,   -312,   -215,   -525,   -362,    714,    667,    151,   -284,    149,
+       569,    888,   1256,   -244,   -206,  -1010,   -255,    707,    592,   -517,   -974,    449,
+      1025,   1153,   1172,   -295,    756,  -1031,   -800,  -1123,  -1081,    680,    688,    913,
+       245,   -533,    -14,    524,    179,   -600,   -853,    974,    875,    647,    285,    962,
+       125,    352,   -235,     88,    323,    650,    638,    -82,    352,     52,    393,   -368,
+        -2,    434,   1469,   -214,   -162,  -1262,    -87,    237,    575,   -558,   -238,   -777,
+      -529,    -91,    117,     84,    -65,   -291,     44,   -202,   -457,   -497,   -536,    180,
+      -587,    126,   -495,   1149,    971,   1007,    943,   -428,   -267,   -137,    828,    421,
+        93,  -1246,  -1170,    809,   1214,    978,    467,   -375,    956,    621,   1522,  -1542,
+     -1193,  -1169,     78,    565,     41,   -775,   -544,    308,    220,    459,    975,    291,
+       424,  -1067,   -159,    355,   1150,   -565,     42,   -762,    296,  -1133,  -1111,   -388,
+       687,     83,   -458,  -1330,   -679,     13,   -398,   -116,    125,    100,   -290,   -769,
+      -630,    178,     18,    -54,   -157,   -342,   -709,   -462,   -909,    468,    -11,    770,
+       583,   -163,   -954,   -813,  -1165,   1351,    810,   1053,    323,     20,    256,    546,
+       805,    126,    514,   -198,    585,   -544,   -313,   -649,   -115,     19,   -182,    -90,
+       235,    129,   -127,   -242,    385,    205,   -105,   -667,     81,    377,    106,   -957,
+      -788,    399,    329,   -104,   -556,    372,    794,    299,   -102,   -376,    286,    411,
+       657,   -425,   -238,   -530,     -5,    377,    760,    -76,    690,   -730,   -210,  -1133,
+      -209,   -168,   -123,   -946,   -586,    147,    593,   -655,   -648,   -961,   -565,   -616,
+      -908,   -436,  -1128,   -470,  -1483,    873,    -42,    763,   -319,    786,    799,    253,
+      -225,   -189,    506,    -34,   -381,   -773,   -388,    -99,   -532,   -512,  -1380,   -206,
+     -1183,   1465,    511,    824,   -375,    694,    919,    702,     68,    142,   1432,    173,
+      -230,  -1721,   -884,    213,   -417,   -264,   -990,    648,    221,   1082,    633,    -93,
+      -623,     38,    407,    889,    263,   -200,    238,    612,    866,   -421,   -395,   -433,
+       206,    491,    626,   -507,    -83,   -435,    -12,   -778,  -1085,   -149,     -7,    405,
+      -339,    118,    708,    298,    121,  -1175,   -861,   -641,  -1102,    -22,   -629,    482,
+      -293,    468,   -115,   -290,  -1363,    402,    114,    759,  -1156,    319,    365,   1710,
+       289,   -173,   -393,    646,   -241,   1068,   1279,   1025,    103,   -421,    662,    986,
+       387,   -618,    537,    864,    831,  -1397,  -1071,     36,    111,    195,   -214,    406,
+       222,     51,   -182,    424,    324,    275,    298,    306,    336,   -163,    223,     17,
+      -312,   -633,   -811,    983,    706,    833,    828,    367,    836,   -645,   -209,   -444,
+      -231,    -71,    270,    430,    223,  -1054,  -1577,    412,    605,   1348,    454,   -377,
+      -571,    622,   1291,    913,    187,  -1160,   -393,   1346,   1800,   -350,   -562,   -516,
+       900,    380,    253,  -1098,   -751,   -358,   -557,    900,   1197,    696,    700,   -901,
+      -270,   -580,   -553,   -104,   -248,    854,   1241,    253,   -169,  -1080,   -251,    825,
+       869,   -478,   -447,   -265,   -203,     31,    -11,   1190,   2000,   -261,   -187,  -1547,
+      -586,   -299,   -565,    307,    372,    393,    358,    178,    975,   -826,  -1298,   -907,
+      -117,   1146,    509,   -227,    110,    -26,    -24,   -200,    313,    332,    663,   -653,
+      -264,   -859,   -876,   -432,   -902,    766,    635,   1114,   1008,   -537,   -526,   -342,
+       550,    698,    975,   -768,   -137,   -976,   -530,   -288,    311,    153,    432,  -1175,
+      -959,   -977,   -771,   -296,  -1150,   -242,   -830,    715,   -283,    213,   -696,    717,
+       549,    606,   -266,   -456,   -548,    685,    382,    348,   -129,   -311,   -909,    257,
+      -117,   1314,    753,    340,     44,    277,    844,    274,    189,   -879,   -897,    -43,
+      -126,    956,    738,     12,   -511,   -377,   -392,    670,   -112,    801,   1029,    980,
+       804,   -802,   -513,    -27,     63,    494,    511,    509,    542,   -303,   -140,    189,
+       593,    380,    741,   -231,     36,   -586,    151,    268,    456,   -812,   -871,   -161,
+       -86,    553,    396,    552,    711,   -471,   -397,   -102,    918,    188,   -110,   -540,
+       -98,    257,     82,    474,   1213,    421,    515,  -1232,   -519,    135,    667,     -5,
+        -5,   -270,    484,    -42,    -18,   -540,     16,    340,    827,   -314,   -179,   -630,
+       265,     95,     73,   -623,    232,    280,    732,  -1180,   -876,   -641,   -113,   -187,
+      -410,    -93,    198,   -489,  -1119,   -431,   -411,    519,   -596,    499,    689,   1084,
+       873,   -502,      2,   -578,   -389,   -136,    265,     96,   -171,   -546,   -393,     11,
+      -539,    308,    551,    942,    818,   -529,    198,   -314,    179,  -1062,  -1288,   -377,
+      -241,    938,    573,      8,     32,   -346,    -58,   -342,   -502,   -280,   -467,    138,
+      -528,    492,    475,    950,    906,   -420,   -317,   -542,     20,    264,    292,   -668,
+     -1032,   -309,   -353,    774,    157,    578,    878,    199,    149,   -906,   -592,   -110,
+      -257,    248,     81,    289,    118,    -36,   -195,    -77,   -193,    749,   1419,     31,
+      -350,  -1523,   -890,    167,   -735,    175,      1,   1204,    407,   -294,   -666,    639,
+       443,    892,    761,    626,    875,   -113,    678,     88,    906,   -869,   -350,   -738,
+      -292,   -172,   -283,    177,    -81,    401,    759,    647,    601,   -737,     80,    370,
+       964,   -928,   -828,   -272,    521,     11,   -505,      9,   1087,    371,     75,  -1027,
+       -93,     82,    284,    -42,    760,   -561,   -614,   -908,    120,    338,    -10,   -931,
+      -591,    157,    -18,    -75,   -202,    508,    988,    164,    355,   -882,    -76,   -252,
+       385,   -723,   -785,   -744,   -347,    274,    -98,    -29,    277,     26,   -225,   -660,
+      -420,    325,    110,    -69,   -302,    365,    626,    579,   1030,   -105,    923,   -931,
+      -126,  -1324,   -618,   -170,    702,   -191,    -39,  -1410,   -702,   -598,   -550,   -365,
+      -165,   -190,   -609,   -630,   -223,    353,     32,  -1014,  -1020,      8,     45,   -385,
+     -1068,    -93,    203,     92,   -830,   -642,   -509,    260,   -762,   -240,   -774,    663,
+      -247,    639,    315,    717,    585,   -231,   -106,   -478,   -417,   -315,   -615,     79,
+      -246,    306,   -404,    109,   -163,    846,    616,      0,   -357,     82,    575,    250,
+      -299,   -315,    360,    713,    790,   -406,    473,   -736,   -510,  -1113,   -489,    -77,
+      -715,   -553,   -452,    764,    135,   -561,   -733,    495,    496,   -395,  -1219,    -20,
+       191,    636,   -348,    330,   1144,    449,     97,  -1302,   -533,   -373,  -1076,   -253,
+      -103,   1232,    803,   -611,   -707,   -553,   -649,    -52,   -651,    574,    198,    402,
+      -147,    102,    271,    268,    118,   -596,   -978,   -161,   -300,    964,    507,    249,
+       200,    -41,    208,   -433,   -689,   -395,   -577,    546,     59,    573,    331,    435,
+       773,    -31,    125,   -820,   -377,      9,    454,   -312,   -519,   -823,   -456,     18,
+      -443,   -693,  -1660,    228,   -211,   1525,    587,    157,   -160,     98,    118,     52,
+      -391,     55,     83,    488,    121,   -217,   -610,    241,    463,    897,    754,   -778,
+     -1024,   -386,   -127,    819,    412,    -68,   -423,   -374,   -451,    863,   1061,   -173,
+     -1283,   -844,   -354,   1550,    516,   -131,   -385,    471,    187,    309,     -7,    623,
+       480,    329,    457,    407,    454,   -374,   -161,    717,   1559,   -138,   -440,   -932,
+       191,    482,     33,   -301,    350,    627,    766,   -371,    356,    -53,    824,   -448,
+       645,   -889,   -147,  -1591,  -1161,   -442,   -321,     56,   -320,    -44,   -118,     33,
+       199,     92,    213,   -909,  -1068,    -86,    545,    300,   -450,   -971,   -483,    522,
+       457,   -294,   -183,   -727,   -777,   -679,  -1025,    204,   -161,    496,    121,   -500,
+     -1365,   -468,   -672,    935,   -643,     -3,   -782,   1547,    739,    518,   -539,    667,
+       986,   1115,    672,    -86,    738,     94,    322,   -561,    184,     90,    585,   -495,
+       -61,   -554,     84,   -495,   -462,   -699,   -568,   -151,   -716,   -198,   -744,    755,
+       372,    607,    210,     32,   -380,     -5,   -727,     -5,   -559,    397,   -530,    337,
+      -533,    722,    -53,    870,     69,    543,    -76,    914,    843,    840,    481,     10,
+       311,    483,    525,    323,    866,    375,    667,   -546,    163,    188,    836,   -527,
+      -498,   -347,    268,    283,    -66,     95,    734,    199,   -366,   -484,    189,   1180,
+      1071,    -51,    717,      6,    558,   -888,   -321,    207,   1038,     91,    560,   -610,
+       363,   -846,   -379,   -434,    177,   -303,   -609,   -183,    432,    669,    716,   -494,
+       218,   -608,   -318,   -647,   -360,    150,    157,    161,    497,    -28,    203,   -686,
+      -244,    -60,    497,   -219,    -68,   -795,   -390,   -309,   -201,   -312,   -717,   -319,
+      -609,    768,    650,    357,   -152,   -330,    147,    416,    143,   -376,   -142,    436,
+       645,    -90,    216,    -77,    828,   -815,   -979,  -1328,  -1296,    543,     61,   1082,
+       697,     99,    217,     79,    872,   -552,   -734,   -886,    -73,    315,   -396,   -654,
+      -604,    668,    453,     39,   -431,   -458,   -953,    512,    113,   1215,    649,    673,
+      1230,    165,    283,   -872,     50,    151,    211,   -324,    397,    231,    295,   -960,
+      -445,    366,    891,   -376,   -261,   -588,    -77,   -512,   -630,    275,    878,   -132,
+      -596,   -799,    173,     65,   -696,  -1059,  -1024,    783,    443,    313,   -298,   -393,
+      -587,    401,     61,    450,    -74,    539,   1200,    481,    504,  -1609,  -1487,   -323,
+       -79,    891,    246,   -192,   -168,     29,    -54,   -510,  -1443,    114,    -64,   1605,
+       632,    250,    168,    509,    631,     11,    -59,    219,    952,    271,    170,   -924,
+      -593,    265,    456,    630,    935,    -70,    407,   -905,   -342,   -285,    389,   -345,
+      -770,   -886,   -706,    986,   1129,    100,   -315,  -1029,   -527,    236,   -119,     -1,
+        35,    360,    320,   -540,   -680,   -108,    109,     19,   -757,   -233,   -204,    779,
+       240,     62,     16,    -14,   -267,   -194,   -342,    302,   -174,    128,   -227,    556,
+       383,     95,   -615,    -54,    -47,   1168,    949,    119,   -120,   -224,    364,    465,
+       556,   -530,   -272,   -565,   -759,   -316,   -739,    823,    354,    316,   -744,    289,
+       423,   1247,    665,    -76,    137,    -21,   -249,    -27,     41,    635,    128,     71,
+       110,    685,    498,    -55,   -166,    421,    681,    347,    132,   -168,    -76,    506,
+       953,    576,    500,   -804,   -410,    360,    644,    298,    432,    217,    916,   -391,
+       -32,   -475,    159,   -337,   -374,    111,    655,    101,   -171,   -329,    584,    286,
+       419,  -1002,   -734,   -683,   -764,    314,    -94,    374,    -83,    511,    592,    -62,
+      -630,   -268,   -223,    680,    -35,    719,    817,    554,    120,     92,    902,    694,
+       922,   -333,    909,   -536,   -105,  -1114,   -228,   -201,   -409,   -221,    337,    192,
+      -515,   -805,   -443,    874,    198,    -40,     51,    753,    660,   -228,    118,    418,
+      1129,   -545,   -307,   -773,    -40,   -405,   -815,   -239,    -83,    712,    543,   -100,
+      -163,   -573,   -577,    152,    144,    311,   -146,   -292,   -620,    548,    702,    848,
+       767,   -496,     47,   -540,   -286,   -659,   -931,   -161,   -628,    667,    126,    442,
+      -452,    227,    221,    957,    304,    -81,    -16,    656,    710,    -68,   -265,   -112,
+        56,    364,    181,    259,    254,     34,    -49,    152,    353,    258,    183,   -349,
+      -579,     62,    -36,    756,    273,    505,    768,    449,    455,   -560,   -321,    129,
+       398,    421,    559,   -318,   -539,   -298,    226,    822,    353,   -538,   -474,    505,
+       533,    290,    287,    259,    612,   -517,   -740,   -140,    245,    656,    332,   -130,
+       -59,   -221,   -491,    114,   -179,    646,    319,    450,   -123,    -36,   -428,    976,
+       765,   1021,    814,    112,    -63,     64,    439,   1187,   1198,     78,    564,    347,
+      1294,   -370,    -28,   -469,    460,     74,    134,    -34,    672,    156,    330,   -408,
+        82,    326,   -572,   -296,   -635,    272,   -433,    671,    445,    504,    -78,   -201,
+        77,    403,    104,   -403,   -436,    205,     75,    -39,   -541,     51,   -324,    408,
+      -216,    815,    650,    491,     -5,    159,    739,    764,   1059,   -452,    348,   -760,
+      -274,   -812,   -577,    -18,    -57,     36,   -245,      4,     23,    125,   -118,   -155,
+      -315,    208,    120,    400,    387,     40,    216,   -338,   -352,   -415,   -602,    488,
+       657,    676,    557,   -625,   -238,   -305,   -113,   -326,   -650,    116,    209,    450,
+      -139,   -180,    -52,    611,    465,     68,    230,    272,    898,   -158,    327,   -749,
+      -120,   -767,   -630,    -15,    589,    127,    -80,   -953,   -294,    -96,   -113,   -714,
+      -883,   -189,   -283,    259,    -86,    -57,   -254,   -247,   -567,    -29,   -107,    398,
+       123,   -623,  -1331,   -136,   -253,    682,  -1023,    261,    243,   1855,    778,   -149,
+       191,    905,   1332,   -448,    -66,   -491,    100,   -649,   -691,    289,    770,    -99,
+      -675,   -401,    422,    400,    -11,   -667,   -150,   -215,   -673,   -376,   -359,    602,
+       139,     60,    -27,    100,     53,   -152,   -294,    -44,    -88,    215,     -7,     47,
+         7,    200,    244,     39,    335,   -111,     93,   -725,   -550,   -194,   -106,   -281,
+      -874,    -98,   -276,    644,    192,    292,     61,   -192,   -242,    301,    452,   -260,
+      -870,   -192,    171,    788,    182,   -163,    122,    204,    258,    -98,    352,   -350,
+      -423,   -563,    -78,    211,    -44,   -569,   -621,     15,    -27,    216,     47,   -210,
+      -308,   -209,   -209,   -105,   -466,    -20,      1,    170,   -285,   -320,   -355,    178,
+       -94,    -72,   -345,   -203,   -645,    131,     45,    381,   -194,   -600,  -1178,     91,
+      -379,    883,     15,    124,   -583,    263,   -379,    390,   -670,    970,    646,    971,
+      -106,    175,    452,   1188,   1127,     98,    737,   -490,   -131,   -714,   -145,   -142,
+      -596,   -243,    -45,    666,     60,   -377,   -446,    392,      4,    135,   -100,    637,
+       710,     36,    -87,   -430,   -370,     76,     72,    379,     91,   -176,   -224,    218,
+       200,    213,    467,   -185,   -516,   -979,  -1054,    771,    462,    211,   -875,     67,
+       260,   1067,    259,   -289,   -548,    557,    685,    766,    478,   -433,   -264,     65,
+       258,     49,   -412,    -50,    207,    777,    622,   -416,   -572,   -143,    152,    392,
+      -179,   -154,    -81,    547,    266,    -69,   -440,    175,    114,    836,    889,    198,
+       101,   -682,   -643,    290,    350,    786,    637,    -77,    -16,    -88,    261,    210,
+       171,     12,    423,    119,    100,   -257,    330,    384,    733,   -514,    -19,   -473,
+        97,   -481,   -336,   -359,    -97,   -196,   -382,   -378,   -604,     42,   -275,    419,
+       160,    103,   -308,   -238,   -473,    340,   -151,    295,   -231,    575,    317,    274,
+      -451,    455,    958,    998,    569,   -762,   -287,    169,    130,    137,    292,    419,
+       353,   -309,   -114,    369,    637,     73,    283,    -47,    504,   -333,     47,   -333,
+       129,   -486,   -438,   -378,   -618,    -83,   -505,    928,    701,    358,   -227,    291,
+      1098,    667,    519,   -797,     80,     29,    338,   -302,    248,    -78,    369,   -524,
+        -4,   -466,   -237,   -587,   -494,     60,     -6,     46,     36,    167,    324,   -480,
+      -660,   -235,   -155,    252,   -229,    562,   1218,    262,     73,  -1325,   -764,   -158,
+      -432,    286,    236,    410,     89,    -70,    453,     33,   -139,   -652,   -142,     79,
+      -417,   -344,   -192,    765,    501,     -2,    435,    -41,     57,   -945,   -742,     22,
+      -110,    337,    655,    156,   -333,  -1253,   -963,    917,    751,    -39,   -436,     65,
+       587,    -85,   -475,   -419,    -52,    198,   -107,   -172,   -406,     65,    155,    518,
+        18,   -464,   -310,    915,   1305,   -349,   -516,   -735,     39,   -192,   -772,   -260,
+      -129,    450,   -141,    112,     92,    189,    -31,    151,   -290,    602,   -808,    283,
+       265,    745,    220,   -177,     82,    -47,   -146,   -425,   -579,     21,   -212,    438,
+       163,    241,    285,    115,    385,   -515,   -449,   -530,   -402,   -157,   -578,    163,
+       110,    235,   -223,   -149,     63,      9,   -401,   -420,   -466,    143,   -437,    225,
+       187,    360,   -311,   -361,   -195,    700,    631,   -330,   -469,   -616,   -651,     -7,
+      -295,    321,   -107,   -113,   -517,    -36,   -565,    189,   -399,    688,    383,    411,
+        22,   -292,   -380,     13,   -346,     46,   -464,    531,    407,    195,   -761,   -314,
+      -318,   1121,    421,    219,     83,    189,   -216,    -83,    -68,    929,    856,   -114,
+      -201,   -192,     94,     34,     36,    222,    528,   -459,   -693,   -436,   -165,    180,
+      -470,     22,     54,    281,   -510,   -166,   -259,    776,    238,    312,    416,    242,
+        90,   -607,   -704,    298,    423,    576,    445,   -333,   -208,   -541,   -608,     70,
+        57,    299,   -119,   -314,   -540,    124,   -109,    341,      7,    -78,   -664,   -163,
+      -653,    894,    511,    663,     75,   -115,    -37,    269,    -74,   -141,   -532,    443,
+       191,    428,   -477,    298,    297,   1238,    902,    147,    447,     67,    533,   -394,
+      -256,   -359,   -328,    155,    -87,    732,   1025,    515,    814,   -835,   -436,   -604,
+       120,    142,    -45,   -859,  -1009,    113,     11,    496,   -118,     15,   -328,    342,
+       343,    714,    464,   -520,   -776,    407,   1046,    689,    248,   -897,   -336,    126,
+       222,    -71,   -273,   -155,     85,    319,    -12,   -589,  -1030,    574,    527,    858,
+       121,    506,   1462,    468,    458,  -1047,    330,   -137,     48,   -987,   -358,    -41,
+         4,   -303,     52,     -3,    126,   -770,   -773,   -391,   -513,    282,    182,    214,
+      -258,   -416,   -278,    409,    263,   -106,     42,   -234,   -245,   -624,   -656,   -201,
+      -931,    -57,   -515,   1004,    101,    188,   -157,    799,    705,   -121,   -425,    100,
+       629,     82,   -391,   -498,    -39,    215,   -229,   -369,   -470,     90,   -396,     62,
+      -627,    281,   -428,    876,    376,    769,    422,    225,    263,    -88,   -112,    -39,
+      -165,    -56,   -661,    416,    165,    977,    484,    389,    463,    169,    144,    -18,
+       187,    309,    357,    101,    312,     83,    349,   -179,   -172,   -171,     36,    476,
+       523,     14,     71,    -17,    425,     60,    135,   -250,    150,     62,    299,   -188,
+       -52,   -287,   -176,    161,    242,    265,    436,    177,    731,   -303,    104,   -655,
+       -62,   -275,     21,   -162,    254,   -333,   -184,   -585,   -305,   -177,   -142,   -174,
+      -258,   -302,   -531,     15,   -162,    265,      6,    178,     94,   -222,   -585,    196,
+       675,    483,     -3,   -910,   -541,    210,   -131,   -129,   -467,    549,    537,    304,
+        26,   -150,    243,     23,   -102,   -446,   -448,    196,    213,    245,    -80,   -255,
+      -391,    241,     16,    520,    413,    415,    635,    -15,    328,   -525,   -406,   -197,
+       288,    543,    715,   -507,   -166,   -536,    -97,   -274,   -261,   -105,     61,   -102,
+      -333,    -95,    318,    303,    262,   -632,   -178,   -314,   -321,   -687,   -913,    259,
+       246,    302,   -152,   -254,   -136,   -200,   -616,    -81,   -222,    145,   -790,    249,
+       250,    959,    175,   -228,   -181,    470,    259,    239,    426,    241,    254,   -462,
+      -179,     78,    214,    -83,     49,   -178,   -288,   -311,   -174,    349,    -61,   -249,
+      -322,    658,    625,    -66,   -289,    143,    713,    -31,   -453,   -365,    398,    461,
+       210,   -592,   -115,   -157,   -337,   -256,    -64,    444,    379,   -311,   -407,   -342,
+      -450,    326,    331,    533,    309,   -296,    -20,    257,    733,   -238,   -101,   -560,
+       176,   -220,   -136,   -562,     48,   -373,   -642,   -989,  -1015,    300,   -141,     37,
+      -681,     50,   -397,    275,   -571,    534,    242,    705,     69,   -107,   -520,    435,
+       244,   1032,    889,    317,    145,   -611,   -224,    -32,     15,    351,    253,    266,
+       489,    101,    524,   -297,    -63,   -712,   -546,    222,    471,    211,    -35,   -348,
+       -92,    131,    180,    157,    352,   -223,   -197,   -246,     -9,     80,    -49,     37,
+       132,    133,    189,    113,    433,   -227,   -205,   -283,    166,    118,     17,   -285,
+       -43,     96,    288,    -63,      3,   -545,   -694,    199,    664,    566,    218,   -845,
+      -528,     97,    179,     84,   -211,    -66,     35,    416,    499,      6,     68,   -315,
+       -35,     54,    287,    -17,     65,   -231,    346,     36,    214,  -1042,  -1133,   -139,
+        44,    417,   -471,     54,    266,    740,    309,   -118,    231,    186,    189,   -193,
+       167,    167,    340,   -225,     25,   -124,    102,     45,    430,     48,    345,   -365,
+       255,   -246,    239,   -531,    -85,   -433,     21,   -219,    247,   -534,   -372,   -769,
+      -499,   -254,   -530,   -143,   -271,    309,    241,      3,     58,   -589,   -732,   -399,
+      -348,    200,   -508,   -184,   -576,    650,    280,    512,    311,     31,    105,   -251,
+      -234,   -174,   -242,    149,     52,     90,   -204,     19,     30,    327,    258,    147,
+       513,   -235,   -253,   -787,   -778,    120,    -26,    637,    454,   -188,   -699,    -65,
+       400,    966,    725,   -338,    396,   -330,   -191,   -958,   -653,    275,    328,     65,
+       164,   -235,    -10,   -740,   -787,   -270,   -399,    191,   -157,    244,     48,   -101,
+      -349,   -171,   -491,    239,    222,    539,    276,   -471,   -416,   -172,   -372,   -108,
+      -297,    430,    146,   -317,   -906,     24,   -185,    606,    -13,    251,   -249,   -163,
+      -927,    731,    399,   1009,     84,    433,    706,    700,    467,   -151,    393,    180,
+       248,   -251,    265,    168,    264,   -506,   -308,     97,    271,    -63,   -322,     10,
+       207,    305,     86,     76,    396,    -24,   -318,   -173,    359,    547,    195,   -499,
+      -155,    367,    208,    -83,     72,    693,   1173,   -211,    -46,   -506,    496,    -13,
+       440,   -681,   -201,   -976,   -866,     59,    478,    195,   -215,   -723,   -415,      7,
+      -246,     35,     -2,    -44,   -626,    -71,     10,    845,    556,    -49,    122,   -195,
+      -115,   -222,    -12,    223,    277,   -232,   -154,   -220,   -120,   -109,   -197,    -23,
+      -255,    102,     55,    490,    506,    -53,     78,   -194,    240,   -263,   -232,   -450,
+      -320,    -27,   -236,     70,    -48,    252,    197,     30,     20,   -141,     22,    -78,
+      -151,   -268,   -335,    177,     92,     95,   -187,    151,    427,    204,     49,   -462,
+      -165,    -49,   -237,   -171,   -195,    320,    176,    -80,   -365,    -53,   -132,    482,
+       451,    183,    -54,   -291,    -25,    368,    369,   -164,    -82,   -170,   -273,   -157,
+      -213,    699,    798,    -14,   -243,   -232,    386,    216,      3,   -316,    215,    177,
+       253,   -370,     28,   -270,   -232,   -307,    -21,    118,     -3,   -469,   -639,     43,
+        58,    477,    241,   -198,   -454,    -62,    -35,    570,    326,    253,    502,    117,
+       347,   -344,    204,   -240,   -146,   -554,   -419,    342,    527,    253,    421,   -248,
+       309,   -503,    -28,   -450,     44,   -612,   -711,   -570,   -554,    356,    159,    179,
+       -26,   -160,     97,    -75,   -229,   -494,   -357,    248,     87,   -335,   -680,    253,
+       562,    154,   -602,   -467,     56,    723,    217,   -485,   -416,    329,    569,     94,
+       -71,   -464,    -35,    129,    268,   -451,   -485,   -270,     97,     -5,   -377,   -469,
+      -329,    147,   -264,   -174,   -493,    233,    -53,    543,    602,    -12,   -356,   -585,
+      -219,    357,    -65,   -188,    -49,    334,    245,   -451,   -518,   -273,   -644,     45,
+      -181,    857,    531,   -217,   -621,    -76,    -37,    499,    209,    248,    201,   -231,
+      -334,     87,    184,    111,   -232,    -18,     41,    221,   -138,    155,    327,    480,
+       586,   -274,   -139,   -408,     36,     58,    -56,   -443,   -332,    226,    239,   -260,
+      -954,    275,    233,    570,    -28,   -190,    -34,     69,   -259,      9,     11,    283,
+        48,     81,     76,   -151,   -542,    134,    226,    464,   -276,     29,    280,    851,
+       586,   -124,    211,     87,    362,   -262,    -96,   -156,     58,    126,    367,   -107,
+      -177,   -457,   -290,    255,    158,    114,     83,      9,    -34,   -127,   -201,    198,
+       120,    258,    119,    199,    353,    266,    559,   -180,     19,   -452,   -158,    -28,
+       -19,     67,    107,    159,    306,     72,    396,   -299,   -200,   -410,    -21,     76,
+      -128,   -304,   -192,    322,    239,   -190,   -452,    117,    336,    425,    171,   -195,
+       -32,    180,    471,    222,    577,   -569,   -463,   -656,   -431,    222,    -88,    242,
+       243,    345,    358,   -298,   -311,    -99,    160,    273,     81,   -140,     79,    286,
+       498,   -181,    -70,   -226,    236,    -12,    172,   -229,    309,   -514,   -612,   -667,
+      -376,    213,   -380,    -65,     76,    492,   -112,   -663,   -871,    753,    602,    364,
+      -296,    167,    527,    486,    307,     -2,    722,   -242,   -395,   -837,   -462,    468,
+       341,    199,    164,   -248,   -335,    -62,    150,    389,    204,   -270,   -302,     38,
+        36,    342,    223,    128,     80,    182,    476,    223,    330,   -160,    526,     31,
+       427,   -784,   -351,   -255,    309,   -134,    -38,   -409,    279,   -431,   -588,   -964,
+      -773,    196,   -267,     19,   -233,    227,   -288,   -270,   -621,    701,    612,    170,
+      -480,   -283,   -192,    425,   -186,    285,    113,    483,    218,    326,    460,     39,
+       -70,    -57,    321,    249,    231,   -159,    223,   -157,    -92,   -226,     89,   -165,
+      -536,   -214,    -47,    562,    175,    -61,     35,     49,   -204,   -133,   -122,    427,
+       132,     89,     23,    306,    274,    140,    243,     77,    154,    -98,    123,     66,
+        91,   -101,    100,    179,    321,   -122,    112,   -112,    213,   -303,   -250,   -447,
+      -581,     60,    -99,    515,    134,    154,     73,    302,    360,     71,     63,    -88,
+        42,    149,    286,    114,    208,   -119,    150,    -83,    -49,   -212,   -106,    285,
+       459,     14,   -116,   -258,     86,    332,    340,   -144,     84,     72,    525,   -223,
+       -54,   -523,   -214,   -272,   -482,     83,    122,    486,    394,     19,    239,   -317,
+      -206,   -116,    241,    -25,   -249,   -287,      4,    229,     26,    -87,    145,     -9,
+      -265,   -155,    221,    350,    -68,   -393,    -16,    619,    714,   -395,   -306,   -366,
+       -69,    -40,   -173,     40,     59,    146,    201,     23,    103,   -203,     19,   -113,
+       -87,   -182,      0,      8,   -100,   -217,    -26,     87,    -22,   -377,   -441,    -88,
+      -443,    164,     78,    494,    -29,   -397,   -739,    448,     83,    743,    505,    534,
+       376,   -272,    -92,    426,    755,    -74,   -139,   -277,    167,    -11,   -313,    -66,
+        64,    520,    406,    137,    169,    -22,    274,    280,    601,   -167,    190,   -279,
+       231,   -307,      2,   -333,   -236,   -356,   -327,    338,    382,     -7,   -264,    -45,
+       252,    263,     95,      7,    483,    113,    246,   -506,   -164,   -187,    -10,      6,
+        43,     15,    299,     97,    292,   -485,   -216,    -97,    340,   -262,   -423,   -402,
+        -4,    226,     89,   -293,   -203,   -146,    -62,      3,   -132,   -308,   -566,    377,
+       695,    363,    -51,   -682,   -225,    191,     13,   -207,   -185,    110,    -38,   -162,
+      -436,    281,    338,    452,    257,   -114,    293,     33,    243,   -676,   -795,   -229,
+       -65,    537,     70,    -54,   -101,    250,    202,    195,    304,    113,    402,   -253,
+       -70,   -478,   -416,      7,    163,    411,    491,   -338,   -334,   -440,    -84,    157,
+      -107,   -390,   -567,    374,    479,    294,   -121,   -296,      4,    315,    291,    -80,
+       101,   -264,   -239,   -205,    -66,     38,   -265,    -37,    161,    285,   -145,   -432,
+      -362,    630,    664,    -32,   -334,   -283,     17,    339,   -102,   -634,   -206,    153,
+       179,     73,   -166,    -39,    117,    146,    -17,    -24,    226,     17,    -68,   -222,
+       142,    -18,   -216,   -415,   -218,    294,    266,   -174,   -275,   -259,   -208,    135,
+       158,     40,    -65,   -369,   -429,    -37,   -155,    312,    317,     77,    -72,   -452,
+      -399,     79,    -13,    169,    125,    107,    273,   -277,   -222,   -492,   -510,    -80,
+      -157,    264,     79,   -117,   -257,   -139,   -198,     33,   -120,    105,    129,    -77,
+      -232,   -378,   -440,     48,    -80,    104,   -136,   -220,   -614,   -118,   -400,    648,
+       453,    120,   -427,   -312,    -79,    557,    304,   -357,   -576,   -174,   -154,    271,
+       -82,   -127,   -483,    -63,   -410,    372,    -88,    357,     45,    255,     78,    -51,
+      -323,   -128,   -469,    299,    -85,    492,     47,    311,    157,    215,    -45,     81,
+       224,    271,     13,   -395,   -568,    307,    168,    528,    315,    162,    149,   -172,
+       -91,     80,      8,    -98,   -265,    379,    583,    155,    -81,   -353,     34,     85,
+       -50,   -212,   -102,    -63,   -355,   -131,   -251,    363,     52,    131,    -87,     84,
+      -149,     99,   -191,    315,     69,    519,    583,    351,    566,   -343,     44,   -553,
+      -470,   -387,   -487,    355,    209,    277,     15,    -99,    -10,    -88,   -458,   -162,
+      -372,    607,    211,    423,    250,    379,    576,      5,    208,   -263,    165,   -288,
+      -154,   -315,   -124,   -160,   -358,   -205,   -398,    217,    -24,    335,    182,    -19,
+      -247,   -206,   -377,    214,   -132,    364,     56,    340,    151,    179,     -8,    146,
+       198,    414,    559,    -61,      2,   -353,   -137,     80,    185,    112,    105,   -201,
+      -110,     40,    161,     -7,    -17,    -45,    222,   -105,   -208,   -364,   -260,    171,
+        65,     14,   -223,     21,    138,    342,    260,   -264,   -217,      6,    249,     21,
+        33,   -254,    -92,   -346,   -419,     58,    232,   -163,   -887,   -322,    -85,    902,
+       228,   -274,   -355,    341,    405,    109,   -158,   -274,   -165,    258,    281,    -82,
+      -369,   -278,   -148,    259,   -199,    -75,   -167,    327,   -127,    121,    233,    528,
+       366,   -546,   -601,    -35,    -60,     98,   -501,    200,     14,    533,     68,    209,
+       -92,    238,    108,    661,    666,    114,    170,     27,    617,   -215,   -315,   -531,
+      -132,    211,   -164,     35,    232,    434,    360,   -297,   -115,   -200,   -192,    -29,
+        47,    116,   -186,   -165,    -82,    350,     79,   -164,   -303,    194,    -90,    185,
+       -30,    647,    724,     76,    -78,   -305,    -91,    172,      1,    275,    259,    280,
+       311,    198,    452,     17,    375,    -62,    389,   -354,     25,   -218,    237,   -299,
+      -130,   -208,    248,   -241,   -294,   -410,    -90,    -72,   -429,   -188,   -108,    454,
+       343,    -85,   -180,   -398,   -509,    245,    220,    398,    152,     72,    402,    -82,
+      -178,   -300,    125,    168,     66,   -209,    211,   -139,   -300,   -473,   -155,    114,
+      -420,   -225,    -53,    657,    224,   -401,   -447,    336,    324,      8,   -369,     87,
+       175,    328,     36,    187,    387,    153,     46,    -81,    292,    257,    383,   -246,
+        23,    -94,    249,    -25,    207,    -54,    546,   -196,    186,   -697,    -80,   -455,
+      -205,   -523,   -405,   -287,   -436,    -35,    -65,    150,    -97,   -187,   -155,     -4,
+      -180,    -38,    163,     56,   -234,   -649,   -749,    265,     -6,    366,    105,    197,
+       122,   -263,   -461,    -44,   -171,    354,     54,    282,    132,    237,    437,    103,
+       132,   -423,   -152,    -76,   -261,    -81,    -24,    585,    574,    -81,     55,   -111,
+       323,   -154,    119,   -319,    -76,   -372,    -69,      4,    110,   -403,   -254,   -119,
+        -6,   -311,   -363,     -1,    118,   -129,   -215,   -126,     24,   -371,   -754,    -84,
+        22,    444,     76,      1,    309,   -151,   -236,   -533,   -286,      2,    -63,   -157,
+      -162,   -312,   -479,   -326,    211,    733,   -471,   -229,   -240,    426,     48,    199,
+       151,    109,    -80,   -148,   -176,    254,    203,    211,    251,   -128,   -207,   -249,
+      -180,    287,    185,    131,    168,    -35,    -71,   -175,    -48,    214,    164,    -45,
+        60,    124,    335,   -142,    104,   -246,    -34,   -460,   -445,    -40,    -40,    141,
+       110,    167,    295,   -417,   -460,    -95,    349,      0,   -389,   -488,    -80,    253,
+       -54,   -387,   -339,     66,    -62,    -96,   -341,     35,     43,    192,    -43,   -299,
+      -468,    102,     31,    202,   -189,     58,     95,    251,    150,     48,    387,   -246,
+      -331,   -594,   -348,     37,   -345,   -111,   -252,    288,     -1,     56,     11,    -94,
+      -479,   -269,   -399,    458,    -51,    167,    -43,    319,    -23,   -103,   -315,    429,
+       316,    193,   -118,    159,    490,    221,     97,   -482,   -248,    -17,    -44,    -36,
+      -169,     38,    -10,     49,   -121,     10,     12,     72,    -80,   -105,   -207,     29,
+      -158,    206,    164,    162,     41,   -166,   -160,   -153,   -404,    116,    145,    284,
+      -215,   -238,   -180,    428,     44,    -44,   -112,    346,    152,   -106,   -231,    339,
+       483,    -16,   -261,   -223,     13,     54,   -320,    -45,    -35,    233,   -264,     46,
+        -2,    507,    248,     52,    -37,     28,    -52,    184,    159,    235,    179,     60,
+       248,    -12,    -24,   -232,    -48,    158,    161,   -146,   -190,    -10,     97,     33,
+      -152,    -45,    119,    115,   -129,   -292,   -365,    266,    112,    265,     72,    127,
+       166,      9,    -73,    -11,    153,    105,    -81,   -226,   -191,    320,    310,     43,
+       -99,    -39,    182,     30,   -197,   -139,     34,    241,      0,    -95,    -42,    120,
+      -193,     45,    118,    563,    413,    -97,     28,    129,    366,    -38,    156,    -40,
+       330,   -304,   -187,   -254,     90,    -31,    -90,   -275,   -267,     79,    204,    307,
+       415,   -307,    -77,   -403,   -262,   -346,   -486,    187,    247,    277,    131,   -312,
+      -298,   -179,    -65,    261,    213,   -322,   -516,    -66,    170,    229,   -132,   -321,
+      -282,    130,    -31,    163,    110,      1,    -36,   -100,    -16,   -236,   -550,   -136,
+      -214,    431,     32,    117,    -85,     75,   -186,    191,     51,    337,    160,    225,
+       306,     27,    -36,    -24,    322,    200,    246,   -290,     73,   -159,     -9,   -255,
+       -33,   -126,   -104,   -190,    -48,    -90,   -198,   -177,    -51,     38,   -140,   -226,
+       -99,     32,   -160,   -404,   -645,     48,   -229,    324,   -141,    189,   -170,    331,
+       357,    351,    173,   -433,   -442,     20,     24,    261,     98,    -41,   -151,   -136,
+      -180,    113,   -122,     25,   -147,    257,    184,    100,    -24,   -143,   -164,      2,
+       -47,    -66,   -522,    -64,   -150,    660,    243,    -38,   -283,    214,    220,    202,
+       -96,     -8,    -30,    166,    -69,    220,    254,    272,    296,   -150,    -93,   -287,
+      -244,      7,   -223,     15,   -230,    373,    206,     94,   -365,     95,    235,    588,
+       315,   -276,   -347,     45,     71,    250,   -136,    102,    143,    412,    214,    -56,
+       -28,     85,    -44,     44,     -7,    293,    -62,     55,    -44,    832,    975,    255,
+       404,   -153,    662,   -372,   -141,   -560,     99,   -179,   -310,   -376,    -85,     61,
+      -320,   -226,   -245,    348,    -29,    153,     71,    308,    135,    126,    396,    218,
+       325,   -432,   -140,   -204,   -165,   -126,    -29,    303,    463,   -279,   -353,   -520,
+      -442,     33,   -374,    246,     71,    486,    264,   -113,   -317,     36,    222,    384,
+       238,   -311,   -342,   -157,   -249,    229,    -53,    201,   -162,    313,    339,    470,
+       370,   -174,    -18,    -71,     72,    -48,    -56,   -131,   -261,    -27,   -199,    217,
+      -161,    219,   -141,    404,     75,    622,    613,    342,     90,     59,    798,    565,
+       692,   -914,   -424,   -231,    -47,    -85,   -202,    371,    376,     46,    -57,    286,
+       446,   -350,    252,   -182,    252,    -68,    274,   -347,   -146,   -244,     76,    -58,
+      -234,   -143,    179,    365,    198,   -433,   -302,    259,    482,     55,     88,   -180,
+       179,   -360,   -507,   -132,     24,    354,     67,    138,    348,    126,    187,   -182,
+        48,   -195,   -179,    211,    704,    123,     87,   -686,   -120,   -147,   -223,   -296,
+      -211,    130,   -109,    -38,   -145,    211,     41,    180,    165,    147,     97,     31,
+       298,     36,    -28,   -317,    -71,    164,     35,   -137,   -201,    285,    364,    275,
+       341,    -80,    200,   -209,     45,   -213,   -119,   -121,     -4,    126,    184,    -20,
+       107,   -212,   -236,   -127,     36,    196,    -21,   -118,     30,    240,    134,   -206,
+      -182,    189,    238,     -8,   -184,     54,    159,    205,     23,    142,    304,    237,
+       290,     88,    574,    -33,    236,   -530,   -153,   -194,     40,     61,    260,   -111,
+        24,   -274,    -65,   -126,   -146,     65,    317,    248,    402,   -345,     20,   -365,
+       -98,   -321,   -199,   -140,   -176,    -79,    -94,     95,     15,   -128,   -262,     62,
+       116,    173,    -19,    -79,     34,    164,    187,   -116,    -99,    -86,     26,    -25,
+      -212,     13,    221,    301,    133,   -425,   -467,    144,    161,    360,    226,    104,
+       194,   -172,   -215,    115,    374,    258,    153,   -143,    256,    103,    293,   -237,
+       107,   -214,     61,   -199,     63,   -274,   -300,   -239,   -165,    221,    153,    144,
+       266,   -135,   -168,   -210,    118,    214,    185,   -340,   -225,    -70,    -10,     29,
+         1,    116,    267,      2,    126,   -250,    -79,   -191,    -30,    -28,     31,   -170,
+      -179,   -114,    -78,     89,     94,    -30,    -91,   -147,   -103,    100,    139,     -5,
+       -60,   -212,   -233,     82,    138,    154,     57,   -173,   -116,    -52,   -116,     28,
+         3,    104,    -22,    -18,     -1,    101,     -4,    -56,   -122,    158,    118,    165,
+       111,     89,    170,     88,    292,      0,    162,   -262,     17,    -44,    222,   -272,
+      -271,   -257,     52,     88,    -62,   -402,   -449,     73,    -37,    202,    -26,    197,
+       279,      4,   -183,   -179,      0,    294,    248,    -11,    188,   -159,   -106,   -311,
+      -141,     53,      5,   -132,   -162,    -63,   -205,    -79,   -300,    220,     17,    317,
+       240,    190,    199,   -216,   -209,   -109,    -83,    132,     40,     45,    -99,    -34,
+       -85,    163,    -17,    104,    109,    208,    129,   -167,   -190,     12,   -152,     38,
+      -183,    432,    316,    181,    -78,    118,    242,    265,    188,    104,    345,    -90,
+      -191,   -145,     59,    232,   -100,    113,    301,    554,    624,    -53,    368,   -357,
+      -247,   -428,   -197,    372,    280,    139,    300,    138,    353,   -318,   -122,    -71,
+       243,     22,    124,   -118,    182,   -173,    -33,   -193,    -41,    -97,    -43,    108,
+       283,    -87,   -143,   -178,    144,    144,    150,   -281,   -187,   -138,    -80,    146,
+       161,     32,     33,     26,    325,    -10,    150,   -320,     34,   -437,   -632,   -277,
+      -140,    467,    -40,   -117,   -178,    488,    516,     73,    -46,   -266,   -133,    143,
+       179,    124,   -119,    -90,     21,    589,    727,     15,     99,   -255,    279,     11,
+       195,   -226,    231,    -93,    222,   -378,    -17,   -226,    214,   -343,   -294,   -522,
+      -279,     19,   -116,   -114,    -74,     69,     30,   -282,   -409,    -85,   -137,    212,
+        83,     57,   -150,   -211,   -352,    312,    242,    302,    136,     11,    175,     35,
+       198,    -88,    103,   -274,   -139,   -196,   -214,    -98,   -135,    254,    247,   -109,
+      -354,   -118,    -10,    334,    119,     85,    195,     40,     30,    -89,    160,     74,
+       137,   -245,   -121,    -71,    104,     64,    195,   -248,   -237,   -289,   -159,    125,
+        83,    -34,    -37,   -153,   -206,   -129,   -258,    159,     81,    247,    119,    -47,
+       -32,    118,    439,     31,    110,   -651,   -500,   -265,    229,    -95,   -171,   -264,
+      -197,    -26,   -305,    -90,   -284,    230,    -40,    122,   -124,     70,   -113,    102,
+       -27,    150,    -10,    -44,   -158,    113,     82,    -23,   -345,    -46,    -19,    352,
+         2,    -50,    -62,    307,    347,    -71,   -214,   -259,   -189,    253,    316,    134,
+       112,   -444,   -362,   -160,   -193,    -43,   -358,    106,    -21,    201,   -129,     54,
+        27,    109,   -172,    -51,   -117,    220,     -8,    179,    242,     93,    -69,   -251,
+       -81,    124,    -70,   -189,   -275,    207,     84,    103,    -63,     91,    100,     70,
+        86,    -21,     25,   -176,   -111,    -75,   -153,   -136,   -182,    180,    162,   -140,
+      -399,   -189,   -229,    247,     17,    156,     36,   -140,   -388,    -65,   -213,    294,
+       -30,    230,     55,    126,    -28,     77,     27,    116,    135,     43,    -30,   -295,
+      -438,    160,    189,    228,   -186,    -97,     42,    334,    185,   -166,   -204,   -128,
+      -230,    121,     11,    178,    -37,      1,    -52,     40,   -212,     33,    -53,    271,
+       -66,     87,     62,    403,    369,    -76,   -110,   -131,    -40,     45,    -94,    135,
+       223,    152,    116,   -175,      8,   -114,   -135,   -198,   -142,      7,   -246,   -248,
+      -607,    344,    167,    472,    -61,     17,    -62,    403,    252,    269,    268,     78,
+       193,     -4,    250,    -92,     40,   -291,   -211,   -137,   -201,    187,    191,    209,
+       220,    -63,    200,   -318,   -396,   -370,   -266,    270,     21,     26,    -58,     72,
+        -4,    -68,   -155,    -17,   -193,     32,   -128,    269,    140,     68,   -175,    -29,
+       -46,    327,    244,     17,   -105,    -61,     25,     79,   -138,     24,     88,    162,
+      -219,    -36,    121,    621,    592,   -227,   -159,   -278,   -124,     10,    -36,    178,
+       124,    -14,     29,    121,    305,   -194,   -267,   -281,   -163,    153,     60,     53,
+       -64,   -141,   -205,    120,    -17,     60,   -109,    241,    247,     25,   -178,     41,
+       306,    150,    -71,   -262,    -32,     99,   -151,    -79,    -21,    296,     93,      8,
+       157,    183,    193,   -314,   -289,    -28,     27,    103,    -57,     39,     29,     62,
+       -43,     53,     13,    122,     86,    163,    253,     13,     37,   -141,     24,     76,
+       214,    -86,   -100,   -207,    -50,    143,    125,    -82,    -73,     56,    270,      0,
+       -18,   -300,   -161,    -27,   -114,     65,     65,    280,    481,     -9,    130,   -516,
+      -307,   -146,     34,    100,    128,   -156,    -19,   -221,    -99,   -171,   -123,    -76,
+        96,    -44,     20,   -499,   -541,   -304,   -423,     78,   -255,    205,    -87,    -19,
+      -466,    189,    162,    416,    -11,   -146,   -118,    163,   -103,     38,     -9,    279,
+        78,    -23,    -45,    160,     73,     15,     17,    180,    223,    -48,     15,     15,
+       298,   -130,    -82,   -400,   -268,   -121,   -137,     -6,   -245,   -180,   -479,    308,
+       196,    393,     66,     -2,    198,    129,    134,   -318,   -242,   -131,   -113,     -2,
+      -164,    -69,   -312,     71,    -93,    328,     86,     44,   -180,    137,    157,    307,
+       276,    -60,     26,   -253,   -272,    -86,   -120,    186,     -8,     92,     20,    144,
+       195,     50,    146,   -275,   -304,   -280,   -321,     68,   -318,    155,    -74,    413,
+        98,    123,     12,    180,     65,     14,   -137,    160,     34,    295,    316,    340,
+       427,   -261,   -229,    -44,    395,    232,    263,   -439,   -140,   -324,   -349,    -83,
+        21,    246,     62,   -274,   -323,     56,     75,     82,   -179,    -98,   -175,    219,
+       129,    242,    257,   -107,    -83,   -231,   -119,   -108,   -288,   -112,   -321,    108,
+      -310,    307,    114,    387,    -74,      8,    -17,    515,    402,     15,    -90,     36,
+       238,    108,    -65,   -125,    -10,    216,    146,    -19,    -77,     -1,    -25,     56,
+      -194,    158,    181,    378,     63,   -122,   -175,    522,    664,    288,    198,   -204,
+       227,     85,    203,   -211,    -55,    516,     95,    109,    174,    -49,     30,   -107,
+        46,    -23,    -37,    -77,     89,    138,    129,   -231,   -114,    108,    312,   -156,
+      -244,   -225,    -35,     49,   -149,     58,    196,     86,   -149,   -142,     44,    264,
+       134,    -37,    158,    100,    215,   -199,      5,    -99,    165,   -164,   -134,   -346,
+      -285,    144,    339,     94,     21,   -476,   -287,   -103,   -135,   -113,   -386,     18,
+       -73,    386,    240,    -27,   -201,   -121,    -77,    221,     68,     22,   -135,     80,
+        84,    326,    342,     41,    177,   -117,    128,   -183,    -10,   -174,    -97,   -207,
+      -258,     64,     24,    118,    -26,    127,    221,     51,     46,    -43,    224,   -104,
+      -161,   -212,     52,    132,     50,   -208,   -199,     26,     99,    303,    508,   -134,
+       -41,   -422,     13,   -147,   -247,   -294,   -136,    181,     74,    -69,     79,    -32,
+        -3,   -324,   -233,    -41,    -19,    -70,   -163,    -69,    -78,     17,    -69,    -14,
+       -47,     34,     29,    -10,      9,      3,    217,   -104,    -29,   -450,   -399,   -217,
+      -239,    150,     69,   -112,   -359,   -190,   -194,     92,   -343,     -4,   -106,    350,
+         3,    -58,   -274,    160,     29,    320,    240,     16,   -129,   -142,    -22,    134,
+      -101,    -99,   -132,    235,     93,    105,    137,     44,    -43,   -186,   -112,    163,
+       101,    -15,     21,     32,     82,   -171,   -161,   -116,   -192,    -27,   -117,    184,
+        47,     44,     79,     28,    -48,   -293,   -380,     70,    -92,    220,    140,    226,
+       122,   -318,   -387,     73,    115,     46,   -342,    -56,    -85,    272,    -86,    160,
+       120,    173,    -51,    -13,    -21,    102,   -167,    135,    167,    334,    134,    -73,
+         0,    132,    144,     30,     72,    -56,   -135,    -36,     33,    260,    154,    -38,
+        45,     97,    155,   -131,    -98,     47,    220,    -71,   -219,   -178,    -90,    190,
+        68,    167,    319,    -91,   -266,   -292,    -58,    309,     77,   -129,    -75,    164,
+       126,    -99,   -124,     46,    -11,    -63,   -240,    299,    426,    194,    -24,   -191,
+       109,    191,    191,    -96,    191,   -109,    -74,   -388,   -298,     92,     80,     62,
+      -113,    -12,     23,    191,    208,     72,    262,   -121,     69,   -386,   -325,   -164,
+        29,    147,     30,   -340,   -358,    -63,   -174,     -8,   -338,    237,    199,    251,
+       -80,    -88,     30,    198,      5,    -84,    -60,    188,    171,     30,     72,    -62,
+       -26,   -157,   -181,     70,    154,    126,     80,   -249,   -265,    -85,    -78,    127,
+       -45,     29,     17,     71,      7,   -101,   -199,    -27,    -71,    207,    142,    -55,
+      -226,    -89,    -55,    113,   -212,      7,    -11,    265,    -65,    -71,   -199,    262,
+        -2,    212,     47,    304,    153,    148,    175,    191,    153,    -19,    133,    225,
+       394,   -112,     32,   -196,    -15,   -113,    -86,     55,     60,     96,    197,    127,
+       259,   -191,     61,   -136,     47,   -300,   -142,    -34,    107,   -316,   -517,   -168,
+      -126,    181,   -308,     71,      2,    470,    347,     97,    145,   -271,   -275,    -85,
+       -15,    143,    -92,     41,    108,    149,     -7,   -104,    -61,     86,    -33,     91,
+       190,    116,     17,   -220,   -102,     70,     -4,    -78,   -161,     29,   -200,     81,
+       -82,    457,    383,    206,    256,    -60,    102,   -278,   -281,     15,    101,    223,
+       117,     48,    210,    -62,   -109,   -112,    146,    193,    265,   -255,   -138,   -352,
+      -424,     -9,    -40,    364,    158,     16,     23,     17,     42,    -30,     10,    -25,
+       -78,    -49,    -35,    113,     63,     29,    114,    -78,   -251,   -225,   -186,    356,
+       167,    -61,   -333,    127,    184,    395,    225,    -57,    -61,    -30,     11,    205,
+       205,     60,     68,    -21,     65,     50,    174,     28,     58,   -178,   -105,     63,
+       124,     95,    173,    -66,   -105,   -193,    -47,    242,    139,   -152,   -181,    269,
+        93,   -114,     39,    -52,    103,    142,    321,   -286,   -240,   -188,    120,    -40,
+      -159,   -224,    -82,    -76,   -293,    -45,    -57,    141,   -118,     94,    172,     75,
+      -144,   -134,     29,    158,     16,   -127,    -82,    -11,    -87,     26,     38,      4,
+       -77,    -28,     50,   -152,   -453,    -83,     -1,    298,   -202,   -101,   -130,    358,
+       -12,    114,    102,    298,    109,    -80,    -67,    142,      0,    138,    268,    280,
+       228,   -275,    -46,     50,    106,   -268,   -395,    116,    269,    240,    -31,   -180,
+        -8,    183,    138,    -89,   -107,     -8,     51,     60,    -37,      4,     84,     88,
+        23,   -107,    -81,     73,     88,     45,    -17,    -60,    -78,    130,    230,    119,
+       129,   -239,   -184,   -136,   -149,    162,    186,     75,   -115,   -177,   -114,    266,
+       244,     83,    120,   -133,    -78,   -124,     -8,     69,     40,   -139,   -147,    -54,
+      -165,     10,    -85,    246,    155,      8,   -122,     21,     94,    100,    -70,    -50,
+       -19,    185,    124,     37,     59,     11,     85,   -115,   -244,    -94,    -64,    325,
+       198,    -51,   -226,     58,    180,    273,     92,    -59,    149,    108,     89,   -250,
+      -200,     30,    -37,     58,    -93,    235,    228,    149,     44,     29,    175,    146,
+       256,    -21,    145,   -214,   -121,    -44,    154,    125,    249,   -174,    -83,   -349,
+      -260,     91,    121,      2,   -176,      9,    182,     80,   -141,   -131,     92,    179,
+        23,   -191,   -100,     12,   -200,     22,     23,    366,    225,     19,     76,     28,
+        58,     31,    239,     79,     71,   -238,     42,    124,    235,   -270,   -205,   -128,
+        17,     23,    -39,    -33,     24,     24,     49,    -46,    -32,    -16,    180,     10,
+       -23,   -361,   -297,     40,      0,     85,      5,     29,    -48,    -97,   -155,    161,
+       137,     82,      2,     25,    132,      1,      2,    -90,    -24,    -54,    -76,     43,
+        56,     -5,   -109,     44,    183,     97,    -69,   -210,   -111,    262,    300,     -5,
+       -56,   -122,     99,     34,    -34,   -119,     63,    103,    101,   -186,    -99,      2,
+       132,    -20,     39,   -182,   -156,   -160,    -91,    154,    215,   -121,   -193,   -228,
+       -89,     49,   -114,    -96,    -92,    187,    262,   -118,   -258,   -329,   -201,    125,
+       -95,   -114,   -289,    101,    -64,    123,   -158,    106,    -27,    262,    229,     73,
+       -73,   -238,   -248,    181,     99,    137,      5,    -24,   -140,    -18,    -92,    280,
+       208,     43,    -62,    -20,     15,     37,    -50,    130,    244,    -13,   -153,   -206,
+       -93,    103,   -119,     34,    102,    222,    147,   -251,   -281,   -127,   -197,     40,
+      -275,    111,   -137,    265,    -72,    187,    -87,    257,     23,    284,    105,    270,
+       214,    158,    101,     21,     62,    146,    181,     17,    -71,     25,    185,    216,
+        83,   -197,   -181,    248,    382,    148,     37,   -259,   -162,     37,    -72,    148,
+        22,    227,    201,    156,    108,    -80,   -106,     87,     30,    217,    149,    294,
+       436,     61,    129,   -237,    -83,    -53,   -108,    201,    257,    310,    343,     32,
+       377,   -125,     28,   -380,   -135,     42,     70,    -16,    -27,    129,    291,     75,
+       165,   -144,    141,   -163,    -76,   -241,   -158,     18,      6,     90,     60,    -14,
+       -69,     18,     55,    145,     97,     91,    320,    110,    281,   -381,   -220,   -251,
+      -111,      0,   -143,     37,     43,    179,     90,    -62,   -103,     89,    187,    185,
+       234,    -65,    152,   -194,   -101,   -200,    -40,      4,    -86,    -91,    -14,    119,
+        66,   -153,   -181,    -41,   -160,     51,    -39,    275,    133,    -40,   -176,    165,
+       236,    183,     83,     19,    265,    -46,    -74,   -272,   -220,    -39,   -317,    278,
+       291,    429,    154,   -127,      4,    202,    186,    106,    276,    121,    240,   -214,
+        23,    -42,     98,   -150,    -74,     28,    135,    -59,   -230,    -28,   -239,     93,
+      -137,    223,     35,    177,     21,     51,    -49,     96,     45,    169,    167,     73,
+       117,    -76,      0,    -68,     11,    -12,     31,    -51,    -10,    -80,    -59,    -73,
+       -79,    -32,    -60,    -41,   -141,    -74,   -243,     50,   -160,    218,     -5,    226,
+        55,    172,    115,    149,    176,     53,    132,    -60,     36,    -99,    -50,    -55,
+       -44,     34,     37,     32,     25,    -63,    -99,    -53,   -105,     81,     -7,     94,
+       -16,     70,     33,    122,    117,     42,     56,    -29,     48,    -12,     41,    -89,
+      -101,   -105,   -173,     44,    -72,    161,     38,    126,     37,     69,     39,     79,
+        70,     55,     59,     25,     57,     16,     41,    -15,    -11,     -8,    -18,     54,
+        38,     71,     56,     45,     76,     38,     88,    -17,     30,    -37,     23,      4,
+        64,    -18,     22,   -100,   -125,    -65,   -131,    118,     18,    176,    104,    128,
+       167,     60,    151,    -61,     50,    -93,     -3,    -58,    -36,     -9,      0,     64,
+        76,     42,     67,     -3,     63,      7,     86,     -9,     81,    -29,     99,    -35,
+       125,    -95,     76,   -189,    -62,   -215,   -169,    -98,   -120,     29,    -29,     33,
+       -17,    -21,    -78,     -7,    -41,     94,     94,     63,    102,    -65,     26,   -117,
+       -37,   -109,    -61,    -80,    -68,    -85,   -138,    -89,   -194,     28,    -68,    121,
+        15,      1,   -106,    -50,   -140,     71,    -37,    103,    -11,     34,    -41,     17,
+       -55,      1,   -119,      4,   -145,     94,    -77,    148,    -33,    121,    -51,    129,
+         6,    182,     99,    113,     47,     23,     -4,     53,      9,     62,     -1,     68,
+        31,     75,     19,     15,    -63,     38,    -60,    124,     -6,    176,    108,    189,
+       188,     37,     25,    -77,    -93,     93,     79,    212,    216,     70,    143,    -84,
+         0,    -93,    -58,     11,     -2,     78,     63,     60,     80,    -25,    -38,    -90,
+      -161,     30,   -100,    196,     64,    230,    164,    112,    107,     10,     45,     23,
+        32,     52,     56,     80,     95,     49,     64,      8,     24,     29,     26,     71,
+        71,     95,    115,     62,    105,     27,    112,     32,    154,    -18,    104,   -125,
+       -51,   -125,   -116,     21,    -31,    127,     79,    112,    103,     17,     25,     -1,
+        42,     57,     69,     -2,    -23,      0,    -16,    101,     56,    118,    101,    107,
+       146,     53,     92,     -4,     65,     67,    162,     62,    154,    -33,    103,    -38,
+       100,    -34,     95,    -48,     69,    -60,     60,    -32,     98,    -61,     40,   -122,
+       -26,    -86,    -44,    -59,    -82,    -10,    -43,     62,      6,     39,    -35,     39,
+       -16,    117,     72,    121,    105,     65,     87,     34,     79,     43,     96,     36,
+        88,     27,    107,     43,    143,     20,    158,    -27,    130,    -88,     67,    -90,
+        55,    -66,     47,    -72,     21,    -75,    -19,    -45,     -1,     22,     68,     20,
+        85,    -37,     44,    -69,     12,    -45,     26,    -34,      7,    -46,     -6,     -5,
+        50,     -7,     25,    -83,    -79,    -42,    -44,     83,     82,     66,     81,    -42,
+         6,    -44,     16,    -15,     -3,    -59,    -93,    -11,    -53,    105,     52,     91,
+        44,     15,    -29,     43,     10,    152,    146,    149,    214,     41,    185,    -81,
+        70,   -131,    -27,    -83,    -75,     27,     22,    158,    180,    104,    186,     -7,
+       165,    -59,    100,   -102,     53,    -34,    133,    -16,    139,    -90,    125,    -97,
+       144,   -174,     24,   -254,   -105,   -180,   -117,    -60,    -52,      5,     13,      2,
+        63,    -40,     47,   -137,    -76,   -163,   -163,    -63,   -132,     67,    -11,    105,
+        45,     44,     54,     30,    113,     -9,    101,   -128,    -26,   -182,   -139,   -108,
+      -150,     12,    -80,     97,     35,    100,     98,     -8,     14,    -99,    -75,    -41,
+       -37,     25,     -8,     -3
+};
+
+#endif /* CONV_IR_TABLE */
@@ -0,0 +1,84 @@
+//////////////////////////////////////////////////////////////////////////////
+// conv_reverb.h - Reverb por convolução com resposta ao impulso medida
+//
+// Convolução particionada uniforme por overlap-save: a IR é cortada em
+// partições de CONV_PART_FRAMES quadros (um bloco de áudio) e o espectro
+// de cada uma (FFT de CONV_FFT_POINTS pontos) é calculado no PC por
+// Host/tools/conv_ir, que gera conv_ir.h. A cada bloco:
+//
+//   1. FFT dos dois últimos blocos de entrada, com L na parte real e R na
+//      imaginária (a IR é real: uma FFT complexa serve aos dois canais);
+//   2. o espectro entra na linha de atraso em frequência (FDL, na CE0);
+//   3. soma, bin a bin, do espectro de k blocos atrás vezes a partição k;
+//   4. IFFT: a segunda metade é a saída do bloco seguinte.
+//
+// Latência de um bloco e custo de duas FFTs mais uma multiplicação
+// complexa por bin e partição, em vez de CONV_IR_FRAMES MACs por amostra.
+// A saída é só a convolução: o som direto, se houver, está na própria IR.
+//
+// Memória: o espectro atual, os blocos de entrada e saída, o acumulador
+// e dois pares de buffers de passagem ficam na DARAM; o FDL e os espectros
+// da IR (seção .efx:ir) ficam na CE0 e chegam pelo DMA de memória
+// (mem_dma.h) uma partição à frente da que está sendo somada.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef CONV_REVERB_H_
+#define CONV_REVERB_H_
+
+#include "tistdtypes.h"
+#include "conv_ir.h"
+
+#define CONV_PART_FRAMES      256       // = AUDIO_BLOCK_FRAMES
+#define CONV_FFT_POINTS       (2 * CONV_PART_FRAMES)
+#define CONV_FFT_LOG2         9
+#define CONV_SPECTRUM_WORDS   (2 * CONV_FFT_POINTS)    // Complexo intercalado
+#define CONV_BLOCK_WORDS      (2 * CONV_PART_FRAMES)   // Bloco L,R intercalado
+#define CONV_MAX_PARTITIONS   64        // FDL em até dois bancos da CE0
+
+// Espectro de uma partição da IR em conv_ir.h: bins 0..N/2-1 (re, im),
+// com Re(H[N/2]) no lugar de Im(H[0]) (os dois são reais); os bins
+// N/2+1..N-1 são os conjugados.
+#define CONV_IR_PART_WORDS    CONV_FFT_POINTS
+#define CONV_IR_WORDS         (CONV_IR_PARTITIONS * 1UL * CONV_IR_PART_WORDS)
+
+#if CONV_IR_PARTITIONS < 1 || CONV_IR_PARTITIONS > CONV_MAX_PARTITIONS
+#error "conv_ir.h: número de partições fora de 1..CONV_MAX_PARTITIONS"
+#endif
+
+// Memória pedida à arena de efeitos (palavras): acumulador Int32,
+// espectro atual, entrada (dois blocos), saída, passagem do FDL (2
+// espectros) e da IR (2 partições); FDL na CE0
+#define CONV_MEM_FAST_WORDS \
+    (2 * CONV_SPECTRUM_WORDS + CONV_SPECTRUM_WORDS + 3 * CONV_BLOCK_WORDS + \
+     2 * CONV_SPECTRUM_WORDS + 2 * CONV_IR_PART_WORDS)
+#define CONV_MEM_EXT_WORDS    (CONV_IR_PARTITIONS * 1UL * CONV_SPECTRUM_WORDS)
+
+typedef struct {
+    Int32* acc;                         // Soma dos produtos (re, im por bin)
+    Int16* work;                        // FFT do bloco, depois IFFT da soma
+    Int16* in[2];                       // Blocos de entrada: in[cur] enchendo
+    Int16* out;                         // Saída do bloco anterior
+    Int16* xStage[2];                   // Espectros do FDL vindos da CE0
+    Int16* hStage[2];                   // Partições da IR vindas da CE0
+    Int16* fdl[CONV_IR_PARTITIONS];     // Espectros dos últimos blocos (CE0)
+    Int16  fdlExp[CONV_IR_PARTITIONS];  // Expoente do bloco de cada espectro
+    Uint16 head;                        // Slot do FDL do bloco mais novo
+    Uint16 filled;                      // Slots com espectro válido
+    Uint16 cur;
+    Uint16 pos;                         // Quadros já em in[cur]
+} ConvReverb;
+
+extern ConvReverb g_convReverb;
+
+void initConvReverb(void);
+// Init em partes (effectControllerPoll): InitBegin toma a memória e zera o
+// estado, InitStep zera entrada e saída aos poucos; 1 = pronto. O FDL não
+// precisa ser zerado: só os slots já escritos entram na soma.
+void  convReverbInitBegin(void);
+Uint8 convReverbInitStep(Uint16 words);
+void  processAudioConvReverb(Int16* left, Int16* right, Uint16 frames); // Planar, in-place
+
+// Espectro da partição p da IR, no formato de conv_ir.h (referência do host)
+const Int16* convReverbIrPartition(Uint16 p);
+
+#endif /* CONV_REVERB_H_ */
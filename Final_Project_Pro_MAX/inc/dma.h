@@ -11,12 +11,21 @@
 #define AUDIO_BUFFER_SIZE 1024
 #define AUDIO_BLOCK_SIZE (AUDIO_BUFFER_SIZE / 2)
 
+// Formato do stream da McBSP: 48 kHz, L e R intercalados
+#define AUDIO_SAMPLE_RATE   48000
+#define AUDIO_NUM_CHANNELS  2
+#define AUDIO_BLOCK_FRAMES  (AUDIO_BLOCK_SIZE / AUDIO_NUM_CHANNELS)
+
 // Function prototypes
 void configAudioDma(void);
 void startAudioDma(void);
 void stopAudioDma(void);
 
+// Aplica a cadeia de efeitos atual a um bloco (chamado pela ISR de Rx)
+void processAudioBlock(Uint16* rxBlock, Uint16* txBlock, Uint16 size);
+
 // External variables
 extern volatile Uint16 dmaPingPongFlag;
+extern volatile Uint16 audioDmaRunning;    // 1 entre startAudioDma e stopAudioDma
 
 #endif /* DMA_H_ */
\ No newline at end of file
@@ -6,13 +6,190 @@
 #define EFFECTS_CONTROLLER_H_
 
 #include "tistdtypes.h"
+#include "flanger.h"
+#include "reverb.h"
+#include "pitch_shift.h"
+#include "conv_reverb.h"
 
 // Definições de efeitos
 #define EFFECT_LOOPBACK  0
 #define EFFECT_FLANGER   1
 #define EFFECT_TREMOLO   2
 #define EFFECT_REVERB    3
-#define EFFECT_COUNT     4
+#define EFFECT_CONV_REVERB 4
+#define EFFECT_COUNT     5
+
+// -------------------- Arena de memória dos efeitos --------------------
+// Os buffers dos efeitos saem de uma arena por tier (DARAM e CE0), dividida
+// em slots. Efeitos do mesmo slot nunca rodam juntos e usam a mesma memória:
+// o slot PRINCIPAL é do efeito atual (flanger, tremolo, reverb ou reverb
+// por convolução) e o slot PRE é do pitch shift, que roda junto com o
+// reverb.
+//
+// Cada efeito declara o que precisa em <EFEITO>_MEM_FAST_WORDS e
+// <EFEITO>_MEM_EXT_WORDS no seu header; o slot tem o tamanho do maior
+// efeito que o usa. No init, o efeito chama effectMemAcquire (que devolve
+// o que o dono anterior tinha) e depois effectMemAlloc para cada buffer.
+
+#define EFFECT_MEM_FAST      0       // DARAM
+#define EFFECT_MEM_EXT       1       // CE0
+#define EFFECT_MEM_TIERS     2
+
+#define EFFECT_SLOT_MAIN     0       // Flanger, tremolo, reverb, convolução
+#define EFFECT_SLOT_PRE      1       // Pitch shift
+#define EFFECT_SLOT_COUNT    2
+
+// Donos dos slots além de EFFECT_*
+#define EFFECT_OWNER_PITCH   0x10
+#define EFFECT_OWNER_NONE    0xFF
+
+#define EFFECT_MEM_MAX(a, b) ((a) > (b) ? (a) : (b))
+
+// A arena da CE0 é feita de bancos: no modelo de memória large do C55x um
+// objeto não passa de 64K palavras nem cruza página. Uma alocação na CE0
+// nunca cruza banco e cada slot começa num banco novo.
+#define EFFECT_MEM_BANK_WORDS   32768UL
+#define EFFECT_MEM_BANKS(w)     (((w) + EFFECT_MEM_BANK_WORDS - 1) / EFFECT_MEM_BANK_WORDS)
+
+#define EFFECT_SLOT_MAIN_FAST_WORDS \
+    EFFECT_MEM_MAX(EFFECT_MEM_MAX(FLANGER_MEM_FAST_WORDS, REVERB_MEM_FAST_WORDS), \
+                   CONV_MEM_FAST_WORDS)
+#define EFFECT_SLOT_MAIN_EXT_WORDS \
+    EFFECT_MEM_MAX(EFFECT_MEM_MAX(FLANGER_MEM_EXT_WORDS, REVERB_MEM_EXT_WORDS), \
+                   CONV_MEM_EXT_WORDS)
+#define EFFECT_SLOT_PRE_FAST_WORDS   PITCH_MEM_FAST_WORDS
+#define EFFECT_SLOT_PRE_EXT_WORDS    PITCH_MEM_EXT_WORDS
+
+#define EFFECT_ARENA_FAST_WORDS (EFFECT_SLOT_MAIN_FAST_WORDS + EFFECT_SLOT_PRE_FAST_WORDS)
+#define EFFECT_ARENA_EXT_BANKS \
+    (EFFECT_MEM_BANKS(EFFECT_SLOT_MAIN_EXT_WORDS) + EFFECT_MEM_BANKS(EFFECT_SLOT_PRE_EXT_WORDS))
+#define EFFECT_ARENA_EXT_WORDS  (EFFECT_ARENA_EXT_BANKS * EFFECT_MEM_BANK_WORDS)
+
+// Toma o slot para 'owner', liberando tudo que estava alocado nele
+void   effectMemAcquire(Uint8 slot, Uint8 owner);
+// Libera o slot (dono passa a ser EFFECT_OWNER_NONE)
+void   effectMemRelease(Uint8 slot);
+// Dono atual do slot
+Uint8  effectMemOwner(Uint8 slot);
+// 'words' palavras (arredondadas para par) do slot no tier pedido.
+// NULL se o slot não comporta: o header do efeito subestimou o pedido.
+Int16* effectMemAlloc(Uint8 slot, Uint8 tier, Uint16 words);
+
+// -------------------- Parâmetros: main loop -> ISR --------------------
+// O main loop nunca escreve no estado que a ISR está usando. Ele edita a
+// cópia pendente e a publica com um contador de sequência (ímpar durante
+// a escrita); a ISR copia a pendente para a ativa no início do próximo
+// bloco, se o contador for par e tiver mudado. Sem travas nem
+// interrupções desligadas: a ISR nunca espera, no pior caso usa os
+// parâmetros antigos por mais um bloco.
+//
+// Sem DMA de áudio rodando (antes de startAudioDma e no host) a
+// publicação é aplicada na hora, sem transição.
+//
+// Transição: quando o efeito ou o pitch mudam, a ISR roda a configuração
+// antiga e a nova lado a lado por EFFECT_XFADE_FRAMES quadros e passa de
+// uma para a outra com uma rampa Q15; só então a antiga sai. Efeitos que
+// dividem o slot PRINCIPAL (flanger e os reverbs) não rodam juntos: a troca
+// passa por loopback (fade-out, init, fade-in). Uma transição só é feita
+// se o custo das duas configurações juntas couber no orçamento da ISR
+// (EFFECT_COST_*); senão a troca é imediata, como antes.
+//
+// Troca de preset do reverb: reverbStage muda quando o preset novo está
+// montado e a ISR o troca pelo atual (reverbStageSwap), ver reverb.h.
+
+typedef struct {
+    Uint8  effect;              // Efeito principal (EFFECT_*)
+    Uint8  pitchEnabled;        // Estágio de pitch shift
+    Uint8  reverbStage;         // Contador de trocas de preset do reverb
+    Int32  pitchDelayRate;      // Q32, ver setPitchFrequency
+} EffectParams;
+
+#define EFFECT_XFADE_FRAMES  512u      // 2 blocos (~10.7 ms), potência de 2
+#define EFFECT_XFADE_SHIFT   6         // Passo da rampa: 32768 / 512
+
+// Custo estimado em ciclos do C5502 por palavra (amostra de um canal),
+// com -O3 e as esperas da CE0. Mesmo modelo que Host/tools/dma_sim usa.
+#define EFFECT_CPU_HZ          200000000UL    // PLL: 20 MHz x 10 (pll.c)
+#define EFFECT_COST_ISR_BLOCK  400UL          // Entrada/saída da ISR (por bloco)
+#define EFFECT_COST_LOOPBACK   3UL
+#define EFFECT_COST_PITCH      46UL
+// Vocoder de fase, contado por bloco como a convolução:
+//   FFT real e IFFT de 1024 pontos por canal (4 complexas de 512 com
+//   a separação dos espectros, ~58k cada)           ~232k
+//   1022 CORDICs de 14 passos em 32 bits (~236)      ~241k
+//   fase, picos, remapeamento e seno/cosseno (~140 por bin)  ~143k
+//   janelas de análise e síntese e overlap-add       ~45k
+// ~661k, mais a folga de ~25% que a conta da convolução tem sobre
+// EFFECT_COST_CONV_BASE: ~826k / 512 palavras. No host (bench_effects)
+// o vocoder custa 2.35x a convolução, que daria ~1760; a razão para os
+// grãos não serve (lá pesam as esperas da CE0). Com o STAGE ocupa ~86%
+// do bloco: ligar/desligar e a cauda do reverb não cabem no orçamento de
+// transição e são imediatos.
+#define EFFECT_COST_PITCH_VOCODER 1600UL
+// Grãos sincronizados: os mesmos grãos mais a AMDF por bloco (~17k ciclos:
+// decimação de 1024 quadros, 91 atrasos x 32 pontos e refino de 15 x 64)
+#define EFFECT_COST_PITCH_SYNC 80UL
+#define EFFECT_COST_FLANGER    40UL
+#define EFFECT_COST_TREMOLO    11UL
+#define EFFECT_COST_REVERB     184UL          // Pior preset (STAGE)
+#define EFFECT_COST_REVERB_TAIL 224UL         // Pior cauda (PLATE): tanque direto na CE0
+#define EFFECT_COST_REVERB_FDN 64UL           // 8 linhas compartilhadas por L e R
+#define EFFECT_COST_REVERB_PLATE 168UL        // Tanque + 14 taps lidos da CE0
+// Convolução: FFT + IFFT de 512 pontos, normalização e cópias, mais a
+// multiplicação complexa dos bins de cada partição da IR (DMA à frente)
+#define EFFECT_COST_CONV_BASE  270UL
+#define EFFECT_COST_CONV_PART  15UL
+#define EFFECT_COST_CONV_REVERB \
+    (EFFECT_COST_CONV_BASE + EFFECT_COST_CONV_PART * CONV_IR_PARTITIONS)
+#define EFFECT_COST_XFADE      6UL            // Cópia da entrada + rampa
+
+// Fração do período do bloco que uma transição pode ocupar (%)
+#define EFFECT_XFADE_BUDGET_PCT  75UL
+
+// Publicação (main loop): effectParamsBegin abre a escrita (seq ímpar) e
+// devolve a cópia pendente; effectParamsCommit fecha e publica. Entre os
+// dois a ISR continua com a cópia ativa.
+volatile EffectParams* effectParamsBegin(void);
+void  effectParamsCommit(void);
+// Parâmetros ativos (chamado pela ISR no início de cada bloco)
+const EffectParams* effectParamsLatch(void);
+// Transição em curso: parâmetros de origem e quadros já misturados em
+// *pos. NULL se não houver. A ISR avança com effectXfadeAdvance.
+const EffectParams* effectXfadeFrom(Uint16* pos);
+void  effectXfadeAdvance(Uint16 frames);
+// Taxa do pitch shift (aplicada no próximo bloco)
+void  effectParamsSetPitchRate(Int32 delayRate);
+
+// -------------------- Troca de efeito sem bloquear --------------------
+// setEffect, setPitchShiftEnabled, setPitchShiftMode e effectRestart só
+// registram o pedido. effectControllerPoll, chamado a cada volta do main
+// loop, leva a cadeia até ele um passo por vez: espera a ISR assentar, faz
+// o fade-out quando a memória vai ser reaproveitada (ou o efeito refeito),
+// prepara o novo efeito em partes e só o publica para a ISR quando ele
+// está pronto. Nada espera dezenas de ms: cada volta zera no máximo
+// EFFECT_INIT_CHUNK_WORDS palavras.
+//
+// Efeitos com buffers se preparam em duas funções: <efeito>InitBegin toma
+// a memória e monta o estado (rápido) e <efeito>InitStep zera até 'words'
+// palavras por chamada, retornando 1 quando o efeito está pronto.
+//
+// Sem DMA de áudio rodando os pedidos são completados na hora.
+
+#define EFFECT_INIT_CHUNK_WORDS  4096u   // ~100 us de CPU, mesmo na CE0
+
+// Um passo da troca pendente (main loop)
+void  effectControllerPoll(void);
+// 1 enquanto a cadeia ainda não chegou ao último pedido
+Uint8 effectControllerBusy(void);
+// Refaz o init de 'effect' (preset novo, limpeza) se ele estiver em uso
+void  effectRestart(Uint8 effect);
+// Preset novo de 'effect' em uso. O reverb troca mantendo a cauda do
+// preset anterior se houver memória e orçamento; senão (e nos outros
+// efeitos) é um effectRestart.
+void  effectPresetChange(Uint8 effect);
+// Zera até 'words' palavras de buf[*pos..len) e avança *pos.
+// Retorna as palavras zeradas.
+Uint16 effectClearChunk(Int16* buf, Uint16 len, Uint16* pos, Uint16 words);
 
 // Nomes dos efeitos (para display)
 typedef struct {
@@ -22,9 +199,10 @@ typedef struct {
 
 // Sistema de controle
 typedef struct {
-    Uint8 currentEffect;
-    // Flag para ativar o estágio de Pitch Shift (Pré-processamento)
+    Uint8 currentEffect;      // Efeito pedido (a ISR chega nele via poll)
+    // Flag para ativar o estágio de Pitch Shift (Pré-processamento), pedido
     Uint8 pitchShiftActive;
+    Uint8 pitchMode;          // PITCH_MODE_* pedido
     Uint8 effectInitialized[EFFECT_COUNT];
     Uint8 effectActive[EFFECT_COUNT];
     EffectInfo effects[EFFECT_COUNT];
@@ -41,6 +219,10 @@ void setEffect(Uint8 effect);
 // --- Controle do Pitch Shift ---
 void setPitchShiftEnabled(Uint8 enabled);
 Uint8 isPitchShiftEnabled(void);
+// Algoritmo (PITCH_MODE_*). Trocar com o pitch ligado faz fade-out, init
+// no modo novo e fade-in, como desligar e ligar.
+void setPitchShiftMode(Uint8 mode);
+Uint8 getPitchShiftMode(void);
 
 Uint8 getNextEffect(Uint8 current);
 void cleanupEffect(Uint8 effect);
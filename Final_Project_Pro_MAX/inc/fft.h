@@ -0,0 +1,52 @@
+//////////////////////////////////////////////////////////////////////////////
+// fft.h - FFT Q15 in-place, complexa e real (radix-2/4, ponto flutuante
+//         em bloco)
+//
+// Complexa: n complexos intercalados (re, im). Real: n amostras reais,
+// e o espectro sai nas mesmas n palavras como bins 0..n/2-1 (re, im), com
+// Re(X[n/2]) no lugar de Im(X[0]) (os dois são reais); os bins n/2+1..n-1
+// são os conjugados. É o formato do rfft da DSPLIB.
+//
+// Os estágios são radix-4 (mais um radix-2 quando log2(n) é ímpar). Antes
+// de cada estágio a transformada olha o maior módulo do bloco e divide
+// tudo só o necessário para a borboleta não estourar: sinais fracos
+// mantêm a precisão e o total de divisões volta como expoente do bloco.
+// Nenhuma saída passa de 32765 em módulo (nunca -32768).
+//
+//   fftForward       DFT(x)      = saída * 2^expoente
+//   fftInverse       n * IDFT(x) = saída * 2^expoente   (sem o 1/n)
+//   fftRealForward   DFT(x)      = saída * 2^expoente   (meio espectro)
+//   fftRealInverse   n * IDFT(X) = saída * 2^expoente
+//
+// No C5502 um Int16 ocupa uma palavra (16 bits endereçáveis): n complexos
+// são 2n palavras, e um vetor de 2048 complexos (4096 palavras) cabe em
+// qualquer seção. Com FFT_USE_DSPLIB definido no projeto do CCS, as
+// funções chamam cfft/cifft/rfft/rifft/cbrev da DSPLIB do C55x (escala
+// fixa de 1/2 por estágio: expoente = log2(n)); nesse caso o vetor deve
+// estar alinhado em 2n palavras (DATA_ALIGN), como pede o cbrev in-place.
+// No host, e no DSP sem a DSPLIB, vale a implementação em C.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef FFT_H_
+#define FFT_H_
+
+#include "tistdtypes.h"
+
+#define FFT_MIN_POINTS   4
+#define FFT_MAX_POINTS   2048       // Maior n (potência de 2)
+
+// Monta a tabela de senos (uma vez; chamada pelos inits dos efeitos)
+void  fftInit(void);
+
+// Cosseno e seno Q15 de uma fase em voltas (65536 = 2*pi), pela mesma
+// tabela com interpolação linear (erro < 2 LSB). Precisa do fftInit.
+void  fftCosSin(Uint16 phase, Int16* c, Int16* s);
+
+// n potência de 2, FFT_MIN_POINTS <= n <= FFT_MAX_POINTS. Retornam o
+// expoente do bloco.
+Int16 fftForward(Int16* x, Uint16 n);
+Int16 fftInverse(Int16* x, Uint16 n);
+Int16 fftRealForward(Int16* x, Uint16 n);
+Int16 fftRealInverse(Int16* x, Uint16 n);
+
+#endif /* FFT_H_ */
@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////////////////////////////
+// fixed_point.h - Aritmética Q15/Q31 com saturação (comum a todos os efeitos)
+//
+// No DSP cada operação vira um intrínseco do cl55 (uma instrução, sem
+// desvio). No PC são usadas versões em C com o mesmo resultado bit a bit,
+// para que o build de host reproduza a saída da placa.
+//
+//   q15_sat(x)        satura um Int32 para 16 bits
+//   q15_add(a, b)     soma saturada                      (_sadd)
+//   q15_mul(a, b)     (a*b) >> 15, truncado e saturado    (_smpy)
+//   q15_mul_r(a, b)   (a*b) >> 15 com arredondamento      (_smpyr)
+//   q31_mul(a, b)     (a*b) << 1 saturado, Q31            (_lsmpy)
+//   q31_mac(acc,a,b)  acc + (a*b) << 1 saturado, Q31      (_smac)
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef FIXED_POINT_H_
+#define FIXED_POINT_H_
+
+#include "tistdtypes.h"
+
+#define Q15_MAX     32767
+#define Q15_MIN     (-32768)
+#define Q31_MAX     ((Int32)0x7FFFFFFF)
+#define Q31_MIN     ((Int32)(-Q31_MAX - 1))
+
+#ifdef __TMS320C55X__
+
+// O cl55 não tem intrínseco de saturação 32->16; o shift saturado para a
+// parte alta do acumulador faz o mesmo em uma instrução.
+#define q15_sat(x)          ((Int16)(_lsshl((Int32)(x), 16) >> 16))
+#define q15_add(a, b)       ((Int16)_sadd((a), (b)))
+#define q15_mul(a, b)       ((Int16)_smpy((a), (b)))
+#define q15_mul_r(a, b)     ((Int16)_smpyr((a), (b)))
+#define q31_mul(a, b)       ((Int32)_lsmpy((a), (b)))
+#define q31_mac(acc, a, b)  ((Int32)_smac((acc), (a), (b)))
+
+#else /* Build de host: equivalentes em C */
+
+static inline Int16 q15_sat(Int32 x)
+{
+    if (x > Q15_MAX) return Q15_MAX;
+    if (x < Q15_MIN) return Q15_MIN;
+    return (Int16)x;
+}
+
+static inline Int16 q15_add(Int16 a, Int16 b)
+{
+    return q15_sat((Int32)a + (Int32)b);
+}
+
+static inline Int16 q15_mul(Int16 a, Int16 b)
+{
+    // Só -1.0 * -1.0 sai da faixa
+    return q15_sat(((Int32)a * (Int32)b) >> 15);
+}
+
+static inline Int16 q15_mul_r(Int16 a, Int16 b)
+{
+    return q15_sat(((Int32)a * (Int32)b + 0x4000) >> 15);
+}
+
+static inline Int32 q31_sat(int64_t x)
+{
+    if (x > Q31_MAX) return Q31_MAX;
+    if (x < Q31_MIN) return Q31_MIN;
+    return (Int32)x;
+}
+
+static inline Int32 q31_mul(Int16 a, Int16 b)
+{
+    return q31_sat((int64_t)a * (int64_t)b * 2);
+}
+
+static inline Int32 q31_mac(Int32 acc, Int16 a, Int16 b)
+{
+    // Como no MAC fracionário do C55x: o produto satura antes da soma
+    return q31_sat((int64_t)acc + (int64_t)q31_mul(a, b));
+}
+
+#endif /* __TMS320C55X__ */
+
+// Conversão float -> Q15. Apenas para inicialização (float é emulado no DSP).
+static inline Int16 float_to_q15(float x)
+{
+    if (x >= 1.0f)  return Q15_MAX;
+    if (x <= -1.0f) return Q15_MIN;
+    return (Int16)(x * 32768.0f);
+}
+
+#endif /* FIXED_POINT_H_ */
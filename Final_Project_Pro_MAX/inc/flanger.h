@@ -7,23 +7,28 @@
 
 #include "tistdtypes.h"
 
-// Configurações do Buffer
+// Configurações do Buffer (uma linha de atraso por canal)
 #define FLANGER_DELAY_SIZE 512
+#define FLANGER_NUM_CHANNELS 2
 #define LFO_SIZE 256
 
+// Memória pedida à arena de efeitos (palavras): linhas L/R + tabela do LFO
+#define FLANGER_MEM_FAST_WORDS  (FLANGER_NUM_CHANNELS * FLANGER_DELAY_SIZE + LFO_SIZE)
+#define FLANGER_MEM_EXT_WORDS   0
+
 // Parâmetros calculados para 48kHz (Python: 1ms a 5ms, 0.7 Gain)
 // Min: 48 samples, Max: 240 samples.
 #define FLANGER_L0 144              // Média ((240+48)/2)
 #define FLANGER_A 96                // Amplitude ((240-48)/2)
 #define FLANGER_G 22938             // Ganho 0.7 em Q15 (0x599A)
 
-// Incremento de fase para 0.5Hz @ 48kHz
+// Incremento de fase para 0.5Hz @ 48kHz (avança uma vez por quadro L,R)
 // Inc = (0.5 * 2^32) / 48000 = 44739
 #define LFO_INC 44739
 
-// Variáveis globais
-extern Int16 g_flangerBuffer[FLANGER_DELAY_SIZE];
-extern Int16 g_lfoTable[LFO_SIZE];
+// Variáveis globais (apontam para a arena; válidas após initFlanger)
+extern Int16* g_flangerBuffer[FLANGER_NUM_CHANNELS];
+extern Int16* g_lfoTable;
 
 extern volatile Uint16 g_flangerWriteIndex;
 extern volatile Uint32 g_flangerPhaseAcc;
@@ -31,7 +36,11 @@ extern volatile Uint32 g_flangerPhaseInc;
 
 // Funções
 void initFlanger(void);
-void processAudioFlanger(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize);
+// Init em partes (effectControllerPoll): InitBegin toma a memória e zera o
+// oscilador, InitStep limpa as linhas e gera a tabela do LFO aos poucos
+void  flangerInitBegin(void);
+Uint8 flangerInitStep(Uint16 words);
+void processAudioFlanger(Int16* left, Int16* right, Uint16 frames); // Planar, in-place
 void clearFlanger(void);
 
 #endif /* FLANGER_H_ */
@@ -10,6 +10,7 @@
 // DMA ISRs
 interrupt void dmaRxIsr(void);
 interrupt void dmaTxIsr(void);
+interrupt void memDmaIsr(void);     // Cópias de mem_dma.c (canal 2)
 
 // Timer ISR
 interrupt void gpt0Isr(void);
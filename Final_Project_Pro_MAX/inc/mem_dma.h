@@ -0,0 +1,30 @@
+//////////////////////////////////////////////////////////////////////////////
+// mem_dma.h - Cópias memória-memória em segundo plano (DMA canal 2)
+//
+// Fila de cópias servida por um canal de DMA livre: cada cópia começa
+// quando a anterior termina (interrupção de fim de bloco), sem ocupar a
+// CPU. Usada pelo reverb para trazer janelas das linhas de atraso da CE0
+// para a DARAM e devolver o que foi escrito.
+//
+// No build de host as cópias são síncronas (memcpy).
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef MEM_DMA_H_
+#define MEM_DMA_H_
+
+#include "tistdtypes.h"
+
+#define MEM_DMA_QUEUE_LEN   32      // Cópias pendentes (potência de 2)
+
+// Configura o canal e a interrupção (chamado por configAudioDma).
+// Antes disso as cópias são feitas pela CPU.
+void memDmaInit(void);
+
+// Enfileira a cópia de 'words' palavras de 'src' para 'dst'.
+// Se a fila estiver cheia, espera abrir espaço.
+void memDmaCopy(Int16* dst, const Int16* src, Uint16 words);
+
+// Espera todas as cópias pendentes terminarem
+void memDmaWait(void);
+
+#endif /* MEM_DMA_H_ */
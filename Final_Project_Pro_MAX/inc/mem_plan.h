@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////
+// mem_plan.h - Catálogo dos buffers dos efeitos para o planejador de memória
+//
+// Cada buffer grande de efeito tem sua própria seção .efx:* (#pragma
+// DATA_SECTION). Host/tools/mem_plan lê esta tabela, põe
+// na DARAM os buffers mais acessados por palavra (até MEM_PLAN_DARAM_WORDS)
+// e o resto na CE0, e gera effects_mem.cmd, incluído por lnkx.cmd.
+//
+// Ao criar um efeito ou mudar o tamanho de um buffer: atualizar a linha
+// aqui e rodar "cmake --build build --target mem_plan_update". O ctest
+// falha se effects_mem.cmd estiver desatualizado ou se um buffer que
+// precisa da DARAM não couber.
+//
+// Este header é usado só pelo host; o firmware não o inclui.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef MEM_PLAN_H_
+#define MEM_PLAN_H_
+
+#include "dma.h"
+#include "effects_controller.h"
+
+// Palavras da DARAM reservadas aos buffers de efeito. O resto dos 32K
+// fica para código, pilhas, .bss, .const e os buffers de DMA de áudio.
+#define MEM_PLAN_DARAM_WORDS   16384u
+
+// Efeitos que usam o buffer (a carga de uma configuração é a soma)
+#define MEM_EFX_FLANGER        0x01u
+#define MEM_EFX_REVERB         0x02u
+#define MEM_EFX_PITCH          0x04u
+#define MEM_EFX_CONV           0x08u
+
+// Tier exigido
+#define MEM_TIER_ANY           0u     // Decidido pelo planejador
+#define MEM_TIER_DARAM         1u     // Só funciona na DARAM (ex.: alvo de DMA)
+
+// X(nome, seção, palavras, acessos da CPU por quadro, palavras de DMA por
+//   quadro, efeitos, tier)
+//
+// Os buffers dos efeitos moram na arena de effects_controller.c (um array
+// por tier, ver effects_controller.h). Acessos por quadro estéreo no pior
+// caso (reverb + pitch):
+//   arena_fast  janelas dos combs: lê e escreve 1 palavra por comb e canal
+//               (2 x 4 x 2) e o DMA faz o mesmo; all-pass: 2 x 2 x 2;
+//               pitch: por canal, 2 grãos x 2 leituras + 1 escrita (2 x 5).
+//               Flanger (2 x 3 + 1) e convolução (FFTs por bloco) cabem
+//               no mesmo slot do reverb, e o vocoder de fase (FFTs por
+//               bloco) no slot do pitch.
+//   arena       combs longos do reverb pelo DMA (2 x 4 x 2). Pela CPU, no
+//               pior caso: plate atual (all-pass modulados 2 x 3, taps
+//               2 x 7) com a cauda de um Schroeder (combs direto, 2 x 4 x 2).
+//               O FDL da convolução também mora aqui, mas o tráfego dele
+//               (só DMA) está na linha ir, que é só da convolução.
+//   ir          espectros da IR (conv_ir.h), constantes, só pelo DMA: P
+//               partições de 512 palavras por bloco (2P por quadro), mais
+//               o FDL: lê P espectros de 1024 palavras e grava um (4P + 4)
+#define MEM_PLAN_BUFFERS(X) \
+    X(arena_fast, ".efx:arena_fast", EFFECT_ARENA_FAST_WORDS, 34, 16, \
+      MEM_EFX_FLANGER | MEM_EFX_REVERB | MEM_EFX_PITCH | MEM_EFX_CONV, \
+      MEM_TIER_DARAM) \
+    X(arena,      ".efx:arena",      EFFECT_ARENA_EXT_WORDS,  36, 16, \
+      MEM_EFX_REVERB, MEM_TIER_ANY) \
+    X(ir,         ".efx:ir",         CONV_IR_WORDS,            0, \
+      6 * CONV_IR_PARTITIONS + 4, MEM_EFX_CONV, MEM_TIER_ANY)
+
+#endif /* MEM_PLAN_H_ */
@@ -6,22 +6,62 @@
 #define PITCH_SHIFT_H_
 
 #include "tistdtypes.h"
+#include "pitch_vocoder.h"
 
 // Configurações
 #define ROOT_FREQ_HZ    261.63f  // Nota Dó (C4) como raiz
 #define WINDOW_SIZE_MS  30.0f    // Tamanho da janela (ms)
 #define FS_HZ           48000.0f // Taxa de amostragem
+#define PITCH_NUM_CHANNELS 2     // Estéreo: um buffer circular por canal
+
+// Tamanho do Buffer fixo em Potência de 2 para velocidade máxima
+// 4096 garante espaço suficiente para janelas grandes se necessário
+#define PITCH_BUF_SIZE 4096
+#define PITCH_MASK     4095
+
+// Algoritmo (escolhido no init, ver pitchShiftInitBegin)
+#define PITCH_MODE_GRAIN    0    // Dois grãos na linha de atraso (padrão)
+#define PITCH_MODE_VOCODER  1    // Vocoder de fase, ver pitch_vocoder.h
+#define PITCH_MODE_GRAIN_SYNC 2  // Grãos reiniciados em múltiplos do período
+
+// Período (PITCH_MODE_GRAIN_SYNC): uma AMDF por bloco sobre a média L+R
+// dos buffers, primeiro decimada por PITCH_SYNC_DECIM e depois refinada
+// amostra a amostra em volta do melhor atraso. Com o período T detectado,
+// cada grão que reinicia fica a um múltiplo de T do outro grão: os dois
+// leem o mesmo ponto da forma de onda durante o crossfade, sem o filtro
+// pente (batimento) das reinicializações às cegas. Sem período (ruído,
+// silêncio) o grão reinicia como no modo PITCH_MODE_GRAIN.
+#define PITCH_SYNC_DECIM    8
+#define PITCH_SYNC_HIST     128  // Quadros decimados analisados (1024 amostras)
+#define PITCH_SYNC_WINDOW   32   // Janela da AMDF decimada
+#define PITCH_SYNC_MIN_LAG  6    // Em quadros decimados: 48 amostras (1 kHz)
+#define PITCH_SYNC_MAX_LAG  96   // 768 amostras (62.5 Hz)
+#define PITCH_SYNC_FINE_WINDOW 64 // Termos do refino (passo de 2 amostras)
+
+// Memória pedida à arena de efeitos (palavras): o maior dos dois modos.
+// Grãos: um buffer por canal.
+#define PITCH_GRAIN_FAST_WORDS (PITCH_NUM_CHANNELS * PITCH_BUF_SIZE)
+#define PITCH_MEM_FAST_WORDS \
+    (PITCH_GRAIN_FAST_WORDS > PV_MEM_FAST_WORDS ? PITCH_GRAIN_FAST_WORDS : PV_MEM_FAST_WORDS)
+#define PITCH_MEM_EXT_WORDS    0
 
 // Estrutura do Pitch Shifter
 typedef struct {
-    Int16* buffer;        // Buffer circular de áudio
-    Uint16 buffer_len;    // Tamanho total do buffer
-    Uint16 window_size;   // Tamanho da janela em amostras
-    Uint16 write_ptr;     // Ponteiro de escrita
+    Int16* buffer[PITCH_NUM_CHANNELS]; // Buffers circulares de áudio (L, R)
+    Uint16 buffer_len;    // Tamanho de cada buffer
+    Uint16 window_size;   // Tamanho da janela em quadros
+    Uint16 write_ptr;     // Ponteiro de escrita (comum aos canais)
 
     // Variáveis de Controle em Ponto Fixo (Q31/Q32)
     Uint32 phasor;        // Fase atual (0x00000000 a 0xFFFFFFFF representa 0.0 a 1.0)
-    Int32  delay_rate;    // Taxa de variação do delay por amostra (Q32)
+    Int32  delay_rate;    // Taxa de variação do delay por amostra (Q32),
+                          // escrita pela ISR (effectParamsLatch)
+    Uint8  mode;          // PITCH_MODE_* do último init
+
+    // PITCH_MODE_GRAIN_SYNC (sempre zero nos outros modos)
+    Uint32 period;        // Período detectado (Q16 quadros); 0 = sem período
+    Uint32 offset[2];     // Atraso extra de cada grão (Q16 amostras),
+                          // fixado quando o grão reinicia
 
 } PitchShifter;
 
@@ -30,8 +70,13 @@ extern PitchShifter g_pitch;
 
 // Protótipos
 void initPitchShift();
+// Init em partes (effectControllerPoll): InitBegin toma a memória para o
+// modo pedido e zera o estado, InitStep zera até 'words' palavras; 1 =
+// pronto. Não mexem na frequência.
+void  pitchShiftInitBegin(Uint8 mode);
+Uint8 pitchShiftInitStep(Uint16 words);
 Int16 processPitchShiftSample(Int16 input);
-void processAudioPitchShift(Uint16* rxBlock, Uint16* txBlock);
+void processAudioPitchShift(Int16* left, Int16* right, Uint16 frames); // Planar, in-place
 
 // Muda a frequência alvo instantaneamente (chamar no main loop)
 void setPitchFrequency(float target_freq);
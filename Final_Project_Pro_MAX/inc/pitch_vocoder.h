@@ -0,0 +1,63 @@
+//////////////////////////////////////////////////////////////////////////////
+// pitch_vocoder.h - Pitch shift por vocoder de fase (STFT + overlap-add)
+//
+// Modo PITCH_MODE_VOCODER de pitch_shift.h. A cada PV_HOP quadros (um
+// bloco de áudio) e para cada canal:
+//
+//   1. janela de Hann nos últimos PV_FFT_POINTS quadros e FFT real;
+//   2. módulo e fase de cada bin (CORDIC); a diferença de fase para o
+//      quadro anterior dá a frequência exata do bin;
+//   3. o bin k vai para round(k * razão), com a frequência multiplicada
+//      pela razão (bins que caem no mesmo lugar somam os módulos);
+//   4. a fase de síntese de cada bin avança pela frequência nova; IFFT
+//      real, janela de Hann de novo e soma na saída (overlap-add).
+//
+// Sem o chiado nem a modulação dos grãos do modo de linha de atraso em
+// razões grandes (B, Gb), ao custo de duas FFTs de 1024 pontos por canal
+// a cada bloco e de PV_FFT_POINTS quadros de latência. A razão vem de
+// g_pitch.delay_rate, a mesma taxa do modo de grãos (setPitchFrequency).
+//
+// Memória: tudo no slot PRE da arena (DARAM). Por canal: entrada e saída
+// em anel de PV_FFT_POINTS, fase de análise e de síntese por bin. Comuns:
+// o vetor da FFT e meia janela de Hann.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef PITCH_VOCODER_H_
+#define PITCH_VOCODER_H_
+
+#include "tistdtypes.h"
+
+#define PV_FFT_POINTS     1024      // Janela (quadros)
+#define PV_FFT_MASK       (PV_FFT_POINTS - 1)
+#define PV_HOP            256       // = AUDIO_BLOCK_FRAMES: 75% de sobreposição
+#define PV_BINS           (PV_FFT_POINTS / 2)
+#define PV_NUM_CHANNELS   2
+
+// Memória pedida à arena de efeitos (palavras, cada pedido arredondado
+// para par): anéis e fases por canal, FFT e meia janela (0..N/2)
+#define PV_HANN_WORDS     ((PV_BINS + 2) & ~1)
+#define PV_MEM_FAST_WORDS \
+    (PV_NUM_CHANNELS * (2 * PV_FFT_POINTS + 2 * PV_BINS) + PV_FFT_POINTS + PV_HANN_WORDS)
+#define PV_MEM_EXT_WORDS  0
+
+typedef struct {
+    Int16*  in[PV_NUM_CHANNELS];        // Últimos PV_FFT_POINTS quadros
+    Int16*  ola[PV_NUM_CHANNELS];       // Soma das janelas de saída
+    Uint16* phase[PV_NUM_CHANNELS];     // Fase de análise por bin (voltas)
+    Uint16* synth[PV_NUM_CHANNELS];     // Fase de síntese por bin (voltas)
+    Int16*  work;                       // FFT, bins remapeados e IFFT
+    Int16*  hann;                       // Hann periódica Q15, índices 0..N/2
+    Uint16  base;                       // Início do hop atual nos anéis
+    Uint16  pos;                        // Quadros já no hop atual
+} PitchVocoder;
+
+extern PitchVocoder g_pitchVocoder;
+
+// Init em partes, chamado por pitchShiftInitBegin/Step com o slot PRE já
+// tomado: InitBegin aloca e monta a janela, InitStep zera até 'words'
+// palavras; 1 = pronto
+void  pitchVocoderInitBegin(void);
+Uint8 pitchVocoderInitStep(Uint16 words);
+void  processAudioPitchVocoder(Int16* left, Int16* right, Uint16 frames); // Planar, in-place
+
+#endif /* PITCH_VOCODER_H_ */
@@ -11,16 +11,101 @@
 #define REVERB_NUM_COMBS       4
 #define REVERB_NUM_ALLPASSES   2
 
-// TAMANHO TOTAL DA MEMRIA DO REVERB
-// Hall requer aprox 13.000 words para Stereo.
-// Alocamos 16.000 words (32KB) para ter margem, cabendo na DARAM (64KB).
-#define REVERB_MEM_SIZE        32000u
+// Motores: Schroeder (4 combs + 2 all-pass por canal, ncleos L e R
+// independentes), FDN (uma rede de REVERB_FDN_LINES linhas para os dois
+// canais, misturadas por uma matriz de Householder: s somas e um shift)
+// ou plate (Dattorro: difusores de entrada e um tanque em oito para os
+// dois canais, com sadas em vrios pontos do tanque)
+#define REVERB_ENGINE_SCHROEDER 0
+#define REVERB_ENGINE_FDN       1
+#define REVERB_ENGINE_PLATE     2
+
+#define REVERB_FDN_LINES       8
+#define REVERB_FDN_MIX_SHIFT   2          // Householder: 2/N = 1/4
+
+// Sinais das entradas e sadas estreo de cada linha da FDN (funes de
+// Walsh ortogonais entre si e ao vetor de uns da matriz). Entrada da
+// linha i: (SIGN_L(i) * L + SIGN_R(i) * R) / 2; sadas idem, / 4.
+#define REVERB_FDN_SIGN_L(i)   (((i) & 1u) ? -1 : 1)
+#define REVERB_FDN_SIGN_R(i)   (((i) & 2u) ? -1 : 1)
+
+// Plate: 4 all-pass em srie na entrada mono, e cada metade do tanque 
+// all-pass modulado -> atraso 1 (damping, decay) -> all-pass -> atraso 2
+// (decay) -> entrada da outra metade
+#define REVERB_PLATE_DIFFUSERS   4
+#define REVERB_PLATE_MOD         0        // Linhas de uma metade do tanque
+#define REVERB_PLATE_DELAY1      1
+#define REVERB_PLATE_AP          2
+#define REVERB_PLATE_DELAY2      3
+#define REVERB_PLATE_TANK_LINES  4
+#define REVERB_PLATE_TAPS        7
+
+// Tap j da sada ch (0 = L): linha REVERB_PLATE_TAP_LINE(j) da metade
+// REVERB_PLATE_TAP_HALF(ch, j), com sinal REVERB_PLATE_TAP_SIGN(j)
+#define REVERB_PLATE_TAP_HALF(ch, j)  ((j) < 4 ? (ch) ^ 1 : (ch))
+#define REVERB_PLATE_TAP_LINE(j)      ((j) == 2 || (j) == 5 ? REVERB_PLATE_AP : \
+                                       (j) == 3 || (j) == 6 ? REVERB_PLATE_DELAY2 : \
+                                                              REVERB_PLATE_DELAY1)
+#define REVERB_PLATE_TAP_SIGN(j)      ((j) < 2 || (j) == 3 ? 1 : -1)
+
+// TAMANHO TOTAL DA MEMRIA DO REVERB (CE0)
+// Em bancos: no modelo de memria large do C55x um objeto no passa de 64K
+// palavras nem cruza pgina, ento cada linha fica inteira num banco.
+// ROOM 2 (combs de 200..500 ms)  o maior preset: ~134.500 palavras em 5
+// bancos. O sexto banco deixa um preset de 1 banco tocar junto com ele
+// durante a troca de preset (ver "Troca de preset" abaixo).
+#define REVERB_MEM_BANK_WORDS  32768u
+#define REVERB_MEM_BANKS       6u
+#define REVERB_MEM_SIZE        (REVERB_MEM_BANKS * 32768UL)
+
+// Pool na DARAM para os all-pass e combs curtos (sem janela de DMA).
+// Dois pools: o preset atual usa um e o prximo  montado no outro.
+#define REVERB_FAST_MEM_SIZE   2048u
+#define REVERB_FAST_POOLS      2u
+
+// Janelas ping-pong dos combs longos: [canal][comb][janela][REVERB_WINDOW_LEN]
+#define REVERB_WINDOW_LEN      256u       // == AUDIO_BLOCK_FRAMES
+#define REVERB_WINDOW_WORDS    (2u * REVERB_NUM_COMBS * 2u * REVERB_WINDOW_LEN)
+
+// Memria pedida  arena de efeitos (palavras)
+#define REVERB_MEM_FAST_WORDS  (REVERB_FAST_POOLS * REVERB_FAST_MEM_SIZE + REVERB_WINDOW_WORDS)
+#define REVERB_MEM_EXT_WORDS   REVERB_MEM_SIZE
 
 // Spread de 23 amostras (~0.5ms) para o canal direito
 #define REVERB_SPREAD          23u
 
 // -------------------- Estruturas --------------------
 
+// Linha de atraso de um preset, j em amostras/Q15 e com posio fixa
+// (tabela gerada em reverb_presets.h a partir de reverb_preset_cfg.h)
+typedef struct {
+    Uint16 delay_samples;
+    Int16  gain_Q15;
+    Uint8  ext;             // 1: banco 'bank' da CE0; 0: pool da DARAM
+    Uint8  bank;
+    Uint16 offset;          // Incio no banco ou no pool da DARAM
+} ReverbLineLayout;
+
+typedef struct {
+    Uint8  engine;          // REVERB_ENGINE_*
+    ReverbLineLayout comb[2][REVERB_NUM_COMBS];         // [canal L/R]
+    ReverbLineLayout allpass[2][REVERB_NUM_ALLPASSES];
+    ReverbLineLayout fdn[REVERB_FDN_LINES];             // S na FDN
+    Uint8  fdn_damp_shift[REVERB_FDN_LINES];            // Damping por linha
+    ReverbLineLayout plate_diffuser[REVERB_PLATE_DIFFUSERS];        // S no plate
+    ReverbLineLayout plate_tank[2][REVERB_PLATE_TANK_LINES];        // [metade]
+    Uint16 plate_tap[2][REVERB_PLATE_TAPS];             // [sada] quadros atrs
+    Uint8  plate_mod_depth;     // Excurso do all-pass modulado (amostras)
+    Uint8  plate_damp_shift;    // Damping depois do atraso 1
+    Uint32 plate_mod_inc;       // Passo do LFO (Q32 por quadro)
+    Int16  wet_gain_Q15;
+    Int16  dry_gain_Q15;
+    Uint8  comb_damp_shift;
+    Uint8  extBanks;        // Bancos da CE0 usados
+    Uint32 extWords;        // Palavras usadas na CE0 (soma das linhas)
+    Uint16 fastWords;       // Palavras usadas no pool da DARAM
+} ReverbPresetLayout;
+
 // Comb Filter com damping simples (barato) para reduzir ringing/metlico
 typedef struct {
     Int16* buffer;          // Ponteiro para o incio do buffer deste filtro
@@ -32,6 +117,13 @@ typedef struct {
     // damp_state = damp_state + (x - damp_state) >> damp_shift
     Int16  damp_state;
     Uint8  damp_shift;      // 0 = sem damping; 2..6 recomendado
+
+    // Janelas na DARAM (ping-pong) trazidas da CE0 por DMA.
+    // window[0] == NULL: buffer acessado diretamente (j est na DARAM).
+    Int16* window[2];
+    Uint8  winCur;          // Janela com buffer[ptr..ptr+REVERB_CHUNK)
+    Uint8  windowed;        // Linha longa na CE0: usa janelas quando o
+                            // preset  o atual (a cauda l direto)
 } CombFilter;
 
 typedef struct {
@@ -41,6 +133,30 @@ typedef struct {
     Uint16 ptr;
 } AllPassFilter;
 
+// All-pass com atraso modulado por um LFO triangular (tanque do plate):
+// l entre delay_samples - depth e delay_samples + depth, com
+// interpolao linear. Sempre acessado direto (sem janela).
+typedef struct {
+    Int16* buffer;          // len = delay_samples + depth + 1 palavras
+    Uint16 len;
+    Uint16 delay_samples;   // Atraso central
+    Uint16 depth;
+    Int16  gain_Q15;
+    Uint16 ptr;             // Prxima escrita
+    Uint32 phase;           // LFO (Q32)
+    Uint32 phase_inc;
+} ModAllPassFilter;
+
+// Metade do tanque do plate. Os atrasos e o all-pass fixo so linhas como
+// as dos combs (janelas de DMA, damping); gain_Q15  o decay nos atrasos
+// e o coeficiente no all-pass.
+typedef struct {
+    ModAllPassFilter mod;
+    CombFilter       delay1;
+    CombFilter       allpass;
+    CombFilter       delay2;
+} PlateTank;
+
 // Ncleo de processamento de UM canal
 typedef struct {
     CombFilter    comb[REVERB_NUM_COMBS];
@@ -49,22 +165,45 @@ typedef struct {
 
 // Estrutura Principal Stereo
 typedef struct {
+    Uint8         engine;         // REVERB_ENGINE_*
+
+    // Schroeder
     ReverbCore    left;           // Canal Esquerdo
     ReverbCore    right;          // Canal Direito
 
+    // FDN: as linhas so combs (atraso, decaimento em gain_Q15, damping
+    // e janelas de DMA) cuja realimentao passa pela matriz
+    CombFilter    fdn[REVERB_FDN_LINES];
+
+    // Plate
+    AllPassFilter plateDiffuser[REVERB_PLATE_DIFFUSERS];
+    PlateTank     plate[2];
+    Uint16        plateTap[2][REVERB_PLATE_TAPS];
+
     // Mix
     Int16         wet_gain_Q15;
     Int16         dry_gain_Q15;
 
-    // Gerenciamento de memria simples
-    Uint16        memAllocated;
+    // Memria do preset
+    Uint32        memAllocated;       // Palavras na CE0
+    Uint16        fastAllocated;      // Palavras no pool da DARAM
+    Uint8         banks;              // Bancos da CE0 (bit por banco)
+    Uint8         pool;               // Pool da DARAM (0 ou 1)
+    Uint8         preset;             // REVERB_PRESET_* montado
 } Reverb;
 
 // Presets
 #define REVERB_PRESET_HALL      0
 #define REVERB_PRESET_ROOM_2    1
 #define REVERB_PRESET_STAGE     2
-#define REVERB_PRESET_COUNT     3
+#define REVERB_PRESET_FDN_HALL  3
+#define REVERB_PRESET_FDN_ROOM  4
+#define REVERB_PRESET_PLATE     5
+#define REVERB_PRESET_COUNT     6
+
+// Os presets Schroeder vm primeiro, depois os da FDN e os do plate
+#define REVERB_PRESET_FDN_FIRST   REVERB_PRESET_FDN_HALL
+#define REVERB_PRESET_PLATE_FIRST REVERB_PRESET_PLATE
 
 typedef Uint8 ReverbPreset;
 
@@ -73,9 +212,43 @@ extern ReverbPreset g_reverbPreset;
 
 // Funes
 void initReverb(void);
-void processAudioReverb(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize);
+// Init em partes (effectControllerPoll): InitBegin toma a memria e copia
+// o preset, InitStep zera at 'words' palavras das linhas; 1 = pronto
+void  reverbInitBegin(void);
+Uint8 reverbInitStep(Uint16 words);
+void processAudioReverb(Int16* left, Int16* right, Uint16 frames); // Planar, in-place
 void clearReverb(void);
 void setReverbPreset(ReverbPreset preset);
 ReverbPreset getReverbPreset(void);
 
+// -------------------- Troca de preset --------------------
+// Com o reverb tocando, o preset novo  montado nos bancos e no pool que
+// o atual no usa (effectControllerPoll, em partes) e a ISR troca os dois
+// num incio de bloco: o novo recebe a entrada e as janelas de DMA; o
+// antigo vira a cauda, com entrada zero e os combs lidos direto da CE0,
+// somada  sada at ficar abaixo de REVERB_TAIL_FLOOR por uma volta
+// inteira da linha mais longa. S ento a memria dele volta a ficar livre.
+// O dry dos dois presets difere: ele vai de um ao outro numa rampa de
+// EFFECT_XFADE_FRAMES quadros.
+//
+// Sem bancos livres para o preset novo (ou com uma cauda ainda tocando e
+// outra troca pedida) o controlador corta a cauda com uma rampa ou cai no
+// reincio normal (fade-out, init, fade-in).
+
+#define REVERB_TAIL_FLOOR      16         // Pico da cauda (Q15, ~-66 dBFS)
+
+// g_reverbPreset  outro que o atual (h o que montar)?
+Uint8 reverbStageNeeded(void);
+// O preset g_reverbPreset cabe ao lado do atual (e no h cauda)?
+Uint8 reverbStageFits(void);
+// Monta g_reverbPreset na memria livre; Step zera at 'words' palavras
+void  reverbStageBegin(void);
+Uint8 reverbStageStep(Uint16 words);
+// ISR (via effectParamsLatch): o preset montado passa a ser o atual
+void  reverbStageSwap(void);
+// Cauda do preset anterior ainda tocando
+Uint8 reverbTailBusy(void);
+// Pede o fim da cauda com uma rampa de EFFECT_XFADE_FRAMES quadros
+void  reverbTailCut(void);
+
 #endif /* REVERB_H_ */
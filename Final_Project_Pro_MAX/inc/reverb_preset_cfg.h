@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////////////
+// reverb_preset_cfg.h - Presets do reverb em unidades físicas (ms, ganho)
+//
+// Fonte dos presets: editar aqui e rodar
+//   cmake --build build --target reverb_presets_update
+// Host/tools/reverb_presets converte esta tabela em reverb_presets.h
+// (atrasos em amostras, ganhos Q15 e posição de cada linha na memória).
+// O firmware só inclui o header gerado: nada de float na troca de preset.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef REVERB_PRESET_CFG_H_
+#define REVERB_PRESET_CFG_H_
+
+#include "reverb.h"
+
+// --- Estrutura de Presets ---
+typedef struct {
+    float comb_ms[REVERB_NUM_COMBS];
+    float ap_ms[REVERB_NUM_ALLPASSES];
+
+    float comb_gains[REVERB_NUM_COMBS];
+    float ap_gains[REVERB_NUM_ALLPASSES];
+
+    float wet_gain;
+    float dry_gain;
+
+    // Damping (lowpass por shift) para os combs:
+    // 0 = sem damping. 2..6 recomendado.
+    Uint8 comb_damp_shift;
+} ReverbPresetCfg;
+
+// -------------------- Presets --------------------
+// ROOM 2 foi ajustado para:
+// - delays menores (mais "room", menos "hall")
+// - feedback menor (decay mais controlado)
+// - damping (menos metálico)
+// - wet menor e dry um pouco reduzido (mix melhor)
+static const ReverbPresetCfg REVERB_PRESET_CFG[REVERB_PRESET_FDN_FIRST] = {
+
+   // REV-HALL (ajustado para ficar mais parecido com o 01.wav)
+    {
+   // comb_ms (pequenos ajustes para quebrar ressonâncias / ficar mais natural)
+       { 24.90f, 29.35f, 41.70f, 34.10f },
+
+   // all-pass (mantém difusão, mas com menos “brilho de anel”)
+       { 2.20f, 6.40f },
+
+   // comb_gains (reduz RT/cauda e evita “sustento demais”)
+       { 0.70f, 0.78f, 0.73f, 0.75f },
+
+   // ap_gains (um pouco menor para reduzir ringing)
+       { 0.60f, 0.58f },
+
+   // wet_gain (mais próximo do seu áudio: presente, mas sem afogar)
+       0.38f,
+       1.00f,  // dry_gain (para manter ataque igual ao seu)
+       0      // comb_damp_shift = 0 (DESLIGADO -> mantém o timbre)
+     },
+
+     // ROOM 2:
+     {
+         { 200.0f, 300.0f, 400.0f, 500.0f },  // comb_ms
+         { 7.06f, 6.46f },                    // all-pass_ms
+         { 0.50f, 0.48f, 0.56f, 0.44f },      // comb_gains
+         { 0.716f, 0.613f },                  // ap_gains
+         0.2f,                                 // wet_gain
+         0.80f,                                // dry_gain
+         4                                     // comb_damp_shift
+     },
+
+    // REV-STAGE
+     {
+        { 46.27f, 39.96f, 28.03f, 51.85f },
+        { 3.50f, 1.20f },
+        { 0.758f, 0.854f, 0.796f, 0.825f },
+        { 0.70f,  0.70f },
+        0.50f,
+        1.00f,
+        4
+    }
+};
+
+// -------------------- Presets da FDN --------------------
+// Uma rede para os dois canais. O ganho de cada linha sai do tempo de
+// decaimento: g = 10^(-3 * atraso / (t60 * fs)), a mesma queda por segundo
+// em todas as linhas. Linhas com no mínimo 2 janelas de DMA (~10.7 ms),
+// atrasos sem fator comum para espalhar os ecos.
+typedef struct {
+    float line_ms[REVERB_FDN_LINES];
+    float t60_ms;
+
+    float wet_gain;
+    float dry_gain;
+
+    // Damping por linha (como comb_damp_shift): linhas mais longas
+    // perdem mais agudos por volta
+    Uint8 damp_shift[REVERB_FDN_LINES];
+} ReverbFdnCfg;
+
+#define REVERB_FDN_PRESETS  (REVERB_PRESET_PLATE_FIRST - REVERB_PRESET_FDN_FIRST)
+
+static const ReverbFdnCfg REVERB_FDN_CFG[REVERB_FDN_PRESETS] = {
+    // FDN HALL
+    {
+        { 31.7f, 37.3f, 41.9f, 47.1f, 53.3f, 59.9f, 67.3f, 73.1f },
+        2400.0f,                                // t60_ms
+        0.35f,                                  // wet_gain
+        1.00f,                                  // dry_gain
+        { 1, 1, 1, 1, 2, 2, 2, 2 }              // damp_shift
+    },
+
+    // FDN ROOM
+    {
+        { 11.3f, 13.7f, 16.1f, 18.9f, 21.7f, 24.1f, 27.3f, 31.1f },
+        900.0f,
+        0.30f,
+        1.00f,
+        { 2, 2, 2, 2, 2, 2, 3, 3 }
+    }
+};
+
+// -------------------- Presets do plate --------------------
+// Topologia de Dattorro ("Effect Design, Part 1", 1997): os tempos são os
+// do artigo (amostras a 29761 Hz) em ms. Os taps contam a partir da
+// escrita mais recente e precisam ficar a no mínimo uma janela de DMA
+// do fim da linha (o gerador confere).
+typedef struct {
+    float diffuser_ms[REVERB_PLATE_DIFFUSERS];
+    float input_diffusion[2];       // Dois primeiros, dois últimos all-pass
+
+    float tank_ms[2][REVERB_PLATE_TANK_LINES];   // [metade][REVERB_PLATE_*]
+    float decay_diffusion[2];       // All-pass modulado, all-pass fixo
+    float decay;                    // Ganho na saída de cada atraso
+    float mod_depth_ms;             // Excursão do all-pass modulado
+    float mod_hz;
+
+    float tap_ms[2][REVERB_PLATE_TAPS];          // [saída L/R]
+
+    float wet_gain;
+    float dry_gain;
+    Uint8 damp_shift;               // Damping depois do atraso 1
+} ReverbPlateCfg;
+
+#define REVERB_PLATE_PRESETS  (REVERB_PRESET_COUNT - REVERB_PRESET_PLATE_FIRST)
+
+static const ReverbPlateCfg REVERB_PLATE_CFG[REVERB_PLATE_PRESETS] = {
+    // PLATE
+    {
+        { 4.771f, 3.595f, 12.735f, 9.307f },    // difusores de entrada
+        { 0.750f, 0.625f },
+        {
+            { 22.579f, 149.625f, 60.482f, 124.996f },   // metade L
+            { 30.510f, 141.695f, 89.244f, 106.280f }    // metade R
+        },
+        { -0.70f, 0.50f },                      // decay_diffusion
+        0.50f,                                  // decay
+        0.538f,                                 // mod_depth_ms
+        1.0f,                                   // mod_hz
+        {
+            {  8.938f, 99.930f, 64.279f, 67.068f, 66.866f, 6.283f, 35.819f },
+            { 11.861f, 121.871f, 41.262f, 89.815f, 70.932f, 11.256f, 4.066f }
+        },
+        0.60f,                                  // wet_gain
+        1.00f,                                  // dry_gain
+        1                                       // damp_shift
+    }
+};
+
+#endif /* REVERB_PRESET_CFG_H_ */
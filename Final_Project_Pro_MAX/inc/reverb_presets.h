@@ -0,0 +1,356 @@
+/* reverb_presets.h - GERADO por Host/tools/reverb_presets: não editar.
+ * Fonte: reverb_preset_cfg.h; regravar com
+ *   cmake --build build --target reverb_presets_update
+ * Linha: { atraso, ganho Q15, ext (CE0), banco, offset } */
+
+#ifndef REVERB_PRESETS_H_
+#define REVERB_PRESETS_H_
+
+#include "reverb.h"
+
+#define REVERB_HALL_EXT_BANKS   1
+#define REVERB_HALL_FAST_WORDS  824
+#if REVERB_HALL_EXT_BANKS > REVERB_MEM_BANKS || REVERB_HALL_FAST_WORDS > REVERB_FAST_MEM_SIZE
+#error "Preset HALL não cabe em REVERB_MEM_SIZE/REVERB_FAST_MEM_SIZE"
+#endif
+
+#define REVERB_ROOM_2_EXT_BANKS   5
+#define REVERB_ROOM_2_FAST_WORDS  1296
+#if REVERB_ROOM_2_EXT_BANKS > REVERB_MEM_BANKS || REVERB_ROOM_2_FAST_WORDS > REVERB_FAST_MEM_SIZE
+#error "Preset ROOM_2 não cabe em REVERB_MEM_SIZE/REVERB_FAST_MEM_SIZE"
+#endif
+
+#define REVERB_STAGE_EXT_BANKS   1
+#define REVERB_STAGE_FAST_WORDS  450
+#if REVERB_STAGE_EXT_BANKS > REVERB_MEM_BANKS || REVERB_STAGE_FAST_WORDS > REVERB_FAST_MEM_SIZE
+#error "Preset STAGE não cabe em REVERB_MEM_SIZE/REVERB_FAST_MEM_SIZE"
+#endif
+
+#define REVERB_FDN_HALL_EXT_BANKS   1
+#define REVERB_FDN_HALL_FAST_WORDS  0
+#if REVERB_FDN_HALL_EXT_BANKS > REVERB_MEM_BANKS || REVERB_FDN_HALL_FAST_WORDS > REVERB_FAST_MEM_SIZE
+#error "Preset FDN_HALL não cabe em REVERB_MEM_SIZE/REVERB_FAST_MEM_SIZE"
+#endif
+
+#define REVERB_FDN_ROOM_EXT_BANKS   1
+#define REVERB_FDN_ROOM_FAST_WORDS  0
+#if REVERB_FDN_ROOM_EXT_BANKS > REVERB_MEM_BANKS || REVERB_FDN_ROOM_FAST_WORDS > REVERB_FAST_MEM_SIZE
+#error "Preset FDN_ROOM não cabe em REVERB_MEM_SIZE/REVERB_FAST_MEM_SIZE"
+#endif
+
+#define REVERB_PLATE_EXT_BANKS   2
+#define REVERB_PLATE_FAST_WORDS  1458
+#if REVERB_PLATE_EXT_BANKS > REVERB_MEM_BANKS || REVERB_PLATE_FAST_WORDS > REVERB_FAST_MEM_SIZE
+#error "Preset PLATE não cabe em REVERB_MEM_SIZE/REVERB_FAST_MEM_SIZE"
+#endif
+
+static const ReverbPresetLayout REVERB_PRESETS[REVERB_PRESET_COUNT] = {
+    // HALL
+    {
+        0,              // engine
+        {
+            { {  1195,  22937, 1, 0, 11377 },
+              {  1408,  25559, 1, 0,  8751 },
+              {  2001,  23920, 1, 0,  2024 },
+              {  1636,  24576, 1, 0,  5684 } },
+            { {  1218,  22937, 1, 0, 10159 },
+              {  1431,  25559, 1, 0,  7320 },
+              {  2024,  23920, 1, 0,     0 },
+              {  1659,  24576, 1, 0,  4025 } }
+        },
+        {
+            { {   105,  19660, 0, 0,     0 },
+              {   307,  19005, 0, 0,   105 } },
+            { {   105,  19660, 0, 0,   412 },
+              {   307,  19005, 0, 0,   517 } }
+        },
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },    // fdn_damp_shift
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        {
+            { 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0 }
+        },              // plate_tap
+        0, 0, 0UL,      // plate: excursão, damping, passo do LFO
+        12451, 32767,     // wet, dry (Q15)
+        0, 1,           // comb_damp_shift, bancos da CE0
+        12572UL, 824      // palavras na CE0, na DARAM
+    },
+    // ROOM_2
+    {
+        0,              // engine
+        {
+            { {  9600,  16384, 1, 3, 19200 },
+              { 14400,  15728, 1, 4, 14423 },
+              { 19200,  18350, 1, 3,     0 },
+              { 24000,  14417, 1, 1,     0 } },
+            { {  9623,  16384, 1, 2, 19223 },
+              { 14423,  15728, 1, 4,     0 },
+              { 19223,  18350, 1, 2,     0 },
+              { 24023,  14417, 1, 0,     0 } }
+        },
+        {
+            { {   338,  23461, 0, 0,     0 },
+              {   310,  20086, 0, 0,   338 } },
+            { {   338,  23461, 0, 0,   648 },
+              {   310,  20086, 0, 0,   986 } }
+        },
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },    // fdn_damp_shift
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        {
+            { 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0 }
+        },              // plate_tap
+        0, 0, 0UL,      // plate: excursão, damping, passo do LFO
+        6553, 26214,     // wet, dry (Q15)
+        4, 5,           // comb_damp_shift, bancos da CE0
+        134492UL, 1296      // palavras na CE0, na DARAM
+    },
+    // STAGE
+    {
+        0,              // engine
+        {
+            { {  2220,  24838, 1, 0,  7242 },
+              {  1918,  27983, 1, 0, 11403 },
+              {  1345,  26083, 1, 0, 14689 },
+              {  2488,  27033, 1, 0,  2511 } },
+            { {  2243,  24838, 1, 0,  4999 },
+              {  1941,  27983, 1, 0,  9462 },
+              {  1368,  26083, 1, 0, 13321 },
+              {  2511,  27033, 1, 0,     0 } }
+        },
+        {
+            { {   168,  22937, 0, 0,     0 },
+              {    57,  22937, 0, 0,   168 } },
+            { {   168,  22937, 0, 0,   225 },
+              {    57,  22937, 0, 0,   393 } }
+        },
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },    // fdn_damp_shift
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        {
+            { 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0 }
+        },              // plate_tap
+        0, 0, 0UL,      // plate: excursão, damping, passo do LFO
+        16384, 32767,     // wet, dry (Q15)
+        4, 1,           // comb_damp_shift, bancos da CE0
+        16034UL, 450      // palavras na CE0, na DARAM
+    },
+    // FDN_HALL
+    {
+        1,              // engine
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        { {  1521,  29911, 1, 0, 18232 },
+          {  1790,  29433, 1, 0, 16442 },
+          {  2011,  29045, 1, 0, 14431 },
+          {  2260,  28615, 1, 0, 12171 },
+          {  2558,  28108, 1, 0,  9613 },
+          {  2875,  27579, 1, 0,  6738 },
+          {  3230,  26998, 1, 0,  3508 },
+          {  3508,  26551, 1, 0,     0 } },
+        { 1, 1, 1, 1, 2, 2, 2, 2 },    // fdn_damp_shift
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        {
+            { 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0 }
+        },              // plate_tap
+        0, 0, 0UL,      // plate: excursão, damping, passo do LFO
+        11468, 32767,     // wet, dry (Q15)
+        0, 1,           // comb_damp_shift, bancos da CE0
+        19753UL, 0      // palavras na CE0, na DARAM
+    },
+    // FDN_ROOM
+    {
+        1,              // engine
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        { {   542,  30047, 1, 0,  7335 },
+          {   657,  29500, 1, 0,  6678 },
+          {   772,  28962, 1, 0,  5906 },
+          {   907,  28344, 1, 0,  4999 },
+          {  1041,  27743, 1, 0,  3958 },
+          {  1156,  27237, 1, 0,  2802 },
+          {  1310,  26575, 1, 0,  1492 },
+          {  1492,  25813, 1, 0,     0 } },
+        { 2, 2, 2, 2, 2, 2, 3, 3 },    // fdn_damp_shift
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        {
+            { 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0 }
+        },              // plate_tap
+        0, 0, 0UL,      // plate: excursão, damping, passo do LFO
+        9830, 32767,     // wet, dry (Q15)
+        0, 1,           // comb_damp_shift, bancos da CE0
+        7877UL, 0      // palavras na CE0, na DARAM
+    },
+    // PLATE
+    {
+        2,              // engine
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        {
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } },
+            { {     0,      0, 0, 0,     0 },
+              {     0,      0, 0, 0,     0 } }
+        },
+        { {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 },
+          {     0,      0, 0, 0,     0 } },
+        { 0, 0, 0, 0, 0, 0, 0, 0 },    // fdn_damp_shift
+        { {   229,  24576, 0, 0,     0 },
+          {   172,  24576, 0, 0,   229 },
+          {   611,  20480, 0, 0,   401 },
+          {   446,  20480, 0, 0,  1012 } },
+        {
+            { {  1109, -22937, 1, 1,  1490 },
+              {  7182,  16384, 1, 0,     0 },
+              {  2903,  16384, 1, 0, 29366 },
+              {  5999,  16384, 1, 0, 13983 } },
+            { {  1490, -22937, 1, 1,     0 },
+              {  6801,  16384, 1, 0,  7182 },
+              {  4283,  16384, 1, 0, 25083 },
+              {  5101,  16384, 1, 0, 19982 } }
+        },
+        {
+            { 429, 4796, 3085, 3219, 3209, 301, 1719 },
+            { 569, 5849, 1980, 4311, 3404, 540, 195 }
+        },              // plate_tap
+        25, 1, 89478UL,      // plate: excursão, damping, passo do LFO
+        19660, 32767,     // wet, dry (Q15)
+        0, 2,           // comb_damp_shift, bancos da CE0
+        34868UL, 1458      // palavras na CE0, na DARAM
+    }
+};
+
+#endif /* REVERB_PRESETS_H_ */
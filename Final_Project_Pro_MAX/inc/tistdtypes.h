@@ -34,6 +34,8 @@
 #ifndef _TI_STD_TYPES
 #define _TI_STD_TYPES
 
+#ifdef __TMS320C55X__
+
 #ifndef TRUE
 
 typedef int		Bool;
@@ -57,8 +59,57 @@ typedef long		Int32;
 typedef short		Int16;
 typedef char		Int8;
 
+#else /* Build de host (PC): reproduz as larguras do C55x */
+
+/*
+    No C55x char, short e int tem 16 bits e long tem 32. No PC (LP64) long
+    tem 64 bits e char 8, o que muda o wrap dos acumuladores de fase e o
+    tamanho das structs. Os tipos abaixo fixam as larguras do DSP.
+ */
+#include <stdint.h>
+
+#ifndef TRUE
+
+typedef int16_t		Bool;
+#define TRUE		((Bool) 1)
+#define FALSE		((Bool) 0)
+
+#endif
+
+typedef int16_t         Int;    /* int do C55x: 16 bits */
+typedef uint16_t        Uns;    /* deprecated type */
+typedef char            Char;
+typedef char *          String;
+typedef void *          Ptr;
+
+typedef uint32_t	Uint32;
+typedef uint16_t	Uint16;
+typedef uint16_t	Uint8;  /* char do C55x: 16 bits */
+
+typedef int32_t		Int32;
+typedef int16_t		Int16;
+typedef int16_t		Int8;   /* char do C55x: 16 bits */
+
+#endif /* __TMS320C55X__ */
+
 #endif /* _TI_STD_TYPES */
 
+/*
+    Aritmetica de "int" do C55x (16 bits).
+
+    No DSP a + b / a - b entre Int16 ja acontecem em 16 bits e dao a volta;
+    no PC a promocao para int de 32 bits guarda o resultado inteiro. Quando
+    esse wrap faz parte do kernel, use as macros abaixo: no cl55 elas viram a
+    mesma instrucao de 16 bits, no host truncam exatamente como a placa.
+    A conta e feita em unsigned para nao depender de overflow com sinal.
+ */
+#define C55_ADD16(a, b)     ((Int16)((Uint16)(a) + (Uint16)(b)))
+#define C55_SUB16(a, b)     ((Int16)((Uint16)(a) - (Uint16)(b)))
+
+/* Shift de "int": no C55x o resultado fica em 16 bits (x << 16 == 0) */
+#define C55_SHL16(x, n)     ((Int16)((Uint16)(x) << (n)))
+#define C55_SHR16(x, n)     ((Int16)((Int16)(x) >> (n)))
+
 
 #endif /* _TISTDTYPES_H_ */
 
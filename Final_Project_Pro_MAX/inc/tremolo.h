@@ -23,6 +23,6 @@ extern Tremolo g_tremolo;
 
 // Funções do Tremolo
 void initTremolo(void);
-void processAudioTremolo(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize);
+void processAudioTremolo(Int16* left, Int16* right, Uint16 frames); // Planar, in-place
 
 #endif /* TREMOLO_H_ */
\ No newline at end of file
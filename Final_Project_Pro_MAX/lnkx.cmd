@@ -43,8 +43,9 @@ SECTIONS
    /* Buffer DMA principal */
    dmaMem    >  DARAM align(32) fill = 00h
    
-   /* Memória para buffers de efeitos (compartilhada) */
-   effectsMem > CE0
-
    .ioport   >  IOPORT PAGE 2 /* Global & static ioport vars */
 }
+
+/* Buffers de efeito (.efx:*): DARAM ou CE0 conforme o plano gerado por
+   Host/tools/mem_plan a partir de inc/mem_plan.h */
+effects_mem.cmd
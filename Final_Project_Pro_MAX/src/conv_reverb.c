@@ -0,0 +1,242 @@
+//////////////////////////////////////////////////////////////////////////////
+// conv_reverb.c - Convolução particionada por overlap-save (ver conv_reverb.h)
+//////////////////////////////////////////////////////////////////////////////
+
+#include "conv_reverb.h"
+#include "fft.h"
+#include "fixed_point.h"
+#include "effects_controller.h"
+#include "mem_dma.h"
+#include "dma.h"
+
+#define CONV_IR_TABLE
+#include "conv_ir.h"
+
+#if CONV_PART_FRAMES != AUDIO_BLOCK_FRAMES
+#error "CONV_PART_FRAMES deve ser o bloco de áudio (uma partição por bloco)"
+#endif
+#if CONV_FFT_POINTS > FFT_MAX_POINTS || (1 << CONV_FFT_LOG2) != CONV_FFT_POINTS
+#error "CONV_FFT_POINTS não corresponde a CONV_FFT_LOG2 ou passa de FFT_MAX_POINTS"
+#endif
+
+ConvReverb g_convReverb;
+
+// Init em partes: etapas 0..1 zeram os blocos de entrada, etapa 2 a saída
+#define INIT_STAGE_OUT    2
+#define INIT_STAGE_DONE   3
+
+static Uint16 s_initStage = INIT_STAGE_DONE;
+static Uint16 s_initPos = 0;
+
+void convReverbInitBegin(void)
+{
+    ConvReverb* c = &g_convReverb;
+    Uint16 p;
+
+    // Memória: slot principal; o acumulador Int32 vem primeiro (alinhado)
+    effectMemAcquire(EFFECT_SLOT_MAIN, EFFECT_CONV_REVERB);
+    c->acc       = (Int32*)effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, 2 * CONV_SPECTRUM_WORDS);
+    c->work      = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, CONV_SPECTRUM_WORDS);
+    c->in[0]     = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, CONV_BLOCK_WORDS);
+    c->in[1]     = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, CONV_BLOCK_WORDS);
+    c->out       = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, CONV_BLOCK_WORDS);
+    c->xStage[0] = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, CONV_SPECTRUM_WORDS);
+    c->xStage[1] = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, CONV_SPECTRUM_WORDS);
+    c->hStage[0] = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, CONV_IR_PART_WORDS);
+    c->hStage[1] = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, CONV_IR_PART_WORDS);
+    for (p = 0; p < CONV_IR_PARTITIONS; p++) {
+        c->fdl[p]    = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_EXT, CONV_SPECTRUM_WORDS);
+        c->fdlExp[p] = 0;
+    }
+
+    fftInit();
+    c->head = 0;
+    c->filled = 0;
+    c->cur = 0;
+    c->pos = 0;
+
+    s_initStage = 0;
+    s_initPos = 0;
+}
+
+Uint8 convReverbInitStep(Uint16 words)
+{
+    ConvReverb* c = &g_convReverb;
+
+    while (words > 0 && s_initStage < INIT_STAGE_DONE) {
+        Int16* buf = s_initStage < INIT_STAGE_OUT ? c->in[s_initStage] : c->out;
+
+        words -= effectClearChunk(buf, CONV_BLOCK_WORDS, &s_initPos, words);
+        if (s_initPos >= CONV_BLOCK_WORDS) {
+            s_initStage++;
+            s_initPos = 0;
+        }
+    }
+    return s_initStage >= INIT_STAGE_DONE;
+}
+
+void initConvReverb(void)
+{
+    convReverbInitBegin();
+    while (!convReverbInitStep(0xFFFF)) {
+    }
+}
+
+const Int16* convReverbIrPartition(Uint16 p)
+{
+    return &s_convIr[(Uint32)p * CONV_IR_PART_WORDS];
+}
+
+// Slot do FDL com o espectro de p blocos atrás
+static inline Uint16 fdlSlot(const ConvReverb* c, Uint16 p)
+{
+    Uint16 s = c->head + p;
+
+    return s >= CONV_IR_PARTITIONS ? s - CONV_IR_PARTITIONS : s;
+}
+
+// Pede ao DMA a partição p da IR e, a partir da segunda, o espectro do FDL
+static void fetchPartition(const ConvReverb* c, Uint16 p)
+{
+    memDmaCopy(c->hStage[p & 1], convReverbIrPartition(p), CONV_IR_PART_WORDS);
+    if (p > 0) memDmaCopy(c->xStage[p & 1], c->fdl[fdlSlot(c, p)], CONV_SPECTRUM_WORDS);
+}
+
+// acc += (X * H) >> shift. H só tem a metade de baixo: o bin N-k usa o
+// conjugado do bin k. A soma de dois produtos fica abaixo de 2^31 (a FFT
+// entrega módulos até 32765) e a soma de CONV_IR_PARTITIONS delas, com
+// shift >= CONV_IR_GUARD, não estoura.
+static void accumulate(Int32* acc, const Int16* x, const Int16* h, Int16 shift)
+{
+    Uint16 k, j;
+    Int16 hr, hi;
+
+    acc[0] += ((Int32)x[0] * h[0]) >> shift;
+    acc[1] += ((Int32)x[1] * h[0]) >> shift;
+    acc[CONV_FFT_POINTS]     += ((Int32)x[CONV_FFT_POINTS]     * h[1]) >> shift;
+    acc[CONV_FFT_POINTS + 1] += ((Int32)x[CONV_FFT_POINTS + 1] * h[1]) >> shift;
+
+    for (k = 2, j = CONV_SPECTRUM_WORDS - 2; k < CONV_FFT_POINTS; k += 2, j -= 2) {
+        hr = h[k];
+        hi = h[k + 1];
+        acc[k]     += ((Int32)x[k] * hr - (Int32)x[k + 1] * hi) >> shift;
+        acc[k + 1] += ((Int32)x[k] * hi + (Int32)x[k + 1] * hr) >> shift;
+        acc[j]     += ((Int32)x[j] * hr + (Int32)x[j + 1] * hi) >> shift;
+        acc[j + 1] += ((Int32)x[j + 1] * hr - (Int32)x[j] * hi) >> shift;
+    }
+}
+
+// Bits do maior módulo (OU dos módulos) do acumulador
+static Int16 accBits(const Int32* acc)
+{
+    Uint32 bits = 0;
+    Int16 n = 0;
+    Uint16 i;
+
+    for (i = 0; i < CONV_SPECTRUM_WORDS; i++) {
+        bits |= (Uint32)(acc[i] < 0 ? -acc[i] : acc[i]);
+    }
+    while (bits) {
+        bits >>= 1;
+        n++;
+    }
+    return n;
+}
+
+// Um bloco completo em in[cur]: calcula a saída do próximo
+static void convBlock(ConvReverb* c)
+{
+    const Int16* prev = c->in[c->cur ^ 1];
+    const Int16* cur  = c->in[c->cur];
+    Int16* w = c->work;
+    Int16 exponent, ref, norm, shift;
+    Int32 round;
+    Uint16 i, p;
+
+    // 1. Espectro de [anterior, atual]
+    for (i = 0; i < CONV_BLOCK_WORDS; i++) {
+        w[i] = prev[i];
+        w[CONV_BLOCK_WORDS + i] = cur[i];
+    }
+    exponent = fftForward(w, CONV_FFT_POINTS);
+
+    // 2. Entra no FDL: o slot mais antigo é reaproveitado
+    c->head = c->head ? c->head - 1 : CONV_IR_PARTITIONS - 1;
+    c->fdlExp[c->head] = exponent;
+    if (CONV_IR_PARTITIONS > 1) memDmaCopy(c->fdl[c->head], w, CONV_SPECTRUM_WORDS);
+    if (c->filled < CONV_IR_PARTITIONS) c->filled++;
+
+    // 3. Soma no expoente do maior bloco do FDL
+    ref = exponent;
+    for (p = 1; p < c->filled; p++) {
+        if (c->fdlExp[fdlSlot(c, p)] > ref) ref = c->fdlExp[fdlSlot(c, p)];
+    }
+    for (i = 0; i < CONV_SPECTRUM_WORDS; i++) c->acc[i] = 0;
+
+    fetchPartition(c, 0);
+    for (p = 0; p < c->filled; p++) {
+        memDmaWait();           // Partição p chegou (e o FDL foi gravado)
+        if (p + 1 < c->filled) fetchPartition(c, p + 1);
+
+        shift = ref - c->fdlExp[fdlSlot(c, p)] + CONV_IR_GUARD;
+        if (shift > 30) continue;           // Bloco fraco: abaixo do LSB
+        accumulate(c->acc, p ? c->xStage[p & 1] : w, c->hStage[p & 1], shift);
+    }
+
+    // 4. Volta para 16 bits e IFFT: saída = w * 2^shift. O módulo fica
+    // abaixo de 2^15, mas o arredondamento pode chegar a 32768: satura.
+    norm = accBits(c->acc);
+    if (norm > 0) {
+        norm -= 15;
+        round = norm > 0 ? (1L << (norm - 1)) : 0;
+        for (i = 0; i < CONV_SPECTRUM_WORDS; i++) {
+            w[i] = norm > 0 ? q15_sat((c->acc[i] + round) >> norm)
+                            : (Int16)(c->acc[i] * (1L << -norm));
+        }
+        shift = fftInverse(w, CONV_FFT_POINTS) + norm + ref + CONV_IR_GUARD +
+                CONV_IR_EXP - CONV_FFT_LOG2;
+    } else {
+        // Soma nula (silêncio)
+        for (i = 0; i < CONV_SPECTRUM_WORDS; i++) w[i] = 0;
+        shift = 0;
+    }
+
+    // 5. Segunda metade da IFFT: saída válida do overlap-save
+    if (shift >= 0) {
+        for (i = 0; i < CONV_BLOCK_WORDS; i++) {
+            c->out[i] = q15_sat((Int32)w[CONV_BLOCK_WORDS + i] * (1L << (shift > 16 ? 16 : shift)));
+        }
+    } else {
+        shift = -shift;
+        if (shift > 16) shift = 16;
+        round = 1L << (shift - 1);
+        for (i = 0; i < CONV_BLOCK_WORDS; i++) {
+            c->out[i] = q15_sat(((Int32)w[CONV_BLOCK_WORDS + i] + round) >> shift);
+        }
+    }
+}
+
+// Blocos planares, processados in-place. A entrada enche in[cur] e a saída
+// sai de out, calculada no bloco anterior: um bloco de atraso.
+void processAudioConvReverb(Int16* left, Int16* right, Uint16 frames)
+{
+    ConvReverb* c = &g_convReverb;
+    Uint16 i, pos = c->pos;
+    Int16* cur = c->in[c->cur];
+    Int16* out = c->out;
+
+    for (i = 0; i < frames; i++) {
+        cur[2 * pos]     = left[i];
+        cur[2 * pos + 1] = right[i];
+        left[i]  = out[2 * pos];
+        right[i] = out[2 * pos + 1];
+
+        if (++pos == CONV_PART_FRAMES) {
+            convBlock(c);
+            c->cur ^= 1;
+            cur = c->in[c->cur];
+            pos = 0;
+        }
+    }
+    c->pos = pos;
+}
@@ -13,7 +13,9 @@
 #include "flanger.h"
 #include "tremolo.h"
 #include "reverb.h"
+#include "conv_reverb.h"
 #include "pitch_shift.h" // Necessário para processAudioPitchShift
+#include "mem_dma.h"
 
 // =================== VARIÁVEIS GLOBAIS ===================
 
@@ -23,6 +25,9 @@ static DMA_Handle hDmaTx;
 // Flag ping-pong: 0 = PING (primeira metade), 1 = PONG (segunda metade)
 volatile Uint16 dmaPingPongFlag = 0;
 
+// ISR de Rx ativa: o main loop só publica parâmetros (ver effects_controller.h)
+volatile Uint16 audioDmaRunning = 0;
+
 // Buffers de entrada (mic) e saída (fone)
 #pragma DATA_SECTION(RxBuffer, "dmaMem")
 #pragma DATA_ALIGN(RxBuffer, 4096)
@@ -32,6 +37,21 @@ Uint16 RxBuffer[AUDIO_BUFFER_SIZE];
 #pragma DATA_ALIGN(TxBuffer, 4096)
 Uint16 TxBuffer[AUDIO_BUFFER_SIZE];
 
+// Bloco de trabalho planar (L e R contíguos) usado por todos os efeitos.
+// Fica na DARAM (.bss) para os kernels rodarem com passo unitário.
+#pragma DATA_ALIGN(blockLeft, 4)
+static Int16 blockLeft[AUDIO_BLOCK_FRAMES];
+
+#pragma DATA_ALIGN(blockRight, 4)
+static Int16 blockRight[AUDIO_BLOCK_FRAMES];
+
+// Saída da configuração antiga durante uma transição (effects_controller.h)
+#pragma DATA_ALIGN(xfadeLeft, 4)
+static Int16 xfadeLeft[AUDIO_BLOCK_FRAMES];
+
+#pragma DATA_ALIGN(xfadeRight, 4)
+static Int16 xfadeRight[AUDIO_BLOCK_FRAMES];
+
 // =================== CONFIGURAÇÃO DMA TX ===================
 
 static DMA_Config dmaTxConfig = {
@@ -170,12 +190,16 @@ void configAudioDma(void)
     IRQ_enable(rxEventId);
     IRQ_enable(txEventId);
 
+    // Canal 2: cópias CE0 <-> DARAM do reverb em segundo plano
+    memDmaInit();
+
     dmaPingPongFlag = 0;
 }
 
 void startAudioDma(void)
 {
     dmaPingPongFlag = 0;
+    audioDmaRunning = 1;
     DMA_start(hDmaRx);
     DMA_start(hDmaTx);
 }
@@ -184,54 +208,123 @@ void stopAudioDma(void)
 {
     DMA_stop(hDmaRx);
     DMA_stop(hDmaTx);
+    audioDmaRunning = 0;
 }
 
 // =================== PROCESSAMENTO DE EFEITOS ===================
 
-static void processAudioBlock(Uint16* rxBlock, Uint16* txBlock, Uint16 size)
+// Efeito principal sobre um bloco planar, in-place
+static void runMainEffect(Uint8 effect, Int16* left, Int16* right, Uint16 frames)
 {
-    Uint8 effect = getCurrentEffect();
-    Uint16* stageInput = rxBlock;
-    int i;
-    
-    // --- ESTÁGIO 1: Pitch Shift (Se ativo) ---
-    // O Pitch Shift processa Rx -> Tx.
-    // Se ativado, o áudio transformado já estará em 'txBlock'.
-    if (isPitchShiftEnabled()) {
-        processAudioPitchShift(rxBlock, txBlock);
-        stageInput = txBlock; // Próximo efeito lê do Tx (in-place)
-    }
-
-    // --- ESTÁGIO 2: Efeito Principal ---
     switch (effect) {
-        case EFFECT_LOOPBACK:
-            // Se Pitch Shift estiver OFF, precisamos copiar Rx->Tx.
-            // Se Pitch Shift estiver ON, 'txBlock' já está pronto, não faz nada.
-            if (!isPitchShiftEnabled()) {
-                for (i = 0; i < size; i++) txBlock[i] = rxBlock[i];
-            }
-            break;
-            
         case EFFECT_FLANGER:
-            processAudioFlanger(stageInput, txBlock, size);
+            processAudioFlanger(left, right, frames);
             break;
             
         case EFFECT_TREMOLO:
-            processAudioTremolo(stageInput, txBlock, size);
+            processAudioTremolo(left, right, frames);
             break;
             
         case EFFECT_REVERB:
-            processAudioReverb(stageInput, txBlock, size);
+            processAudioReverb(left, right, frames);
+            break;
+
+        case EFFECT_CONV_REVERB:
+            processAudioConvReverb(left, right, frames);
             break;
             
         default:
-            if (!isPitchShiftEnabled()) {
-                for (i = 0; i < size; i++) txBlock[i] = rxBlock[i];
-            }
+            // Loopback: o bloco já está pronto
             break;
     }
 }
 
+// Transição: to[i] = from[i] + (to[i] - from[i]) * g, com g subindo de
+// 0 a ~1.0 (Q15) ao longo de EFFECT_XFADE_FRAMES quadros a partir de 'pos'
+static void crossfadeBlock(Int16* to, const Int16* from, Uint16 frames, Uint16 pos)
+{
+    Uint16 i;
+
+    for (i = 0; i < frames; i++) {
+        Int32 g = (Int32)(pos + i) << EFFECT_XFADE_SHIFT;
+        Int32 d = (Int32)to[i] - from[i];
+
+        to[i] = (Int16)(from[i] + ((d * g) >> 15));
+    }
+}
+
+void processAudioBlock(Uint16* rxBlock, Uint16* txBlock, Uint16 size)
+{
+    // Parâmetros publicados pelo main loop valem a partir deste bloco
+    const EffectParams* params = effectParamsLatch();
+    Uint16 xfadePos = 0;
+    const EffectParams* from = effectXfadeFrom(&xfadePos);
+    Uint8 effect = params->effect;
+    Uint8 pitchOn = params->pitchEnabled;
+    Uint16 frames = size / AUDIO_NUM_CHANNELS;
+    int i;
+
+    if (frames > AUDIO_BLOCK_FRAMES) frames = AUDIO_BLOCK_FRAMES;
+
+    // Loopback puro: cópia direta Rx -> Tx, sem passar pelo formato planar
+    if (!from && !pitchOn && (effect == EFFECT_LOOPBACK || effect >= EFFECT_COUNT)) {
+        for (i = 0; i < size; i++) txBlock[i] = rxBlock[i];
+        return;
+    }
+
+    // --- De-intercala: L,R,L,R... -> blockLeft / blockRight ---
+    for (i = 0; i < frames; i++) {
+        blockLeft[i]  = (Int16)rxBlock[2 * i];
+        blockRight[i] = (Int16)rxBlock[2 * i + 1];
+    }
+
+    // --- ESTÁGIO 1: Pitch Shift (Se ativo, in-place) ---
+    if (from && from->pitchEnabled != pitchOn) {
+        // Liga/desliga em rampa: o pitch roda e mistura com o sinal seco
+        for (i = 0; i < frames; i++) {
+            xfadeLeft[i]  = blockLeft[i];
+            xfadeRight[i] = blockRight[i];
+        }
+        processAudioPitchShift(blockLeft, blockRight, frames);
+        if (pitchOn) {
+            crossfadeBlock(blockLeft,  xfadeLeft,  frames, xfadePos);
+            crossfadeBlock(blockRight, xfadeRight, frames, xfadePos);
+        } else {
+            crossfadeBlock(xfadeLeft,  blockLeft,  frames, xfadePos);
+            crossfadeBlock(xfadeRight, blockRight, frames, xfadePos);
+            for (i = 0; i < frames; i++) {
+                blockLeft[i]  = xfadeLeft[i];
+                blockRight[i] = xfadeRight[i];
+            }
+        }
+    } else if (pitchOn) {
+        processAudioPitchShift(blockLeft, blockRight, frames);
+    }
+
+    // --- ESTÁGIO 2: Efeito Principal (in-place) ---
+    if (from && from->effect != effect) {
+        // O antigo processa uma cópia da entrada e sai em rampa
+        for (i = 0; i < frames; i++) {
+            xfadeLeft[i]  = blockLeft[i];
+            xfadeRight[i] = blockRight[i];
+        }
+        runMainEffect(from->effect, xfadeLeft, xfadeRight, frames);
+        runMainEffect(effect, blockLeft, blockRight, frames);
+        crossfadeBlock(blockLeft,  xfadeLeft,  frames, xfadePos);
+        crossfadeBlock(blockRight, xfadeRight, frames, xfadePos);
+    } else {
+        runMainEffect(effect, blockLeft, blockRight, frames);
+    }
+
+    if (from) effectXfadeAdvance(frames);
+
+    // --- Re-intercala no TxBuffer ---
+    for (i = 0; i < frames; i++) {
+        txBlock[2 * i]     = (Uint16)blockLeft[i];
+        txBlock[2 * i + 1] = (Uint16)blockRight[i];
+    }
+}
+
 // =================== ISRs DE DMA ===================
 
 // ISR do DMA de recepção: escolhe PING/PONG e aplica efeitos
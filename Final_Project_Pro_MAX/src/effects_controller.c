@@ -6,13 +6,566 @@
 #include "flanger.h"
 #include "tremolo.h"
 #include "reverb.h"
+#include "conv_reverb.h"
 #include <string.h>
 #include "pitch_shift.h"
+#include "mem_dma.h"
+#include "dma.h"
 
 // Controlador global
 EffectController g_effectController;
 volatile Uint8 currentEffect = EFFECT_LOOPBACK;
 
+// -------------------- Arena --------------------
+// Um array por tier (a CE0 em bancos); cada slot ocupa uma faixa fixa.
+// Alocação em pilha dentro do slot: effectMemAcquire zera o topo.
+
+#pragma DATA_SECTION(g_effectArenaFast, ".efx:arena_fast")
+#pragma DATA_ALIGN(g_effectArenaFast, 4)
+static Int16 g_effectArenaFast[EFFECT_ARENA_FAST_WORDS];
+
+// Bancos da CE0: objetos separados de EFFECT_MEM_BANK_WORDS palavras
+#if EFFECT_ARENA_EXT_BANKS > 6
+#error "Arena da CE0 com mais de 6 bancos: declarar os bancos extras"
+#endif
+
+#pragma DATA_SECTION(g_effectArenaExt0, ".efx:arena")
+static Int16 g_effectArenaExt0[EFFECT_MEM_BANK_WORDS];
+#if EFFECT_ARENA_EXT_BANKS > 1
+#pragma DATA_SECTION(g_effectArenaExt1, ".efx:arena")
+static Int16 g_effectArenaExt1[EFFECT_MEM_BANK_WORDS];
+#endif
+#if EFFECT_ARENA_EXT_BANKS > 2
+#pragma DATA_SECTION(g_effectArenaExt2, ".efx:arena")
+static Int16 g_effectArenaExt2[EFFECT_MEM_BANK_WORDS];
+#endif
+#if EFFECT_ARENA_EXT_BANKS > 3
+#pragma DATA_SECTION(g_effectArenaExt3, ".efx:arena")
+static Int16 g_effectArenaExt3[EFFECT_MEM_BANK_WORDS];
+#endif
+#if EFFECT_ARENA_EXT_BANKS > 4
+#pragma DATA_SECTION(g_effectArenaExt4, ".efx:arena")
+static Int16 g_effectArenaExt4[EFFECT_MEM_BANK_WORDS];
+#endif
+#if EFFECT_ARENA_EXT_BANKS > 5
+#pragma DATA_SECTION(g_effectArenaExt5, ".efx:arena")
+static Int16 g_effectArenaExt5[EFFECT_MEM_BANK_WORDS];
+#endif
+
+static Int16* const s_extBanks[EFFECT_ARENA_EXT_BANKS] = {
+    g_effectArenaExt0,
+#if EFFECT_ARENA_EXT_BANKS > 1
+    g_effectArenaExt1,
+#endif
+#if EFFECT_ARENA_EXT_BANKS > 2
+    g_effectArenaExt2,
+#endif
+#if EFFECT_ARENA_EXT_BANKS > 3
+    g_effectArenaExt3,
+#endif
+#if EFFECT_ARENA_EXT_BANKS > 4
+    g_effectArenaExt4,
+#endif
+#if EFFECT_ARENA_EXT_BANKS > 5
+    g_effectArenaExt5,
+#endif
+};
+
+typedef struct {
+    Uint32 base[EFFECT_MEM_TIERS];      // Início do slot no tier (palavras)
+    Uint32 size[EFFECT_MEM_TIERS];
+    Uint32 used[EFFECT_MEM_TIERS];
+    Uint8  owner;
+} EffectMemSlot;
+
+#define SLOT_MAIN_EXT_SPAN  (EFFECT_MEM_BANKS(EFFECT_SLOT_MAIN_EXT_WORDS) * EFFECT_MEM_BANK_WORDS)
+
+static EffectMemSlot s_slots[EFFECT_SLOT_COUNT] = {
+    { { 0, 0 },
+      { EFFECT_SLOT_MAIN_FAST_WORDS, EFFECT_SLOT_MAIN_EXT_WORDS },
+      { 0, 0 }, EFFECT_OWNER_NONE },
+    { { EFFECT_SLOT_MAIN_FAST_WORDS, SLOT_MAIN_EXT_SPAN },
+      { EFFECT_SLOT_PRE_FAST_WORDS, EFFECT_SLOT_PRE_EXT_WORDS },
+      { 0, 0 }, EFFECT_OWNER_NONE }
+};
+
+void effectMemAcquire(Uint8 slot, Uint8 owner)
+{
+    if (slot >= EFFECT_SLOT_COUNT) return;
+
+    // Nenhuma cópia de DMA pendente (janelas do reverb) pode escrever na
+    // memória que vai ser reaproveitada
+    memDmaWait();
+
+    s_slots[slot].used[EFFECT_MEM_FAST] = 0;
+    s_slots[slot].used[EFFECT_MEM_EXT]  = 0;
+    s_slots[slot].owner = owner;
+}
+
+void effectMemRelease(Uint8 slot)
+{
+    effectMemAcquire(slot, EFFECT_OWNER_NONE);
+}
+
+Uint8 effectMemOwner(Uint8 slot)
+{
+    if (slot >= EFFECT_SLOT_COUNT) return EFFECT_OWNER_NONE;
+    return s_slots[slot].owner;
+}
+
+Int16* effectMemAlloc(Uint8 slot, Uint8 tier, Uint16 words)
+{
+    EffectMemSlot* m;
+    Uint32 at, bankEnd;
+    Int16* ptr;
+
+    if (slot >= EFFECT_SLOT_COUNT || tier >= EFFECT_MEM_TIERS) return (Int16*)0;
+    m = &s_slots[slot];
+
+    // Par: mantém os buffers alinhados para acessos de 32 bits e DMA
+    words = (words + 1) & ~1u;
+    at = m->base[tier] + m->used[tier];
+
+    if (tier == EFFECT_MEM_FAST) {
+        ptr = &g_effectArenaFast[at];
+    } else {
+        // Não cabe no resto do banco: começa no próximo
+        bankEnd = (at / EFFECT_MEM_BANK_WORDS + 1) * EFFECT_MEM_BANK_WORDS;
+        if (at + words > bankEnd) at = bankEnd;
+        ptr = &s_extBanks[at / EFFECT_MEM_BANK_WORDS][at % EFFECT_MEM_BANK_WORDS];
+    }
+
+    if (at + words > m->base[tier] + m->size[tier]) return (Int16*)0;
+
+    m->used[tier] = at + words - m->base[tier];
+    return ptr;
+}
+
+// -------------------- Parâmetros --------------------
+// Escritos só pelo main loop (pendentes) e lidos só pela ISR (ativos)
+
+static volatile EffectParams s_paramsPending;
+static EffectParams          s_paramsActive;
+static volatile Uint16       s_paramsSeq = 0;       // Ímpar: escrita em curso
+static volatile Uint16       s_paramsLatched = 0;   // Último seq aplicado
+
+// Transição: configuração de origem e quadros já misturados
+static EffectParams    s_xfadeFrom;
+static volatile Uint16 s_xfadePos = EFFECT_XFADE_FRAMES;   // == fim: nenhuma
+
+#define XFADE_BUDGET_CYCLES \
+    ((EFFECT_CPU_HZ / AUDIO_SAMPLE_RATE) * AUDIO_BLOCK_FRAMES * EFFECT_XFADE_BUDGET_PCT / 100UL)
+
+#if (EFFECT_XFADE_FRAMES << EFFECT_XFADE_SHIFT) != 32768UL
+#error "EFFECT_XFADE_SHIFT não corresponde a EFFECT_XFADE_FRAMES"
+#endif
+
+static Uint32 effectCost(Uint8 effect)
+{
+    switch (effect) {
+        case EFFECT_FLANGER: return EFFECT_COST_FLANGER;
+        case EFFECT_TREMOLO: return EFFECT_COST_TREMOLO;
+        case EFFECT_REVERB:  return EFFECT_COST_REVERB;
+        case EFFECT_CONV_REVERB: return EFFECT_COST_CONV_REVERB;
+        default:             return EFFECT_COST_LOOPBACK;
+    }
+}
+
+// Custo do pitch shift no modo montado (a troca de modo passa por
+// desligado: nunca há dois modos na ISR)
+static Uint32 pitchCost(void)
+{
+    switch (g_pitch.mode) {
+        case PITCH_MODE_VOCODER:    return EFFECT_COST_PITCH_VOCODER;
+        case PITCH_MODE_GRAIN_SYNC: return EFFECT_COST_PITCH_SYNC;
+        default:                    return EFFECT_COST_PITCH;
+    }
+}
+
+// As duas configurações lado a lado cabem no orçamento da ISR?
+static int xfadeFits(const EffectParams* from, const EffectParams* to)
+{
+    Uint32 perWord = EFFECT_COST_XFADE + effectCost(from->effect);
+
+    if (to->effect != from->effect) perWord += effectCost(to->effect);
+    if (from->pitchEnabled || to->pitchEnabled) perWord += pitchCost();
+
+    return EFFECT_COST_ISR_BLOCK + perWord * AUDIO_BLOCK_SIZE <= XFADE_BUDGET_CYCLES;
+}
+
+// Reverb com a cauda do preset anterior, no pior caso (pitch em transição)
+static int tailFits(void)
+{
+    Uint32 perWord = EFFECT_COST_XFADE + EFFECT_COST_REVERB +
+                     EFFECT_COST_REVERB_TAIL + pitchCost();
+
+    return EFFECT_COST_ISR_BLOCK + perWord * AUDIO_BLOCK_SIZE <= XFADE_BUDGET_CYCLES;
+}
+
+// Copia a pendente para a ativa; 'fade' liga a transição se a cadeia mudou
+static void paramsAdopt(Uint16 seq, int fade)
+{
+    EffectParams prev = s_paramsActive;
+
+    s_paramsActive  = s_paramsPending;
+    s_paramsLatched = seq;
+
+    g_pitch.delay_rate = s_paramsActive.pitchDelayRate;
+    currentEffect = s_paramsActive.effect;
+
+    // Preset novo do reverb montado: passa a ser o atual
+    if (prev.reverbStage != s_paramsActive.reverbStage) reverbStageSwap();
+
+    if (prev.effect == s_paramsActive.effect &&
+        prev.pitchEnabled == s_paramsActive.pitchEnabled) {
+        return;
+    }
+    if (fade && xfadeFits(&prev, &s_paramsActive)) {
+        s_xfadeFrom = prev;
+        s_xfadePos  = 0;
+    } else {
+        s_xfadePos  = EFFECT_XFADE_FRAMES;
+    }
+}
+
+volatile EffectParams* effectParamsBegin(void)
+{
+    s_paramsSeq++;
+    return &s_paramsPending;
+}
+
+void effectParamsCommit(void)
+{
+    s_paramsSeq++;
+
+    // Sem ISR de áudio ninguém mais lê os parâmetros: aplica já
+    if (!audioDmaRunning) paramsAdopt(s_paramsSeq, 0);
+}
+
+const EffectParams* effectParamsLatch(void)
+{
+    Uint16 seq = s_paramsSeq;
+
+    // O main loop não interrompe a ISR: basta não pegar uma escrita pela
+    // metade (seq ímpar), a cópia não muda depois de conferida
+    if (seq == s_paramsLatched || (seq & 1u)) return &s_paramsActive;
+
+    // Durante uma transição só entram mudanças que não mexem na cadeia
+    // (ex.: frequência do pitch); o resto espera ela acabar
+    if (s_xfadePos < EFFECT_XFADE_FRAMES &&
+        (s_paramsPending.effect != s_paramsActive.effect ||
+         s_paramsPending.pitchEnabled != s_paramsActive.pitchEnabled)) {
+        return &s_paramsActive;
+    }
+
+    paramsAdopt(seq, 1);
+    return &s_paramsActive;
+}
+
+const EffectParams* effectXfadeFrom(Uint16* pos)
+{
+    if (s_xfadePos >= EFFECT_XFADE_FRAMES) return (const EffectParams*)0;
+    *pos = s_xfadePos;
+    return &s_xfadeFrom;
+}
+
+void effectXfadeAdvance(Uint16 frames)
+{
+    Uint16 pos = s_xfadePos + frames;
+
+    s_xfadePos = pos > EFFECT_XFADE_FRAMES ? EFFECT_XFADE_FRAMES : pos;
+}
+
+void effectParamsSetPitchRate(Int32 delayRate)
+{
+    effectParamsBegin()->pitchDelayRate = delayRate;
+    effectParamsCommit();
+}
+
+Uint16 effectClearChunk(Int16* buf, Uint16 len, Uint16* pos, Uint16 words)
+{
+    Uint16 i = *pos;
+    Uint16 end;
+
+    if (i >= len) return 0;
+    end = (len - i > words) ? i + words : len;
+
+    for (; i < end; i++) buf[i] = 0;
+
+    words = end - *pos;
+    *pos = end;
+    return words;
+}
+
+// -------------------- Troca de efeito (main loop) --------------------
+
+#define STEP_IDLE      0
+#define STEP_FADE_OUT  1    // ISR indo para loopback; depois limpa s_oldEffect
+#define STEP_PREPARE   2    // s_newEffect sendo preparado em partes
+#define STEP_RETIRE    3    // Transição para s_newEffect; depois limpa s_oldEffect
+#define STEP_STAGE     4    // Preset novo do reverb montado ao lado do atual
+
+#define EFFECT_BIT(e)  (1u << (e))
+
+static Uint8 s_step = STEP_IDLE;
+static Uint8 s_oldEffect = EFFECT_LOOPBACK;
+static Uint8 s_newEffect = EFFECT_LOOPBACK;
+static Uint8 s_restartMask = 0;         // Efeitos com init a refazer
+static Uint8 s_presetPending = 0;       // Preset novo do reverb a montar
+static Uint8 s_pitchPreparing = 0;
+
+// A ISR aplicou a última publicação e não está em transição
+static int paramsSettled(void)
+{
+    return s_paramsLatched == s_paramsSeq && s_xfadePos >= EFFECT_XFADE_FRAMES;
+}
+
+static void publishEffect(Uint8 effect)
+{
+    effectParamsBegin()->effect = effect;
+    effectParamsCommit();
+}
+
+static void publishPitch(Uint8 enabled)
+{
+    effectParamsBegin()->pitchEnabled = enabled;
+    effectParamsCommit();
+}
+
+static void publishReverbStage(void)
+{
+    effectParamsBegin()->reverbStage++;
+    effectParamsCommit();
+}
+
+// Efeitos com buffers no slot PRINCIPAL (não rodam juntos)
+static int effectUsesMainSlot(Uint8 effect)
+{
+    return effect == EFFECT_FLANGER || effect == EFFECT_REVERB ||
+           effect == EFFECT_CONV_REVERB;
+}
+
+// Toma a memória e monta o estado de 'effect' (rápido)
+static void prepareBegin(Uint8 effect)
+{
+    s_restartMask &= ~EFFECT_BIT(effect);
+    if (effect == EFFECT_REVERB) s_presetPending = 0;   // Init já pega o preset
+    if (g_effectController.effectInitialized[effect]) return;
+
+    switch (effect) {
+        case EFFECT_FLANGER: flangerInitBegin(); break;
+        case EFFECT_TREMOLO: initTremolo();      break;
+        case EFFECT_REVERB:  reverbInitBegin();  break;
+        case EFFECT_CONV_REVERB: convReverbInitBegin(); break;
+        default:             break;     // Loopback já está inicializado
+    }
+}
+
+// Uma parte da limpeza; 1 quando 'effect' está pronto
+static Uint8 prepareStep(Uint8 effect)
+{
+    Uint8 ready = 1;
+
+    if (g_effectController.effectInitialized[effect]) return 1;
+
+    switch (effect) {
+        case EFFECT_FLANGER: ready = flangerInitStep(EFFECT_INIT_CHUNK_WORDS); break;
+        case EFFECT_REVERB:  ready = reverbInitStep(EFFECT_INIT_CHUNK_WORDS);  break;
+        case EFFECT_CONV_REVERB:
+            ready = convReverbInitStep(EFFECT_INIT_CHUNK_WORDS);
+            break;
+        default:             break;
+    }
+    if (ready) g_effectController.effectInitialized[effect] = 1;
+    return ready;
+}
+
+// Liga/desliga o pitch shift; retorna 1 se deu um passo
+static Uint8 pitchStep(void)
+{
+    Uint8 want = g_effectController.pitchShiftActive;
+    Uint8 mode = g_effectController.pitchMode;
+
+    // Outro modo com o pitch tocando: sai em rampa e é refeito
+    if (want && s_paramsPending.pitchEnabled && g_pitch.mode != mode) {
+        publishPitch(0);
+        return 1;
+    }
+
+    if (want && !s_paramsPending.pitchEnabled) {
+        if (!s_pitchPreparing || g_pitch.mode != mode) {
+            pitchShiftInitBegin(mode);
+            s_pitchPreparing = 1;
+        }
+        if (pitchShiftInitStep(EFFECT_INIT_CHUNK_WORDS)) {
+            s_pitchPreparing = 0;
+            publishPitch(1);        // Fade-in na ISR
+        }
+        return 1;
+    }
+    s_pitchPreparing = 0;
+
+    if (!want && s_paramsPending.pitchEnabled) {
+        publishPitch(0);            // Fade-out na ISR
+        return 1;
+    }
+
+    // Desligado e assentado: a memória do pitch volta para a arena
+    if (!want && effectMemOwner(EFFECT_SLOT_PRE) == EFFECT_OWNER_PITCH) {
+        effectMemRelease(EFFECT_SLOT_PRE);
+        return 1;
+    }
+    return 0;
+}
+
+// Troca de preset do reverb em uso; retorna 1 se deu um passo
+static Uint8 presetStep(Uint8 live, Uint8 target)
+{
+    if (!s_presetPending) return 0;
+
+    // Reverb saindo da cadeia ou sendo refeito: o próximo init usa o preset
+    if (live != EFFECT_REVERB || target != EFFECT_REVERB ||
+        (s_restartMask & EFFECT_BIT(EFFECT_REVERB)) || !reverbStageNeeded()) {
+        s_presetPending = 0;
+        return 0;
+    }
+
+    // Cauda de uma troca anterior ainda tocando: sai com uma rampa
+    if (reverbTailBusy()) {
+        reverbTailCut();
+        return 1;
+    }
+
+    s_presetPending = 0;
+    if (!reverbStageFits() || !tailFits()) {
+        s_restartMask |= EFFECT_BIT(EFFECT_REVERB);    // Sem espaço: reinício
+        return 0;
+    }
+
+    reverbStageBegin();
+    s_step = STEP_STAGE;
+    return 1;
+}
+
+void effectControllerPoll(void)
+{
+    Uint8 target = g_effectController.currentEffect;
+    Uint8 live   = s_paramsPending.effect;
+
+    // A ISR ainda não adotou a última publicação ou está em transição
+    if (!paramsSettled()) return;
+
+    switch (s_step) {
+        case STEP_FADE_OUT:
+            // A ISR já não usa o efeito antigo: a memória pode ser reaproveitada
+            cleanupEffect(s_oldEffect);
+            s_oldEffect = EFFECT_LOOPBACK;
+            s_step = STEP_IDLE;
+            return;
+
+        case STEP_PREPARE:
+            // O pedido mudou no meio: abandona e recomeça do estado atual
+            if (s_newEffect != target) {
+                if (s_newEffect != live) cleanupEffect(s_newEffect);
+                s_step = STEP_IDLE;
+                return;
+            }
+            if (!prepareStep(s_newEffect)) return;
+
+            g_effectController.effectActive[s_newEffect] = 1;
+            publishEffect(s_newEffect);     // Transição na ISR
+            s_step = STEP_RETIRE;
+            return;
+
+        case STEP_RETIRE:
+            if (s_oldEffect != s_newEffect && s_oldEffect != EFFECT_LOOPBACK) {
+                cleanupEffect(s_oldEffect);
+            }
+            s_oldEffect = EFFECT_LOOPBACK;
+            s_step = STEP_IDLE;
+            return;
+
+        case STEP_STAGE:
+            // Outro preset, outro efeito ou reinício pedidos: recomeça
+            if (s_presetPending || target != EFFECT_REVERB ||
+                (s_restartMask & EFFECT_BIT(EFFECT_REVERB))) {
+                s_step = STEP_IDLE;
+                return;
+            }
+            if (!reverbStageStep(EFFECT_INIT_CHUNK_WORDS)) return;
+
+            publishReverbStage();           // A ISR troca no próximo bloco
+            s_step = STEP_IDLE;
+            return;
+
+        default:
+            break;
+    }
+
+    if (pitchStep()) return;
+    if (presetStep(live, target)) return;
+
+    if (live == target && !(s_restartMask & EFFECT_BIT(live))) return;
+
+    s_oldEffect = live;
+    s_newEffect = target;
+
+    // Mesmo slot (ou o próprio efeito refeito): fade-out para loopback e
+    // só então a memória é trocada. Senão o novo é preparado com o antigo
+    // tocando e a ISR faz a transição entre os dois.
+    if (live != EFFECT_LOOPBACK &&
+        (live == target ||
+         (effectUsesMainSlot(live) && effectUsesMainSlot(target)))) {
+        publishEffect(EFFECT_LOOPBACK);
+        s_step = STEP_FADE_OUT;
+        return;
+    }
+
+    prepareBegin(target);
+    s_step = STEP_PREPARE;
+}
+
+Uint8 effectControllerBusy(void)
+{
+    Uint8 live = s_paramsPending.effect;
+    Uint8 want = g_effectController.pitchShiftActive;
+
+    if (s_step != STEP_IDLE || !paramsSettled()) return 1;
+    if (live != g_effectController.currentEffect) return 1;
+    if (s_restartMask & EFFECT_BIT(live)) return 1;
+    if (s_presetPending) return 1;
+    if (want != s_paramsPending.pitchEnabled) return 1;
+    if (want && g_pitch.mode != g_effectController.pitchMode) return 1;
+    if (!want && effectMemOwner(EFFECT_SLOT_PRE) == EFFECT_OWNER_PITCH) return 1;
+    return 0;
+}
+
+// Sem ISR de áudio não há o que esperar: completa o pedido na hora
+static void settleIfIdle(void)
+{
+    if (audioDmaRunning) return;
+    while (effectControllerBusy()) {
+        effectControllerPoll();
+    }
+}
+
+void effectRestart(Uint8 effect)
+{
+    if (effect == EFFECT_LOOPBACK || effect >= EFFECT_COUNT) return;
+    s_restartMask |= EFFECT_BIT(effect);
+    settleIfIdle();
+}
+
+void effectPresetChange(Uint8 effect)
+{
+    // Sem ISR de áudio não há cauda a preservar
+    if (effect != EFFECT_REVERB || !audioDmaRunning) {
+        effectRestart(effect);
+        return;
+    }
+    s_presetPending = 1;
+}
+
 // Inicialização do controlador
 void initEffectController(void)
 {
@@ -30,10 +583,14 @@ void initEffectController(void)
     
     g_effectController.effects[EFFECT_REVERB].name = "REVERB  ";
     g_effectController.effects[EFFECT_REVERB].code = EFFECT_REVERB;
+
+    g_effectController.effects[EFFECT_CONV_REVERB].name = "CONV REV";
+    g_effectController.effects[EFFECT_CONV_REVERB].code = EFFECT_CONV_REVERB;
     
     // Estado inicial
     g_effectController.currentEffect = EFFECT_LOOPBACK;
     g_effectController.pitchShiftActive = 0; // Começa desativado
+    g_effectController.pitchMode = PITCH_MODE_GRAIN;
     
     for (i = 0; i < EFFECT_COUNT; i++) {
         g_effectController.effectInitialized[i] = 0;
@@ -44,63 +601,41 @@ void initEffectController(void)
     g_effectController.effectActive[EFFECT_LOOPBACK] = 1;
     g_effectController.effectInitialized[EFFECT_LOOPBACK] = 1;
     
-    currentEffect = EFFECT_LOOPBACK;
+    // Chamado com o DMA de áudio parado (boot, ferramentas de host)
+    s_step = STEP_IDLE;
+    s_oldEffect = s_newEffect = EFFECT_LOOPBACK;
+    s_restartMask = 0;
+    s_presetPending = 0;
+    s_pitchPreparing = 0;
+
+    effectParamsBegin();
+    s_paramsPending.effect = EFFECT_LOOPBACK;
+    s_paramsPending.pitchEnabled = 0;
+    effectParamsCommit();
+
+    // Nenhum efeito com memória: os slots ficam livres
+    for (i = 0; i < EFFECT_SLOT_COUNT; i++) {
+        effectMemRelease(i);
+    }
 }
 
-// Configura efeito ativo
+// Configura efeito ativo (a troca é feita por effectControllerPoll)
 void setEffect(Uint8 effect)
 {
     if (effect >= EFFECT_COUNT) {
         effect = EFFECT_LOOPBACK;
     }
     
-    Uint8 oldEffect = g_effectController.currentEffect;
-    
-    // Limpa efeito anterior se necessário
-    if (oldEffect != effect && oldEffect != EFFECT_LOOPBACK) {
-        cleanupEffect(oldEffect);
-    }
-    
-    // Inicializa novo efeito se necessário
-    if (!g_effectController.effectInitialized[effect]) {
-        switch (effect) {
-            case EFFECT_FLANGER:
-                initFlanger();
-                g_effectController.effectInitialized[effect] = 1;
-                break;
-                
-            case EFFECT_TREMOLO:
-                initTremolo();
-                g_effectController.effectInitialized[effect] = 1;
-                break;
-                
-            case EFFECT_REVERB:
-                initReverb();
-                g_effectController.effectInitialized[effect] = 1;
-                break;
-                
-            default:
-                // Loopback já está inicializado
-                break;
-        }
-    }
-    
-    // Ativa o novo efeito
     g_effectController.currentEffect = effect;
-    g_effectController.effectActive[effect] = 1;
-    currentEffect = effect;
+    settleIfIdle();
 }
 
-// Configura estado do Pitch Shift
+// Configura estado do Pitch Shift (aplicado por effectControllerPoll).
+// A frequência é independente: setPitchFrequency pode vir antes ou depois.
 void setPitchShiftEnabled(Uint8 enabled)
 {
-    // Se estava desligado e vai ligar, inicializa para limpar buffers
-    if (enabled && !g_effectController.pitchShiftActive) {
-        initPitchShift();
-        // CUIDADO: initPitchShift reseta a frequência para Default (1.0x).
-        // Quem chamar esta função deve setar a frequência DEPOIS.
-    }
-    g_effectController.pitchShiftActive = enabled;
+    g_effectController.pitchShiftActive = enabled ? 1 : 0;
+    settleIfIdle();
 }
 
 // Retorna se Pitch Shift está ativo
@@ -109,6 +644,19 @@ Uint8 isPitchShiftEnabled(void)
     return g_effectController.pitchShiftActive;
 }
 
+// Algoritmo do Pitch Shift (aplicado por effectControllerPoll)
+void setPitchShiftMode(Uint8 mode)
+{
+    g_effectController.pitchMode =
+        (mode == PITCH_MODE_VOCODER || mode == PITCH_MODE_GRAIN_SYNC) ? mode : PITCH_MODE_GRAIN;
+    settleIfIdle();
+}
+
+Uint8 getPitchShiftMode(void)
+{
+    return g_effectController.pitchMode;
+}
+
 // Obtém próximo efeito na sequência
 Uint8 getNextEffect(Uint8 current)
 {
@@ -125,33 +673,31 @@ void cleanupEffect(Uint8 effect)
     
     switch (effect) {
         case EFFECT_FLANGER:
-            clearFlanger();
+        case EFFECT_REVERB:
+        case EFFECT_CONV_REVERB:
+            // Devolve o slot: o próximo efeito reaproveita a memória e este
+            // volta "frio" (init completo) quando for reativado
+            if (effectMemOwner(EFFECT_SLOT_MAIN) == effect) {
+                effectMemRelease(EFFECT_SLOT_MAIN);
+            }
+            g_effectController.effectInitialized[effect] = 0;
             break;
             
         case EFFECT_TREMOLO:
             // Tremolo não tem buffers grandes para limpar
             break;
             
-        case EFFECT_REVERB:
-            clearReverb();
-            break;
-            
         default:
             // Loopback não precisa limpar
             break;
     }
 }
 
-// Limpa todos os efeitos (exceto loopback)
+// Limpa todos os efeitos (exceto loopback): pede loopback sem pitch e o
+// controlador libera cada um quando a ISR parar de usá-lo
 void cleanupAllEffects(void)
 {
-    int i;
-    
-    for (i = 1; i < EFFECT_COUNT; i++) {
-        cleanupEffect(i);
-    }
-    
-    // Garante que loopback está ativo
+    setPitchShiftEnabled(0);
     setEffect(EFFECT_LOOPBACK);
 }
 
@@ -0,0 +1,422 @@
+//////////////////////////////////////////////////////////////////////////////
+// fft.c - FFT Q15 com ponto flutuante em bloco (ver fft.h)
+//////////////////////////////////////////////////////////////////////////////
+
+#include "fft.h"
+#include <math.h>
+
+#define FFT_QUARTER  (FFT_MAX_POINTS / 4)
+
+// sen(pi/2 * i / FFT_QUARTER) em Q15, i = 0..FFT_QUARTER
+static Int16 s_sine[FFT_QUARTER + 1];
+static Uint16 s_sineReady = 0;
+
+void fftInit(void)
+{
+    Uint16 i;
+
+    if (s_sineReady) return;
+    for (i = 0; i <= FFT_QUARTER; i++) {
+        float rad = (float)i / (float)FFT_QUARTER * 1.57079632679f;
+        s_sine[i] = (Int16)floorf(sinf(rad) * 32767.0f + 0.5f);
+    }
+    s_sineReady = 1;
+}
+
+// sen(pi/2 * i / FFT_QUARTER) para i em uma volta inteira
+static inline Int16 sineAt(Uint16 i)
+{
+    Uint16 q = i % FFT_QUARTER;
+
+    switch ((i / FFT_QUARTER) & 3u) {
+        case 0:  return s_sine[q];
+        case 1:  return s_sine[FFT_QUARTER - q];
+        case 2:  return -s_sine[q];
+        default: return -s_sine[FFT_QUARTER - q];
+    }
+}
+
+// 4 * FFT_QUARTER pontos da tabela por volta: os 11 bits de cima da fase
+// escolhem o ponto e os 5 de baixo interpolam
+#define TURN_SHIFT   5
+#if (4 * FFT_QUARTER) << TURN_SHIFT != 65536L
+#error "TURN_SHIFT não corresponde a FFT_MAX_POINTS"
+#endif
+
+void fftCosSin(Uint16 phase, Int16* c, Int16* s)
+{
+    Uint16 i = phase >> TURN_SHIFT;
+    Int32 frac = phase & ((1u << TURN_SHIFT) - 1);
+    Int16 s0 = sineAt(i), s1 = sineAt(i + 1);
+    Int16 c0 = sineAt(i + FFT_QUARTER), c1 = sineAt(i + FFT_QUARTER + 1);
+
+    *s = (Int16)(s0 + (((Int32)(s1 - s0) * frac) >> TURN_SHIFT));
+    *c = (Int16)(c0 + (((Int32)(c1 - c0) * frac) >> TURN_SHIFT));
+}
+
+#if defined(__TMS320C55X__) && defined(FFT_USE_DSPLIB)
+
+// ---------------------------------------------------------------------------
+// DSPLIB do C55x: escala fixa (SCALE divide por 2 em cada estágio) e ordem
+// de bits tratada pelo cbrev, na sequência dos exemplos da biblioteca
+// ---------------------------------------------------------------------------
+
+#include <dsplib.h>
+
+static Int16 log2Points(Uint16 n)
+{
+    Int16 e = 0;
+
+    while (n > 1) {
+        n >>= 1;
+        e++;
+    }
+    return e;
+}
+
+Int16 fftForward(Int16* x, Uint16 n)
+{
+    cfft((DATA*)x, n, SCALE);
+    cbrev((DATA*)x, (DATA*)x, n);
+    return log2Points(n);
+}
+
+Int16 fftInverse(Int16* x, Uint16 n)
+{
+    cifft((DATA*)x, n, SCALE);
+    cbrev((DATA*)x, (DATA*)x, n);
+    return log2Points(n);
+}
+
+Int16 fftRealForward(Int16* x, Uint16 n)
+{
+    cbrev((DATA*)x, (DATA*)x, n / 2);
+    rfft((DATA*)x, n, SCALE);
+    return log2Points(n);
+}
+
+Int16 fftRealInverse(Int16* x, Uint16 n)
+{
+    rifft((DATA*)x, n, SCALE);
+    cbrev((DATA*)x, (DATA*)x, n / 2);
+    return log2Points(n);
+}
+
+#else
+
+// ---------------------------------------------------------------------------
+// Implementação em C (host e DSP sem a DSPLIB)
+// ---------------------------------------------------------------------------
+
+#define FFT_HALF     (FFT_MAX_POINTS / 2)
+
+// cos e sen de 2*pi*m / FFT_MAX_POINTS, m < FFT_MAX_POINTS
+static inline void twiddle(Uint16 m, Int16* c, Int16* s)
+{
+    Int16 sign = 1;
+
+    if (m >= FFT_HALF) {            // theta + pi: troca os dois sinais
+        m -= FFT_HALF;
+        sign = -1;
+    }
+    if (m <= FFT_QUARTER) {
+        *c = s_sine[FFT_QUARTER - m];
+        *s = s_sine[m];
+    } else {
+        *c = -s_sine[m - FFT_QUARTER];
+        *s = s_sine[2 * FFT_QUARTER - m];
+    }
+    *c *= sign;
+    *s *= sign;
+}
+
+static inline Uint16 magnitude(Int32 v)
+{
+    return (Uint16)(v < 0 ? -v : v);
+}
+
+static inline Uint16 peakOf(Uint16 peak, Int16 v)
+{
+    Uint16 m = magnitude(v);
+
+    return m > peak ? m : peak;
+}
+
+// Maior módulo de 'words' palavras
+static Uint16 blockPeak(const Int16* x, Uint16 words)
+{
+    Uint16 peak = 0;
+    Uint16 i;
+
+    for (i = 0; i < words; i++) peak = peakOf(peak, x[i]);
+    return peak;
+}
+
+// Divisões para uma soma de até 1 + 3 * sqrt(2) = 5.243 vezes o maior
+// módulo (borboleta radix-4; os passos da FFT real somam até 4.83 vezes):
+// até 6249 cabe sem dividir, e cada dobro pede uma divisão por 2.
+static inline Uint16 wideShift(Uint16 peak)
+{
+    if (peak <= 6249u)  return 0;
+    if (peak <= 12499u) return 1;
+    if (peak <= 24998u) return 2;
+    return 3;
+}
+
+// Divisões para a borboleta radix-2 (soma até 2 vezes o maior módulo). Com
+// o arredondamento, (2 * 32766 + 1) >> 1 já dá 32766: a divisão por 2 só
+// vale até 32765, e acima disso (32766, 32767 e -32768 na entrada) são 2.
+static inline Uint16 narrowShift(Uint16 peak)
+{
+    if (peak <= 16382u) return 0;
+    if (peak <= 32765u) return 1;
+    return 2;
+}
+
+static inline Int32 roundOf(Uint16 shift)
+{
+    return shift ? (1L << (shift - 1)) : 0;
+}
+
+static void bitReverse(Int16* x, Uint16 n)
+{
+    Uint16 i, j = 0, bit;
+    Int16 t;
+
+    for (i = 0; i < n - 1; i++) {
+        if (i < j) {
+            t = x[2 * i];     x[2 * i]     = x[2 * j];     x[2 * j]     = t;
+            t = x[2 * i + 1]; x[2 * i + 1] = x[2 * j + 1]; x[2 * j + 1] = t;
+        }
+        bit = n >> 1;
+        while (j & bit) {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+}
+
+// (xr + j*xi) * (c - j*s), com arredondamento de Q15
+static inline void rotate(const Int16* v, Int16 c, Int16 s, Int32* re, Int32* im)
+{
+    *re = ((Int32)v[0] * c + (Int32)v[1] * s + 0x4000) >> 15;
+    *im = ((Int32)v[1] * c - (Int32)v[0] * s + 0x4000) >> 15;
+}
+
+// Primeiro estágio radix-2 (log2(n) ímpar): só somas, w = 1. A saída é no
+// máximo o dobro da entrada, dividida por narrowShift.
+static Uint16 radix2Stage(Int16* x, Uint16 n, Uint16 shift)
+{
+    Int32 round = roundOf(shift);
+    Int32 ar, ai, br, bi;
+    Uint16 peak = 0;
+    Uint16 i;
+
+    for (i = 0; i < 2 * n; i += 4) {
+        ar = x[i];     ai = x[i + 1];
+        br = x[i + 2]; bi = x[i + 3];
+        x[i]     = (Int16)((ar + br + round) >> shift);
+        x[i + 1] = (Int16)((ai + bi + round) >> shift);
+        x[i + 2] = (Int16)((ar - br + round) >> shift);
+        x[i + 3] = (Int16)((ai - bi + round) >> shift);
+        peak = peakOf(peak, x[i]);
+        peak = peakOf(peak, x[i + 1]);
+        peak = peakOf(peak, x[i + 2]);
+        peak = peakOf(peak, x[i + 3]);
+    }
+    return peak;
+}
+
+// Estágio radix-4 de decimação no tempo sobre DFTs de 'span' pontos (dois
+// estágios radix-2 fundidos): a = x[i], b = x[i+span], c = x[i+2span],
+// d = x[i+3span] com W = w^k de 4*span pontos:
+//   B = W^2 b, C = W c, D = W^3 d
+//   X0 = a + B + (C + D)      X2 = a + B - (C + D)
+//   X1 = a - B -+ j(C - D)    X3 = a - B +- j(C - D)   (direta / inversa)
+static Uint16 radix4Stage(Int16* x, Uint16 n, Uint16 span, Uint16 shift,
+                          Uint16 inverse)
+{
+    Int32 round = roundOf(shift);
+    Uint16 step = FFT_MAX_POINTS / (4 * span);
+    Uint16 peak = 0;
+    Uint16 k, i, m;
+    Int16 c1, s1, c2, s2, c3, s3;
+    Int32 br, bi, cr, ci, dr, di;
+    Int32 t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+    for (k = 0, m = 0; k < span; k++, m += step) {
+        twiddle(m, &c1, &s1);
+        twiddle(2 * m, &c2, &s2);
+        twiddle(3 * m, &c3, &s3);
+        if (inverse) {
+            s1 = -s1;
+            s2 = -s2;
+            s3 = -s3;
+        }
+
+        for (i = k; i < n; i += 4 * span) {
+            Int16* a = &x[2 * i];
+            Int16* b = &x[2 * (i + span)];
+            Int16* c = &x[2 * (i + 2 * span)];
+            Int16* d = &x[2 * (i + 3 * span)];
+
+            rotate(b, c2, s2, &br, &bi);
+            rotate(c, c1, s1, &cr, &ci);
+            rotate(d, c3, s3, &dr, &di);
+
+            t0r = a[0] + br;  t0i = a[1] + bi;
+            t1r = a[0] - br;  t1i = a[1] - bi;
+            t2r = cr + dr;    t2i = ci + di;
+            t3r = cr - dr;    t3i = ci - di;
+            if (inverse) {      // +-j(C - D) trocam de lugar
+                t3r = -t3r;
+                t3i = -t3i;
+            }
+
+            a[0] = (Int16)((t0r + t2r + round) >> shift);
+            a[1] = (Int16)((t0i + t2i + round) >> shift);
+            c[0] = (Int16)((t0r - t2r + round) >> shift);
+            c[1] = (Int16)((t0i - t2i + round) >> shift);
+            b[0] = (Int16)((t1r + t3i + round) >> shift);
+            b[1] = (Int16)((t1i - t3r + round) >> shift);
+            d[0] = (Int16)((t1r - t3i + round) >> shift);
+            d[1] = (Int16)((t1i + t3r + round) >> shift);
+
+            peak = peakOf(peak, a[0]);
+            peak = peakOf(peak, a[1]);
+            peak = peakOf(peak, b[0]);
+            peak = peakOf(peak, b[1]);
+            peak = peakOf(peak, c[0]);
+            peak = peakOf(peak, c[1]);
+            peak = peakOf(peak, d[0]);
+            peak = peakOf(peak, d[1]);
+        }
+    }
+    return peak;
+}
+
+static Int16 transform(Int16* x, Uint16 n, Uint16 inverse)
+{
+    Uint16 span = 1, stages = 0, shift, peak;
+    Int16 exponent = 0;
+
+    while ((1u << stages) < n) stages++;
+
+    bitReverse(x, n);
+    peak = blockPeak(x, 2 * n);
+
+    if (stages & 1) {
+        shift = narrowShift(peak);
+        exponent += (Int16)shift;
+        peak = radix2Stage(x, n, shift);
+        span = 2;
+    }
+    for (; span < n; span <<= 2) {
+        shift = wideShift(peak);
+        exponent += (Int16)shift;
+        peak = radix4Stage(x, n, span, shift, inverse);
+    }
+    return exponent;
+}
+
+Int16 fftForward(Int16* x, Uint16 n)
+{
+    return transform(x, n, 0);
+}
+
+Int16 fftInverse(Int16* x, Uint16 n)
+{
+    return transform(x, n, 1);
+}
+
+// Parte real de (br + j*bi) * (c + j*s) com br e bi de 17 bits (somas de
+// duas palavras), arredondada em Q15. Cada produto cabe em 32 bits, a soma
+// dos dois não (65535 * 23170 * 2 > 2^31): soma as metades.
+static inline Int32 wideMac(Int32 br, Int16 c, Int32 bi, Int16 s)
+{
+    return ((br * c >> 1) + (bi * s >> 1) + 0x2000) >> 14;
+}
+
+// Real de n pontos = complexa de n/2 com as amostras pares na parte real e
+// as ímpares na imaginária (o próprio vetor), mais um passo que separa os
+// dois espectros. Com Z = FFT(z), A = Z[k] + Z*[h-k], B = Z[k] - Z*[h-k]
+// (h = n/2) e P = w^k B:
+//   2 X[k]   = A - jP
+//   2 X[h-k] = conj(A + jP)
+Int16 fftRealForward(Int16* x, Uint16 n)
+{
+    Uint16 h = n / 2;
+    Uint16 step = FFT_MAX_POINTS / n;
+    Uint16 k, j, shift;
+    Int16 exponent, c, s;
+    Int32 ar, ai, br, bi, pr, pi, zr, zi, round;
+
+    exponent = transform(x, h, 0);
+    shift = wideShift(blockPeak(x, n));
+    round = roundOf(shift);
+
+    // Bin 0 e bin h (reais): 2 X[0] = 2 (Zr + Zi), 2 X[h] = 2 (Zr - Zi)
+    zr = x[0];
+    zi = x[1];
+    x[0] = (Int16)((2 * (zr + zi) + round) >> shift);
+    x[1] = (Int16)((2 * (zr - zi) + round) >> shift);
+
+    for (k = 1, j = h - 1; k <= j; k++, j--) {
+        ar = (Int32)x[2 * k] + x[2 * j];
+        ai = (Int32)x[2 * k + 1] - x[2 * j + 1];
+        br = (Int32)x[2 * k] - x[2 * j];
+        bi = (Int32)x[2 * k + 1] + x[2 * j + 1];
+
+        twiddle(k * step, &c, &s);
+        pr = wideMac(br, c, bi, s);
+        pi = wideMac(bi, c, br, (Int16)-s);
+
+        x[2 * k]     = (Int16)((ar + pi + round) >> shift);
+        x[2 * k + 1] = (Int16)((ai - pr + round) >> shift);
+        x[2 * j]     = (Int16)((ar - pi + round) >> shift);
+        x[2 * j + 1] = (Int16)((-ai - pr + round) >> shift);
+    }
+    return exponent + (Int16)shift - 1;
+}
+
+// Inverso do passo acima: com A = X[k] + X*[h-k], B = X[k] - X*[h-k] e
+// Q = conj(w^k) B, Z' = 2 Z fica
+//   Z'[k]   = A + jQ
+//   Z'[h-k] = conj(A - jQ)
+// e a IFFT complexa de h pontos de Z' dá n * x, intercalado em ordem.
+Int16 fftRealInverse(Int16* x, Uint16 n)
+{
+    Uint16 h = n / 2;
+    Uint16 step = FFT_MAX_POINTS / n;
+    Uint16 k, j, shift;
+    Int16 c, s;
+    Int32 ar, ai, br, bi, qr, qi, x0, xh, round;
+
+    shift = wideShift(blockPeak(x, n));
+    round = roundOf(shift);
+
+    x0 = x[0];
+    xh = x[1];
+    x[0] = (Int16)((x0 + xh + round) >> shift);
+    x[1] = (Int16)((x0 - xh + round) >> shift);
+
+    for (k = 1, j = h - 1; k <= j; k++, j--) {
+        ar = (Int32)x[2 * k] + x[2 * j];
+        ai = (Int32)x[2 * k + 1] - x[2 * j + 1];
+        br = (Int32)x[2 * k] - x[2 * j];
+        bi = (Int32)x[2 * k + 1] + x[2 * j + 1];
+
+        twiddle(k * step, &c, &s);
+        qr = wideMac(br, c, bi, (Int16)-s);
+        qi = wideMac(bi, c, br, s);
+
+        x[2 * k]     = (Int16)((ar - qi + round) >> shift);
+        x[2 * k + 1] = (Int16)((ai + qr + round) >> shift);
+        x[2 * j]     = (Int16)((ar + qi + round) >> shift);
+        x[2 * j + 1] = (Int16)((qr - ai + round) >> shift);
+    }
+    return transform(x, h, 1) + (Int16)shift;
+}
+
+#endif /* __TMS320C55X__ && FFT_USE_DSPLIB */
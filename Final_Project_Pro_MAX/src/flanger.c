@@ -3,50 +3,80 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "flanger.h"
+#include "fixed_point.h"
+#include "effects_controller.h"
 #include <math.h>
 
-#pragma DATA_SECTION(g_flangerBuffer, "effectsMem")
-#pragma DATA_ALIGN(g_flangerBuffer, 4)
-Int16 g_flangerBuffer[FLANGER_DELAY_SIZE];
-
-#pragma DATA_SECTION(g_lfoTable, "effectsMem")
-#pragma DATA_ALIGN(g_lfoTable, 4)
-Int16 g_lfoTable[LFO_SIZE];
+// Buffers no slot principal da arena de efeitos (DARAM)
+Int16* g_flangerBuffer[FLANGER_NUM_CHANNELS];
+Int16* g_lfoTable;
 
 volatile Uint16 g_flangerWriteIndex = 0;
 volatile Uint32 g_flangerPhaseAcc = 0;
 volatile Uint32 g_flangerPhaseInc = 0;
 
-static inline Int16 sat16(Int32 x) {
-    if (x > 32767)  return 32767;
-    if (x < -32768) return -32768;
-    return (Int16)x;
+// Init em partes: etapas 0..1 limpam as linhas L/R, etapa 2 gera o LFO
+#define INIT_STAGE_LFO    FLANGER_NUM_CHANNELS
+#define INIT_STAGE_DONE   (FLANGER_NUM_CHANNELS + 1)
+#define LFO_ENTRY_WORDS   32      // Um sinf custa ~ zerar 32 palavras
+
+static Uint16 s_initStage = INIT_STAGE_DONE;
+static Uint16 s_initPos = 0;
+
+void flangerInitBegin(void)
+{
+    // 0. Memória: toma o slot principal da arena
+    effectMemAcquire(EFFECT_SLOT_MAIN, EFFECT_FLANGER);
+    g_flangerBuffer[0] = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, FLANGER_DELAY_SIZE);
+    g_flangerBuffer[1] = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, FLANGER_DELAY_SIZE);
+    g_lfoTable         = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, LFO_SIZE);
+
+    // 3. Configura Oscilador para 0.5 Hz
+    g_flangerPhaseInc = LFO_INC;
+    g_flangerPhaseAcc = 0;
+    g_flangerWriteIndex = 0;
+
+    s_initStage = 0;
+    s_initPos = 0;
 }
 
-void initFlanger(void)
+Uint8 flangerInitStep(Uint16 words)
 {
-    int i;
     float rad;
-    
-    // 1. Limpa Buffer
-    for (i = 0; i < FLANGER_DELAY_SIZE; i++) {
-        g_flangerBuffer[i] = 0;
+
+    // 1. Limpa Buffers (L e R)
+    while (words > 0 && s_initStage < INIT_STAGE_LFO) {
+        words -= effectClearChunk(g_flangerBuffer[s_initStage], FLANGER_DELAY_SIZE,
+                                  &s_initPos, words);
+        if (s_initPos >= FLANGER_DELAY_SIZE) {
+            s_initStage++;
+            s_initPos = 0;
+        }
     }
-    
+
     // 2. Gera Tabela de Seno (Full Range -32767 a +32767)
     // Isso corresponde ao "sin(wn)" da fórmula do Python
-    for (i = 0; i < LFO_SIZE; i++) {
-        rad = (float)i / (float)LFO_SIZE * (2.0f * 3.14159265359f);
-        g_lfoTable[i] = (Int16)(sinf(rad) * 32767.0f);
+    while (words > 0 && s_initStage == INIT_STAGE_LFO) {
+        rad = (float)s_initPos / (float)LFO_SIZE * (2.0f * 3.14159265359f);
+        g_lfoTable[s_initPos] = (Int16)(sinf(rad) * 32767.0f);
+
+        words = words > LFO_ENTRY_WORDS ? words - LFO_ENTRY_WORDS : 0;
+        if (++s_initPos >= LFO_SIZE) s_initStage = INIT_STAGE_DONE;
     }
-    
-    // 3. Configura Oscilador para 0.5 Hz
-    g_flangerPhaseInc = LFO_INC;
-    g_flangerPhaseAcc = 0;
-    g_flangerWriteIndex = 0;
+    return s_initStage >= INIT_STAGE_DONE;
 }
 
-void processAudioFlanger(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize)
+void initFlanger(void)
+{
+    flangerInitBegin();
+    while (!flangerInitStep(0xFFFF)) {
+    }
+}
+
+// Blocos planares, processados in-place: left[0..frames-1], right[...].
+// LFO, delay e índices são calculados uma vez por quadro e servem aos dois
+// canais; cada canal tem sua própria linha de atraso.
+void processAudioFlanger(Int16* left, Int16* right, Uint16 frames)
 {
     int i;
 
@@ -63,19 +93,23 @@ void processAudioFlanger(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize)
     int rawIdx;
 
     // Áudio
-    Int16 x_n;
-    Int32 wet_signal, output_32;
+    Int16 xL, xR;
+    Int16* bufL = g_flangerBuffer[0];
+    Int16* bufR = g_flangerBuffer[1];
+    Uint16 w_idx = g_flangerWriteIndex;
+    Uint32 phase = g_flangerPhaseAcc;
 
-    for (i = 0; i < blockSize; i++)
+    for (i = 0; i < frames; i++)
     {     
-        x_n = (Int16)rxBlock[i];
+        xL = left[i];
+        xR = right[i];
         
         // --- 1. LFO (Oscilador 0.5Hz) ---
-        // Incrementa fase
-        g_flangerPhaseAcc += g_flangerPhaseInc;
+        // Incrementa fase (uma vez por quadro)
+        phase += g_flangerPhaseInc;
 
         // Pega os 8 bits superiores para índice (2^8 = 256 = LFO_SIZE)
-        lfo_idx = (Uint16)(g_flangerPhaseAcc >> 24);
+        lfo_idx = (Uint16)(phase >> 24);
         lfo_val_Q15 = (Int32)g_lfoTable[lfo_idx];
 
         // --- 2. CÁLCULO DO DELAY (Lógica Python: L0 + A * sin) ---
@@ -92,7 +126,7 @@ void processAudioFlanger(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize)
 
         // --- 3. LEITURA COM INTERPOLAÇÃO ---
         // Posição de leitura: (Escrita - Delay)
-        rawIdx = (int)g_flangerWriteIndex - int_delay;
+        rawIdx = (int)w_idx - int_delay;
         while (rawIdx < 0) rawIdx += FLANGER_DELAY_SIZE;
         idx1 = (Uint16)rawIdx;
 
@@ -101,30 +135,40 @@ void processAudioFlanger(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize)
         while (rawIdx < 0) rawIdx += FLANGER_DELAY_SIZE;
         idx2 = (Uint16)rawIdx;
         
-        samp1 = g_flangerBuffer[idx1];
-        samp2 = g_flangerBuffer[idx2];
-        
         // Fórmula: y = s1 + frac * (s2 - s1)
-        delayed_sample = samp1 + (Int16)(((Int32)frac_delay * (samp2 - samp1)) >> 15);
-        
-        // --- 4. MIXAGEM ---
-        // y[n] = x[n] + gain * delayed
-        // Ganho ajustado para 0.7 (22938)
-        wet_signal = ((Int32)FLANGER_G * (Int32)delayed_sample) >> 15;
-        output_32 = (Int32)x_n + wet_signal;
-        
-        txBlock[i] = (Uint16)sat16(output_32);
-
-        // Atualiza Buffer
-        g_flangerBuffer[g_flangerWriteIndex] = x_n;
-        g_flangerWriteIndex++;
-        if (g_flangerWriteIndex >= FLANGER_DELAY_SIZE) {
-            g_flangerWriteIndex = 0;
+        // (s2 - s1) é calculado em 16 bits, como o "int" do C55x
+        // --- 4. MIXAGEM: y[n] = x[n] + gain * delayed (ganho 0.7) ---
+
+        // ESQ
+        samp1 = bufL[idx1];
+        samp2 = bufL[idx2];
+        delayed_sample = samp1 + (Int16)(((Int32)frac_delay * C55_SUB16(samp2, samp1)) >> 15);
+        left[i] = q15_add(xL, q15_mul(FLANGER_G, delayed_sample));
+
+        // DIR
+        samp1 = bufR[idx1];
+        samp2 = bufR[idx2];
+        delayed_sample = samp1 + (Int16)(((Int32)frac_delay * C55_SUB16(samp2, samp1)) >> 15);
+        right[i] = q15_add(xR, q15_mul(FLANGER_G, delayed_sample));
+
+        // Atualiza Buffers
+        bufL[w_idx] = xL;
+        bufR[w_idx] = xR;
+        w_idx++;
+        if (w_idx >= FLANGER_DELAY_SIZE) {
+            w_idx = 0;
         }
     }
+
+    g_flangerWriteIndex = w_idx;
+    g_flangerPhaseAcc = phase;
 }
 
 void clearFlanger(void)
 {
-    initFlanger();
+    // Só reinicia se a memória ainda for do flanger; o controlador refaz
+    // o init fora da ISR
+    if (effectMemOwner(EFFECT_SLOT_MAIN) == EFFECT_FLANGER) {
+        effectRestart(EFFECT_FLANGER);
+    }
 }
@@ -66,6 +66,7 @@ void main(void)
     while (1) {
         checkTimer();
         checkSwitch();
+        effectControllerPoll();     // Troca de efeito/preset em partes
     }
 }
 
@@ -133,17 +134,20 @@ void effectChangeFeedback(Uint8 effect)
 //   - SW1: percorre a sequência:
 //
 //       0 → LOOPBACK
-//       1 → FLANGER
-//       2 → TREMOLO
-//       3 → REVERB           (preset atual; começa em HALL)
-//       4 → REVERB + HALL
-//       5 → REVERB + ROOM
-//       6 → REVERB + STAGE   (depois volta para 0)
+//       1 → REVERB HALL
+//       2 → REVERB ROOM 2
+//       3..6 → REVERB STAGE + PITCH SHIFT (B, D, F, Gb)
+//       7 → FLANGER
+//       8 → TREMOLO
+//       9 → REVERB FDN HALL
+//      10 → REVERB FDN ROOM
+//      11 → REVERB PLATE
+//      12 → REVERB CONV      (convolução com a IR; depois volta para 0)
 // ---------------------------------------------------------------------------
 void checkSwitch(void)
 {
     static Uint8 lastEffectButtonState = 1;  // estado anterior de SW1 (para borda)
-    static Uint8 effectStep = 0;            // 0..6, controla efeitos + presets
+    static Uint8 effectStep = 0;            // 0..12, controla efeitos + presets
 
     Uint8 sw0Raw;
     Uint8 sw1Raw;
@@ -167,7 +171,7 @@ void checkSwitch(void)
     // --- SW1: muda efeito / preset (detecção de borda 1 -> 0)
     if ((sw1Raw == 0) && (lastEffectButtonState == 1))
     {
-        effectStep = (effectStep + 1u) % 9u; // Ajustar caso queira colocar mais efeitos (contador circular)
+        effectStep = (effectStep + 1u) % 13u; // Ajustar caso queira colocar mais efeitos (contador circular)
 
         switch (effectStep)
         {
@@ -188,28 +192,32 @@ void checkSwitch(void)
                 setEffect(EFFECT_REVERB);
                 break;
 
-            case 3: // REVERB STAGE + PITCH SHIFT (B)
+            case 3: // REVERB STAGE + PITCH SHIFT (B, VOCODER)
+                setPitchShiftMode(PITCH_MODE_VOCODER);
                 setPitchShiftEnabled(1);
                 setPitchFrequency(493.88f);
                 setReverbPreset(REVERB_PRESET_STAGE);
                 setEffect(EFFECT_REVERB);
                 break;
 
-            case 4: // REVERB STAGE + PITCH SHIFT (D)
+            case 4: // REVERB STAGE + PITCH SHIFT (D, GRÃOS SINCRONIZADOS)
+                setPitchShiftMode(PITCH_MODE_GRAIN_SYNC);
                 setPitchShiftEnabled(1);
                 setPitchFrequency(293.66f);
                 setReverbPreset(REVERB_PRESET_STAGE);
                 setEffect(EFFECT_REVERB);
                 break;
 
-            case 5: // REVERB STAGE + PITCH SHIFT (F)
+            case 5: // REVERB STAGE + PITCH SHIFT (F, GRÃOS SINCRONIZADOS)
+                setPitchShiftMode(PITCH_MODE_GRAIN_SYNC);
                 setPitchShiftEnabled(1);
                 setPitchFrequency(349.23f);
                 setReverbPreset(REVERB_PRESET_STAGE);
                 setEffect(EFFECT_REVERB);
                 break;
 
-            case 6: // REVERB STAGE + PITCH SHIFT (Gb)
+            case 6: // REVERB STAGE + PITCH SHIFT (Gb, VOCODER)
+                setPitchShiftMode(PITCH_MODE_VOCODER);
                 setPitchShiftEnabled(1);
                 setPitchFrequency(369.99f);
                 setReverbPreset(REVERB_PRESET_STAGE);
@@ -226,6 +234,29 @@ void checkSwitch(void)
                 setEffect(EFFECT_TREMOLO);
                 break;
 
+            case 9: // REVERB FDN HALL
+                setPitchShiftEnabled(0);
+                setReverbPreset(REVERB_PRESET_FDN_HALL);
+                setEffect(EFFECT_REVERB);
+                break;
+
+            case 10: // REVERB FDN ROOM
+                setPitchShiftEnabled(0);
+                setReverbPreset(REVERB_PRESET_FDN_ROOM);
+                setEffect(EFFECT_REVERB);
+                break;
+
+            case 11: // REVERB PLATE
+                setPitchShiftEnabled(0);
+                setReverbPreset(REVERB_PRESET_PLATE);
+                setEffect(EFFECT_REVERB);
+                break;
+
+            case 12: // REVERB CONV
+                setPitchShiftEnabled(0);
+                setEffect(EFFECT_CONV_REVERB);
+                break;
+
             default:
                 effectStep = 0;
                 setPitchShiftEnabled(0);
@@ -0,0 +1,186 @@
+//////////////////////////////////////////////////////////////////////////////
+// mem_dma.c - Cópias memória-memória em segundo plano (ver mem_dma.h)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include "mem_dma.h"
+
+#ifdef __TMS320C55X__
+
+#include "csl.h"
+#include "csl_dma.h"
+#include "csl_irq.h"
+#include "isr.h"
+
+// Início da CE0: lnkx.cmd dá a origem em bytes (0x010000) e os ponteiros
+// de dados são endereços de palavra. Abaixo disso é DARAM.
+#define MEM_DMA_CE0_ORIGIN  0x010000UL      // Bytes, MEMORY CE0 em lnkx.cmd
+#define MEM_DMA_EXT_BASE    (MEM_DMA_CE0_ORIGIN >> 1)
+#define MEM_DMA_QUEUE_MASK  (MEM_DMA_QUEUE_LEN - 1)
+
+typedef struct {
+    Int16*       dst;
+    const Int16* src;
+    Uint16       words;
+} MemDmaJob;
+
+static MemDmaJob s_queue[MEM_DMA_QUEUE_LEN];
+static volatile Uint16 s_head = 0;      // Próxima cópia a iniciar
+static volatile Uint16 s_tail = 0;      // Próxima posição livre
+static volatile Uint16 s_busy = 0;      // Canal transferindo s_queue[s_head]
+
+static DMA_Handle hDmaMem;
+static Uint16 s_ready = 0;
+
+// Sem sincronismo de evento: o canal corre assim que é habilitado
+static DMA_Config dmaMemConfig = {
+    0,                                // DMACSDP: montado por cópia (portas)
+    DMA_DMACCR_RMK(
+        DMA_DMACCR_DSTAMODE_POSTINC,
+        DMA_DMACCR_SRCAMODE_POSTINC,
+        DMA_DMACCR_ENDPROG_OFF,
+        DMA_DMACCR_WP_DEFAULT,
+        DMA_DMACCR_REPEAT_OFF,
+        DMA_DMACCR_AUTOINIT_OFF,
+        DMA_DMACCR_EN_STOP,
+        DMA_DMACCR_PRIO_LOW,          // Áudio (canais 0/1) tem prioridade
+        DMA_DMACCR_FS_ELEMENT,
+        DMA_DMACCR_SYNC_NONE
+    ),
+    DMA_DMACICR_RMK(
+        DMA_DMACICR_AERRIE_OFF,
+        DMA_DMACICR_BLOCKIE_ON,       // Fim da cópia -> próxima da fila
+        DMA_DMACICR_LASTIE_OFF,
+        DMA_DMACICR_FRAMEIE_OFF,
+        DMA_DMACICR_FIRSTHALFIE_OFF,
+        DMA_DMACICR_DROPIE_OFF,
+        DMA_DMACICR_TIMEOUTIE_OFF
+    ),
+    (DMA_AdrPtr)0x0000, 0,
+    (DMA_AdrPtr)0x0000, 0,
+    0,                    // # de elementos: por cópia
+    1,                    // 1 frame
+    0, 0, 0, 0
+};
+
+static Uint16 portSdp(Uint32 srcWord, Uint32 dstWord)
+{
+    return DMA_DMACSDP_RMK(
+        DMA_DMACSDP_DSTBEN_NOBURST,
+        DMA_DMACSDP_DSTPACK_OFF,
+        dstWord >= MEM_DMA_EXT_BASE ? DMA_DMACSDP_DST_EMIF : DMA_DMACSDP_DST_DARAMPORT0,
+        DMA_DMACSDP_SRCBEN_NOBURST,
+        DMA_DMACSDP_SRCPACK_OFF,
+        srcWord >= MEM_DMA_EXT_BASE ? DMA_DMACSDP_SRC_EMIF : DMA_DMACSDP_SRC_DARAMPORT0,
+        DMA_DMACSDP_DATATYPE_16BIT
+    );
+}
+
+static void startJob(const MemDmaJob* job)
+{
+    Uint32 src = (Uint32)job->src;
+    Uint32 dst = (Uint32)job->dst;
+
+    // O DMA usa endereços de byte
+    dmaMemConfig.dmacsdp  = portSdp(src, dst);
+    dmaMemConfig.dmacssal = (DMA_AdrPtr)((src << 1) & 0xFFFF);
+    dmaMemConfig.dmacssau = (Uint16)((src << 1) >> 16);
+    dmaMemConfig.dmacdsal = (DMA_AdrPtr)((dst << 1) & 0xFFFF);
+    dmaMemConfig.dmacdsau = (Uint16)((dst << 1) >> 16);
+    dmaMemConfig.dmacen   = job->words;
+
+    DMA_config(hDmaMem, &dmaMemConfig);
+    DMA_start(hDmaMem);
+    s_busy = 1;
+}
+
+// Avança a fila: retira a cópia concluída e inicia a próxima.
+// Chamada pela ISR e por memDmaWait (que roda com interrupções desligadas
+// dentro da ISR de áudio), por isso verifica o hardware diretamente.
+static void service(void)
+{
+    if (s_busy && !DMA_FGETH(hDmaMem, DMACCR, EN)) {
+        s_busy = 0;
+        s_head = (s_head + 1) & MEM_DMA_QUEUE_MASK;
+    }
+    if (!s_busy && s_head != s_tail) {
+        startJob(&s_queue[s_head]);
+    }
+}
+
+interrupt void memDmaIsr(void)
+{
+    DMA_RGETH(hDmaMem, DMACSR);     // Leitura limpa o status
+    service();
+}
+
+void memDmaInit(void)
+{
+    Uint16 eventId;
+
+    hDmaMem = DMA_open(DMA_CHA2, 0);
+    eventId = DMA_getEventId(hDmaMem);
+
+    IRQ_disable(eventId);
+    IRQ_clear(eventId);
+    IRQ_plug(eventId, &memDmaIsr);
+    IRQ_enable(eventId);
+
+    s_head = s_tail = s_busy = 0;
+    s_ready = 1;
+}
+
+void memDmaCopy(Int16* dst, const Int16* src, Uint16 words)
+{
+    Bool intm;
+
+    if (words == 0) return;
+    if (!s_ready) {
+        memcpy(dst, src, words);    // Antes da init: CPU (char = 16 bits)
+        return;
+    }
+
+    // Fila cheia: espera a cópia mais antiga terminar
+    while (((s_tail + 1) & MEM_DMA_QUEUE_MASK) == s_head) {
+        intm = IRQ_globalDisable();
+        service();
+        IRQ_globalRestore(intm);
+    }
+
+    intm = IRQ_globalDisable();
+    s_queue[s_tail].dst   = dst;
+    s_queue[s_tail].src   = src;
+    s_queue[s_tail].words = words;
+    s_tail = (s_tail + 1) & MEM_DMA_QUEUE_MASK;
+    service();
+    IRQ_globalRestore(intm);
+}
+
+void memDmaWait(void)
+{
+    Bool intm;
+
+    if (!s_ready) return;
+    while (s_head != s_tail) {
+        intm = IRQ_globalDisable();
+        service();
+        IRQ_globalRestore(intm);
+    }
+}
+
+#else /* Build de host: cópias síncronas */
+
+void memDmaInit(void)
+{
+}
+
+void memDmaCopy(Int16* dst, const Int16* src, Uint16 words)
+{
+    memcpy(dst, src, (size_t)words * sizeof(Int16));
+}
+
+void memDmaWait(void)
+{
+}
+
+#endif /* __TMS320C55X__ */
@@ -231,12 +231,16 @@ void oled_show_effect_step_name(int step)
         case 0:  name = "LOOPBACK";       break;
         case 1:  name = "REVERB HALL";    break;
         case 2:  name = "REVERB ROOM";    break;
-        case 3:  name = "REV STAGE + B";  break;
-        case 4:  name = "REV STAGE + D";  break;
-        case 5:  name = "REV STAGE + F";  break;
-        case 6:  name = "REV STAGE + GB"; break;
+        case 3:  name = "REV STAGE+B PV"; break;
+        case 4:  name = "REV STAGE+D SYN"; break;
+        case 5:  name = "REV STAGE+F SYN"; break;
+        case 6:  name = "REV STAGE+GB PV"; break;
         case 7:  name = "FLANGER";        break;
         case 8:  name = "TREMOLO";        break;
+        case 9:  name = "REV FDN HALL";   break;
+        case 10: name = "REV FDN ROOM";   break;
+        case 11: name = "REVERB PLATE";   break;
+        case 12: name = "REVERB CONV";    break;
         default: name = "LOOPBACK";       break;
     }
 
@@ -8,12 +8,8 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "pitch_shift.h"
-#include "dma.h"
-
-// Tamanho do Buffer fixo em Potência de 2 para velocidade máxima
-// 4096 garante espaço suficiente para janelas grandes se necessário
-#define PITCH_BUF_SIZE 4096
-#define PITCH_MASK     4095
+#include "fixed_point.h"
+#include "effects_controller.h"
 
 // Configuração da Janela
 // 2048 amostras @ 48kHz ~= 42ms (Bom equilíbrio voz/instrumentos)
@@ -24,25 +20,60 @@
 // 65536 >> 5 = 2048. Então o shift é 5.
 #define SHIFT_TO_DELAY_INT  5
 
-// Alocação na memória interna (DARAM) para acesso rápido
-Int16 pitchBuffer[PITCH_BUF_SIZE];
-
 PitchShifter g_pitch;
 
+// Limpeza em partes: canal e posição
+static Uint16 s_clearCh = PITCH_NUM_CHANNELS;
+static Uint16 s_clearPos = 0;
+
 // ---------------------------------------------------------------------------
 // Inicialização
 // ---------------------------------------------------------------------------
-void initPitchShift()
+void pitchShiftInitBegin(Uint8 mode)
 {
-    int i;
-    g_pitch.buffer = pitchBuffer;
+    // Buffers no slot PRE da arena (DARAM), separado do efeito principal
+    effectMemAcquire(EFFECT_SLOT_PRE, EFFECT_OWNER_PITCH);
+    g_pitch.mode = mode;
+    g_pitch.period = 0;
+    g_pitch.offset[0] = 0;
+    g_pitch.offset[1] = 0;
+    if (mode == PITCH_MODE_VOCODER) {
+        pitchVocoderInitBegin();
+        return;
+    }
+
+    g_pitch.buffer[0] = effectMemAlloc(EFFECT_SLOT_PRE, EFFECT_MEM_FAST, PITCH_BUF_SIZE);
+    g_pitch.buffer[1] = effectMemAlloc(EFFECT_SLOT_PRE, EFFECT_MEM_FAST, PITCH_BUF_SIZE);
     g_pitch.buffer_len = PITCH_BUF_SIZE;
     g_pitch.window_size = WINDOW_LEN;
 
     g_pitch.write_ptr = 0;
     g_pitch.phasor = 0;
 
-    for(i=0; i<PITCH_BUF_SIZE; i++) pitchBuffer[i] = 0;
+    s_clearCh = 0;
+    s_clearPos = 0;
+}
+
+Uint8 pitchShiftInitStep(Uint16 words)
+{
+    if (g_pitch.mode == PITCH_MODE_VOCODER) return pitchVocoderInitStep(words);
+
+    while (words > 0 && s_clearCh < PITCH_NUM_CHANNELS) {
+        words -= effectClearChunk(g_pitch.buffer[s_clearCh], PITCH_BUF_SIZE,
+                                  &s_clearPos, words);
+        if (s_clearPos >= PITCH_BUF_SIZE) {
+            s_clearCh++;
+            s_clearPos = 0;
+        }
+    }
+    return s_clearCh >= PITCH_NUM_CHANNELS;
+}
+
+void initPitchShift()
+{
+    pitchShiftInitBegin(PITCH_MODE_GRAIN);
+    while (!pitchShiftInitStep(PITCH_BUF_SIZE)) {
+    }
 
     // Inicia na frequência base (1.0x, sem efeito)
     setPitchFrequency(ROOT_FREQ_HZ);
@@ -53,34 +84,176 @@ void initPitchShift()
 // Fórmula: y = val + frac * (next - val)
 // Usamos aritmética inteira: (frac * diff) >> 15
 // ---------------------------------------------------------------------------
+// A diferença (next - val) é "int" de 16 bits no C55x e dá a volta.
 #define INTERPOLATE(val, next, frac) \
-    (val + ( (Int16)( ((Int32)(next - val) * frac) >> 15 ) ))
+    (val + ( (Int16)( ((Int32)C55_SUB16(next, val) * frac) >> 15 ) ))
+
+// ---------------------------------------------------------------------------
+// Macro: Janela Triangular sem desvio
+// ph < 32768 -> ph; ph >= 32768 -> 65535 - ph (== ~ph). Máximo 32767 (Q15).
+// ---------------------------------------------------------------------------
+#define TRI_GAIN(ph) \
+    ((Int16)(((ph) ^ (Uint16)((Int16)(ph) >> 15)) & 0x7FFF))
+
+// ---------------------------------------------------------------------------
+// Período (PITCH_MODE_GRAIN_SYNC), uma vez por bloco
+// ---------------------------------------------------------------------------
+// Vale da AMDF abaixo de 1/PITCH_SYNC_VOICED da média: sinal periódico.
+// Ruído e silêncio ficam acima.
+#define PITCH_SYNC_VOICED   3
+
+#if PITCH_SYNC_MAX_LAG + PITCH_SYNC_WINDOW > PITCH_SYNC_HIST
+#error "PITCH_SYNC_HIST não cobre o maior atraso da AMDF"
+#endif
+
+// Média L+R decimada, mais recente primeiro (128 palavras no .bss)
+static Int16 s_syncHist[PITCH_SYNC_HIST];
+
+static inline Int32 absDiff(Int32 a, Int32 b)
+{
+    Int32 d = a - b;
+    return d < 0 ? -d : d;
+}
+
+// Período em Q16 quadros (0 = nenhum) dos últimos quadros escritos
+static Uint32 pitchEstimatePeriod(void)
+{
+    const Int16* buffL = g_pitch.buffer[0];
+    const Int16* buffR = g_pitch.buffer[1];
+    Uint16 newest = (g_pitch.write_ptr - 1) & PITCH_MASK;
+    Int32 prev, best = 0, sum = 0;
+    Int32 before = -1, after = -1, frac;
+    Uint16 bestLag = 0;
+    Uint16 lag, lo, hi, period;
+    Uint16 i, j;
+
+    // 1. Decimação: média de PITCH_SYNC_DECIM quadros (L+R) por ponto
+    for (i = 0; i < PITCH_SYNC_HIST; i++) {
+        Int32 acc = 0;
+
+        for (j = 0; j < PITCH_SYNC_DECIM; j++) {
+            Uint16 idx = (newest - i * PITCH_SYNC_DECIM - j) & PITCH_MASK;
+            acc += (Int32)buffL[idx] + buffR[idx];
+        }
+        s_syncHist[i] = (Int16)(acc >> 4);      // / (2 * PITCH_SYNC_DECIM)
+    }
+
+    // 2. AMDF decimada a partir do atraso 1, como no YIN: o período é o
+    //    primeiro vale abaixo de 1/PITCH_SYNC_VOICED da média dos atrasos
+    //    já vistos. Os múltiplos do período (oitavas abaixo) têm vales tão
+    //    fundos quanto e ficam de fora; sem vale, o sinal não é periódico.
+    for (lag = 1; lag <= PITCH_SYNC_MAX_LAG; lag++) {
+        Int32 d = 0;
+
+        for (i = 0; i < PITCH_SYNC_WINDOW; i++) {
+            d += absDiff(s_syncHist[i], s_syncHist[i + lag]);
+        }
+        sum += d;
+        if (bestLag != 0) {
+            if (d >= best) break;               // Passou do fundo do vale
+            best = d;
+            bestLag = lag;
+        } else if (lag >= PITCH_SYNC_MIN_LAG && d * (lag * PITCH_SYNC_VOICED) < sum) {
+            best = d;
+            bestLag = lag;
+        }
+    }
+    if (bestLag == 0) return 0;
+
+    // 3. Refino amostra a amostra em volta do atraso decimado (pode passar
+    //    um pouco dos limites da AMDF decimada). A fração do período vem do
+    //    vértice do V pelos vizinhos do mínimo: a AMDF é |.|, não parábola.
+    lo = bestLag * PITCH_SYNC_DECIM - (PITCH_SYNC_DECIM - 1);
+    hi = bestLag * PITCH_SYNC_DECIM + (PITCH_SYNC_DECIM - 1);
+
+    period = 0;
+    prev = 0;
+    for (lag = lo; lag <= hi; lag++) {
+        Int32 d = 0;
+
+        for (i = 0; i < PITCH_SYNC_FINE_WINDOW; i++) {
+            Uint16 a = (newest - 2 * i) & PITCH_MASK;
+            Uint16 b = (a - lag) & PITCH_MASK;
+
+            d += absDiff((Int32)buffL[a] + buffR[a], (Int32)buffL[b] + buffR[b]);
+        }
+        if (lag == period + 1) after = d;
+        if (period == 0 || d < best) {
+            before = lag > lo ? prev : -1;
+            after = -1;
+            best = d;
+            period = lag;
+        }
+        prev = d;
+    }
+
+    frac = 0;
+    if (before >= 0 && after >= 0) {
+        Int32 num = before - after;
+        Int32 curve = (before > after ? before : after) - best;    // >= |num|
+
+        // Vértice em num / (2 * curve), |.| <= 1/2, em Q16
+        while (curve > 0xFFFF) {
+            num >>= 1;
+            curve >>= 1;
+        }
+        if (curve > 0) frac = (num * 32768L) / curve;
+    }
+    return ((Uint32)period << 16) + frac;
+}
+
+// Atraso extra (Q16) do grão que acabou de reiniciar: o menor >= 0 que o
+// deixa a um múltiplo do período do outro grão. Sem período, zero (o
+// reinício normal do modo de grãos).
+static Uint32 syncOffset(Uint32 phase, Uint32 otherDelay, Uint32 period)
+{
+    Int32 t = (Int32)period;
+    Int32 m;
+
+    if (period == 0) return 0;
+    m = (Int32)(otherDelay - (phase >> SHIFT_TO_DELAY_INT)) % t;
+    return (Uint32)(m < 0 ? m + t : m);
+}
 
 // ---------------------------------------------------------------------------
 // Processamento de Bloco Otimizado
+// Blocos planares, in-place. Phasor, ganhos e índices são calculados uma
+// vez por quadro; cada canal lê o seu próprio buffer circular.
 // ---------------------------------------------------------------------------
-void processAudioPitchShift(Uint16* rxBlock, Uint16* txBlock)
+void processAudioPitchShift(Int16* left, Int16* right, Uint16 frames)
 {
     int i;
 
+    if (g_pitch.mode == PITCH_MODE_VOCODER) {
+        processAudioPitchVocoder(left, right, frames);
+        return;
+    }
+
     // Cache de registradores (Evita ler a struct na memória a cada loop)
-    Int16* buff = g_pitch.buffer;
+    Int16* buffL = g_pitch.buffer[0];
+    Int16* buffR = g_pitch.buffer[1];
     Uint16 w_ptr = g_pitch.write_ptr;
     Uint32 phas = g_pitch.phasor;
     Int32  d_rate = g_pitch.delay_rate;
+    Uint32 offA = g_pitch.offset[0];
+    Uint32 offB = g_pitch.offset[1];
+    Uint8  sync = (g_pitch.mode == PITCH_MODE_GRAIN_SYNC);
+    Uint32 period = 0;
+
+    if (sync) period = g_pitch.period = pitchEstimatePeriod();
 
     // Offset de 180 graus para o ponteiro B (0.5 em Q32 é 0x80000000)
     Uint32 pB_offset = 0x80000000;
 
-    for (i = 0; i < AUDIO_BLOCK_SIZE; i++) {
-        Int16 input = (Int16)rxBlock[i];
-        Int32 outputAccum;
+    for (i = 0; i < frames; i++) {
+        Int16 valA, valB;
 
-        // 1. Escreve Entrada no Buffer Circular
-        buff[w_ptr] = input;
+        // 1. Escreve Entrada nos Buffers Circulares
+        buffL[w_ptr] = left[i];
+        buffR[w_ptr] = right[i];
 
         // ====================================================================
-        // CANAL A (Grão 1)
+        // GRÃO A
         // ====================================================================
         // Pega os 16 bits superiores do Phasor (0..65535)
         Uint16 phA_high = phas >> 16;
@@ -88,66 +261,78 @@ void processAudioPitchShift(Uint16* rxBlock, Uint16* txBlock)
         // --- Cálculo de Ganho (Janela Triangular) ---
         // Sobe de 0 a 32767, depois desce de 32767 a 0.
         // O valor máximo 32767 representa Ganho 1.0 em Q15.
-        Uint16 rawGainA = (phA_high < 32768) ? phA_high : (65535 - phA_high);
-        // Saturação de segurança (evita -32768)
-        Int16 gainA = (rawGainA > 32767) ? 32767 : (Int16)rawGainA;
+        Int16 gainA = TRI_GAIN(phA_high);
 
         // --- Cálculo de Delay com Fração ---
-        // Delay Inteiro: Bits superiores convertidos para o tamanho da janela
-        Int16 delayIntA = phA_high >> SHIFT_TO_DELAY_INT;
+        // Phasor convertido para o tamanho da janela em Q16 amostras, mais
+        // o atraso extra do grão (zero fora do PITCH_MODE_GRAIN_SYNC)
+        Uint32 delayA = (phas >> SHIFT_TO_DELAY_INT) + offA;
+
+        // Delay Inteiro: Bits superiores
+        Int16 delayIntA = delayA >> 16;
 
-        // Delay Fracionário: Bits inferiores (máscara 0x7FFF pegando bits [20:6])
+        // Delay Fracionário: Bits inferiores (máscara 0x7FFF pegando bits [15:1])
         // Isso nos dá a precisão "entre" as amostras para a interpolação.
-        Int16 fracA = (phas >> 6) & 0x7FFF;
+        Int16 fracA = (delayA >> 1) & 0x7FFF;
 
-        // ndices de Leitura no Buffer
+        // Índices de Leitura no Buffer
         // idx0 é a amostra base. idx1 é a anterior (para onde o delay fracionário aponta).
         Int16 idxA0 = (w_ptr - delayIntA) & PITCH_MASK;
         Int16 idxA1 = (idxA0 - 1) & PITCH_MASK;
 
-        // Leitura interpolada do Buffer
-        Int16 valA = INTERPOLATE(buff[idxA0], buff[idxA1], fracA);
-
         // ====================================================================
-        // CANAL B (Grão 2 - Defasado 180 graus)
+        // GRÃO B (Defasado 180 graus)
         // ====================================================================
         Uint32 phasB = phas + pB_offset;
         Uint16 phB_high = phasB >> 16;
 
-        Uint16 rawGainB = (phB_high < 32768) ? phB_high : (65535 - phB_high);
-        Int16 gainB = (rawGainB > 32767) ? 32767 : (Int16)rawGainB;
+        Int16 gainB = TRI_GAIN(phB_high);
 
-        Int16 delayIntB = phB_high >> SHIFT_TO_DELAY_INT;
-        Int16 fracB = (phasB >> 6) & 0x7FFF;
+        Uint32 delayB = (phasB >> SHIFT_TO_DELAY_INT) + offB;
+        Int16 delayIntB = delayB >> 16;
+        Int16 fracB = (delayB >> 1) & 0x7FFF;
 
         Int16 idxB0 = (w_ptr - delayIntB) & PITCH_MASK;
         Int16 idxB1 = (idxB0 - 1) & PITCH_MASK;
 
-        Int16 valB = INTERPOLATE(buff[idxB0], buff[idxB1], fracB);
-
         // ====================================================================
-        // MIXAGEM (Crossfade)
+        // LEITURA INTERPOLADA + MIXAGEM (Crossfade)
         // ====================================================================
-        // Soma ponderada usando acumulador de 32 bits para evitar overflow.
-        // Shift >> 15 normaliza o ganho Q15 * Q15 de volta para Q15.
+        // Soma ponderada Q15 * Q15 -> Q15 com saturação (Hard Limiter).
         // Como gainA + gainB soma ~1.0, o volume de saída é unitário (igual à entrada).
 
-        outputAccum = ((Int32)valA * gainA >> 15) + ((Int32)valB * gainB >> 15);
-
-        // Saturação Final (Hard Limiter) para converter de volta a 16 bits
-        if (outputAccum > 32767) outputAccum = 32767;
-        else if (outputAccum < -32768) outputAccum = -32768;
+        // ESQ
+        valA = INTERPOLATE(buffL[idxA0], buffL[idxA1], fracA);
+        valB = INTERPOLATE(buffL[idxB0], buffL[idxB1], fracB);
+        left[i] = q15_add(q15_mul(valA, gainA), q15_mul(valB, gainB));
 
-        txBlock[i] = (Uint16)outputAccum;
+        // DIR
+        valA = INTERPOLATE(buffR[idxA0], buffR[idxA1], fracA);
+        valB = INTERPOLATE(buffR[idxB0], buffR[idxB1], fracB);
+        right[i] = q15_add(q15_mul(valA, gainA), q15_mul(valB, gainB));
 
-        // 3. Atualiza Ponteiros
+        // 3. Atualiza Ponteiros (uma vez por quadro)
         w_ptr = (w_ptr + 1) & PITCH_MASK;
         phas += d_rate;
+
+        // 4. Reinício de grão (o bit 31 do phasor virou): A quando o phasor
+        //    dá a volta, B na metade. No modo sincronizado o grão novo fica
+        //    a um múltiplo do período do outro. Raro: duas vezes por janela.
+        if (sync && ((phas ^ (phas - d_rate)) & 0x80000000)) {
+            phasB = phas + pB_offset;
+            if ((phas >> 31) == (d_rate < 0)) {
+                offA = syncOffset(phas, (phasB >> SHIFT_TO_DELAY_INT) + offB, period);
+            } else {
+                offB = syncOffset(phasB, (phas >> SHIFT_TO_DELAY_INT) + offA, period);
+            }
+        }
     }
 
     // Salva estado de volta na estrutura global
     g_pitch.write_ptr = w_ptr;
     g_pitch.phasor = phas;
+    g_pitch.offset[0] = offA;
+    g_pitch.offset[1] = offB;
 }
 
 // Stub para compatibilidade (caso chamem a função antiga)
@@ -166,6 +351,7 @@ void setPitchFrequency(float target_freq)
     float delay_rate_f = (1.0f - ratio) / (float)WINDOW_LEN;
 
     // Converte float para Ponto Fixo Q32
-    // Multiplica por 2^32 (4294967296.0)
-    g_pitch.delay_rate = (Int32)(delay_rate_f * 4294967296.0f);
+    // Multiplica por 2^32 (4294967296.0). A ISR aplica no próximo bloco:
+    // a escrita de 32 bits não é atômica e não pode cair no meio de um.
+    effectParamsSetPitchRate((Int32)(delay_rate_f * 4294967296.0f));
 }
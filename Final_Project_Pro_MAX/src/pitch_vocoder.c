@@ -0,0 +1,341 @@
+//////////////////////////////////////////////////////////////////////////////
+// pitch_vocoder.c - Vocoder de fase para o pitch shift (ver pitch_vocoder.h)
+//////////////////////////////////////////////////////////////////////////////
+
+#include "pitch_vocoder.h"
+#include "pitch_shift.h"
+#include "fft.h"
+#include "fixed_point.h"
+#include "effects_controller.h"
+#include "dma.h"
+
+#if PV_HOP != AUDIO_BLOCK_FRAMES || PV_FFT_POINTS != 4 * PV_HOP
+#error "PV_HOP deve ser o bloco de áudio e um quarto da janela"
+#endif
+#if PV_FFT_POINTS > FFT_MAX_POINTS
+#error "PV_FFT_POINTS passa de FFT_MAX_POINTS"
+#endif
+
+#define PV_FFT_LOG2       10
+
+// Avanço de fase do bin k em um hop, em voltas Q16: k * H / N = k / 4
+#define BIN_ADVANCE       16384u
+
+// Razão Q14 (16384 = 1.0) a partir da taxa do modo de grãos:
+// delay_rate = (1 - razão) * 2^32 / 2048 = (1 - razão) * 2^21
+#define RATIO_ONE         16384L
+#define RATIO_MAX         (4 * RATIO_ONE)
+#define RATE_TO_RATIO_SHIFT  7
+
+// Hann x Hann com 75% de sobreposição soma 1.5: saída * 2/3 (Q15)
+#define OLA_GAIN          21845
+
+#define CORDIC_STEPS      14
+#define CORDIC_PRESHIFT   6
+#define CORDIC_INV_GAIN   19898     // 1 / 1.6468 em Q15
+
+PitchVocoder g_pitchVocoder;
+
+// atan(2^-i) em voltas Q16
+static const Uint16 s_atan[CORDIC_STEPS] = {
+    8192, 4836, 2555, 1297, 651, 326, 163, 81, 41, 20, 10, 5, 3, 1
+};
+
+// Limpeza em partes: 8 buffers (in, ola, fases) e posição
+#define CLEAR_BUFFERS     (4 * PV_NUM_CHANNELS)
+
+static Uint16 s_clearBuf = CLEAR_BUFFERS;
+static Uint16 s_clearPos = 0;
+
+// ---------------------------------------------------------------------------
+// Inicialização
+// ---------------------------------------------------------------------------
+void pitchVocoderInitBegin(void)
+{
+    PitchVocoder* v = &g_pitchVocoder;
+    Int16 c, s;
+    Uint16 ch, t;
+
+    for (ch = 0; ch < PV_NUM_CHANNELS; ch++) {
+        v->in[ch]    = effectMemAlloc(EFFECT_SLOT_PRE, EFFECT_MEM_FAST, PV_FFT_POINTS);
+        v->ola[ch]   = effectMemAlloc(EFFECT_SLOT_PRE, EFFECT_MEM_FAST, PV_FFT_POINTS);
+        v->phase[ch] = (Uint16*)effectMemAlloc(EFFECT_SLOT_PRE, EFFECT_MEM_FAST, PV_BINS);
+        v->synth[ch] = (Uint16*)effectMemAlloc(EFFECT_SLOT_PRE, EFFECT_MEM_FAST, PV_BINS);
+    }
+    v->work = effectMemAlloc(EFFECT_SLOT_PRE, EFFECT_MEM_FAST, PV_FFT_POINTS);
+    v->hann = effectMemAlloc(EFFECT_SLOT_PRE, EFFECT_MEM_FAST, PV_HANN_WORDS);
+
+    // Hann periódica: (1 - cos(2 pi t / N)) / 2, simétrica em N/2
+    fftInit();
+    for (t = 0; t <= PV_BINS; t++) {
+        fftCosSin((Uint16)(t << (16 - PV_FFT_LOG2)), &c, &s);
+        v->hann[t] = (Int16)(((Int32)32767 - c + 1) >> 1);
+    }
+
+    v->base = 0;
+    v->pos = 0;
+
+    s_clearBuf = 0;
+    s_clearPos = 0;
+}
+
+Uint8 pitchVocoderInitStep(Uint16 words)
+{
+    PitchVocoder* v = &g_pitchVocoder;
+
+    while (words > 0 && s_clearBuf < CLEAR_BUFFERS) {
+        Uint16 ch = s_clearBuf % PV_NUM_CHANNELS;
+        Uint16 kind = s_clearBuf / PV_NUM_CHANNELS;
+        Int16* buf;
+        Uint16 len = kind < 2 ? PV_FFT_POINTS : PV_BINS;
+
+        switch (kind) {
+            case 0:  buf = v->in[ch];           break;
+            case 1:  buf = v->ola[ch];          break;
+            case 2:  buf = (Int16*)v->phase[ch]; break;
+            default: buf = (Int16*)v->synth[ch]; break;
+        }
+        words -= effectClearChunk(buf, len, &s_clearPos, words);
+        if (s_clearPos >= len) {
+            s_clearBuf++;
+            s_clearPos = 0;
+        }
+    }
+    return s_clearBuf >= CLEAR_BUFFERS;
+}
+
+// ---------------------------------------------------------------------------
+// Análise e síntese de um hop
+// ---------------------------------------------------------------------------
+
+static inline Int16 hannAt(const PitchVocoder* v, Uint16 t)
+{
+    return v->hann[t <= PV_BINS ? t : PV_FFT_POINTS - t];
+}
+
+// Módulo / 2 e fase (voltas Q16) de re + j im, CORDIC em modo vetorial
+static void cordic(Int16 re, Int16 im, Int16* mag, Uint16* phase)
+{
+    Int32 x = (Int32)re * (1L << CORDIC_PRESHIFT);
+    Int32 y = (Int32)im * (1L << CORDIC_PRESHIFT);
+    Uint16 ph = 0;
+    Uint16 i;
+
+    // Semiplano esquerdo: gira meia volta
+    if (x < 0) {
+        x = -x;
+        y = -y;
+        ph = 32768u;
+    }
+    for (i = 0; i < CORDIC_STEPS; i++) {
+        Int32 xs = x >> i;
+
+        if (y > 0) {
+            x += y >> i;
+            y -= xs;
+            ph += s_atan[i];
+        } else {
+            x -= y >> i;
+            y += xs;
+            ph -= s_atan[i];
+        }
+    }
+    // |x| < 2^23: o produto cabe em 32 bits; módulo / 2 < 23170
+    *mag = (Int16)(((x >> CORDIC_PRESHIFT) * CORDIC_INV_GAIN) >> 16);
+    *phase = ph;
+}
+
+// Para onde o bin k sobe (bins 1..PV_BINS-1): para o vizinho de módulo
+// maior; 0 se k é um pico
+#define CLIMB_PEAK    0
+#define CLIMB_DOWN    1
+#define CLIMB_UP      2
+
+static inline Uint16 climbOf(const Int16* w, Uint16 k)
+{
+    Int16 m = w[2 * k];
+    Int16 lo = k > 1 ? w[2 * k - 2] : -1;
+    Int16 hi = k < PV_BINS - 1 ? w[2 * k + 2] : -1;
+
+    if (lo <= m && hi <= m) return CLIMB_PEAK;
+    return lo > hi ? CLIMB_DOWN : CLIMB_UP;
+}
+
+// Bin remapeado em 'dst': soma o módulo se já houver um bin lá e fica com
+// a fase do mais forte
+static inline void binMerge(Int16* dst, Int16 mag, Uint16 phase, int fresh)
+{
+    if (fresh) {
+        dst[0] = mag;
+        dst[1] = (Int16)phase;
+        return;
+    }
+    if (mag > dst[0]) dst[1] = (Int16)phase;
+    dst[0] = q15_add(dst[0], mag);
+}
+
+// Desloca o bin k de work[2k+1] bins; sai work[2k] = módulo, work[2k+1] =
+// fase de síntese (synth[k] da origem). O deslocamento só cresce com k
+// quando a razão é >= 1 (e só diminui quando é < 1): in-place, o laço
+// desce no primeiro caso e sobe no segundo, sem ler um bin já escrito.
+// 'edge' é o último destino novo; bins entre dois destinos ficam vazios.
+static void remapBins(Int16* w, const Uint16* synth, Int32 ratio)
+{
+    Int16 k, j, edge;
+    Int16 mag;
+
+    if (ratio >= RATIO_ONE) {
+        edge = PV_BINS;
+        for (k = PV_BINS - 1; k >= 1; k--) {
+            j = k + w[2 * k + 1];
+            if (j >= PV_BINS) continue;
+            mag = w[2 * k];
+            if (j < edge) {
+                while (--edge > j) w[2 * edge] = w[2 * edge + 1] = 0;
+                binMerge(&w[2 * j], mag, synth[k], 1);
+            } else {
+                binMerge(&w[2 * j], mag, synth[k], 0);
+            }
+        }
+        while (--edge >= 1) w[2 * edge] = w[2 * edge + 1] = 0;
+    } else {
+        edge = 0;
+        for (k = 1; k < PV_BINS; k++) {
+            j = k + w[2 * k + 1];
+            if (j < 1) continue;
+            mag = w[2 * k];
+            if (j > edge) {
+                while (++edge < j) w[2 * edge] = w[2 * edge + 1] = 0;
+                binMerge(&w[2 * j], mag, synth[k], 1);
+            } else {
+                binMerge(&w[2 * j], mag, synth[k], 0);
+            }
+        }
+        while (++edge < PV_BINS) w[2 * edge] = w[2 * edge + 1] = 0;
+    }
+}
+
+static void vocoderHop(PitchVocoder* v, Uint16 ch, Int32 ratio)
+{
+    Int16* w = v->work;
+    const Int16* in = v->in[ch];
+    Int16* ola = v->ola[ch];
+    Uint16* phase = v->phase[ch];
+    Uint16* synth = v->synth[ch];
+    Int16 e1, e2, shift, mag, c, s;
+    Uint16 t, k, p, ph;
+    Int32 round;
+
+    // 1. Janela nos últimos N quadros (o mais antigo está em base)
+    for (t = 0; t < PV_FFT_POINTS; t++) {
+        w[t] = q15_mul_r(in[(v->base + t) & PV_FFT_MASK], hannAt(v, t));
+    }
+    e1 = fftRealForward(w, PV_FFT_POINTS);
+
+    // 2. Módulo / 2 e avanço de fase desde o último hop, já multiplicado
+    // pela razão; phase[] passa a ter a fase deste hop. DC fica (na mesma
+    // escala), Nyquist sai.
+    w[0] >>= 1;
+    w[1] = 0;
+    for (k = 1; k < PV_BINS; k++) {
+        Int16 dev;
+
+        cordic(w[2 * k], w[2 * k + 1], &mag, &ph);
+        dev = (Int16)(Uint16)(ph - phase[k] - k * BIN_ADVANCE);
+        phase[k] = ph;
+        w[2 * k] = mag;
+        w[2 * k + 1] = (Int16)(Uint16)((Uint32)k * (Uint32)ratio +
+                                       (Uint32)(((Int32)dev * ratio) >> 14));
+    }
+
+    // 3. Travamento nos picos (Laroche-Dolson): cada pico leva consigo os
+    // bins ao redor. A fase de síntese do pico avança pela frequência nova
+    // e os vizinhos mantêm a diferença de fase que tinham para ele; todos
+    // são deslocados de round(pico * razão) - pico bins, e a forma da
+    // janela não se perde. work[2k+1] passa a ser o deslocamento.
+    for (k = 1; k < PV_BINS; k++) {
+        if (climbOf(w, k) == CLIMB_PEAK) synth[k] += (Uint16)w[2 * k + 1];
+    }
+
+    // Pico de cada bin em work[2k+1], em duas passadas: quem desce herda o
+    // pico do bin de baixo (já resolvido: não sobe de volta), quem sobe o
+    // do bin de cima
+    for (k = 1; k < PV_BINS; k++) {
+        switch (climbOf(w, k)) {
+            case CLIMB_PEAK: w[2 * k + 1] = (Int16)k;    break;
+            case CLIMB_DOWN: w[2 * k + 1] = w[2 * k - 1]; break;
+            default:         break;
+        }
+    }
+    for (k = PV_BINS - 1; k >= 1; k--) {
+        if (climbOf(w, k) == CLIMB_UP) w[2 * k + 1] = w[2 * k + 3];
+    }
+
+    for (k = 1; k < PV_BINS; k++) {
+        p = (Uint16)w[2 * k + 1];
+        if (p != k) synth[k] = synth[p] + phase[k] - phase[p];
+        w[2 * k + 1] = (Int16)((((Int32)p * ratio + (RATIO_ONE / 2)) >> 14) - p);
+    }
+
+    // 4. Bins na frequência nova e espectro de saída
+    remapBins(w, synth, ratio);
+    for (k = 1; k < PV_BINS; k++) {
+        mag = w[2 * k];
+        fftCosSin((Uint16)w[2 * k + 1], &c, &s);
+        w[2 * k]     = (Int16)(((Int32)mag * c) >> 15);
+        w[2 * k + 1] = (Int16)(((Int32)mag * s) >> 15);
+    }
+    e2 = fftRealInverse(w, PV_FFT_POINTS);
+
+    // 5. Saída = w * 2^(e1 + 1 + e2 - log2 N), janela e 2/3. Com a entrada
+    // em 16 bits os espectros ficam abaixo de 2^25 e shift >= 2; o limite
+    // de baixo só protege o arredondamento.
+    shift = 15 - (e1 + e2 + 1 - PV_FFT_LOG2);
+    if (shift < 1) shift = 1;
+    if (shift > 30) return;                 // Abaixo do LSB
+    round = 1L << (shift - 1);
+    for (t = 0; t < PV_FFT_POINTS; t++) {
+        Int32 y = (Int32)q15_mul_r(w[t], hannAt(v, t)) * OLA_GAIN;
+        Uint16 i = (v->base + t) & PV_FFT_MASK;
+
+        ola[i] = q15_add(ola[i], q15_sat((y + round) >> shift));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Processamento de bloco: planar, in-place, PV_FFT_POINTS quadros de atraso
+// ---------------------------------------------------------------------------
+void processAudioPitchVocoder(Int16* left, Int16* right, Uint16 frames)
+{
+    PitchVocoder* v = &g_pitchVocoder;
+    Int16* inL = v->in[0];
+    Int16* inR = v->in[1];
+    Int16* olaL = v->ola[0];
+    Int16* olaR = v->ola[1];
+    Uint16 pos = v->pos;
+    Uint16 i;
+
+    for (i = 0; i < frames; i++) {
+        Uint16 n = (v->base + pos) & PV_FFT_MASK;
+
+        inL[n] = left[i];
+        inR[n] = right[i];
+        left[i]  = olaL[n];
+        right[i] = olaR[n];
+        olaL[n] = 0;
+        olaR[n] = 0;
+
+        if (++pos == PV_HOP) {
+            Int32 ratio = RATIO_ONE - (g_pitch.delay_rate >> RATE_TO_RATIO_SHIFT);
+
+            if (ratio < 0) ratio = 0;
+            if (ratio > RATIO_MAX) ratio = RATIO_MAX;
+
+            v->base = (v->base + PV_HOP) & PV_FFT_MASK;
+            pos = 0;
+            vocoderHop(v, 0, ratio);
+            vocoderHop(v, 1, ratio);
+        }
+    }
+    v->pos = pos;
+}
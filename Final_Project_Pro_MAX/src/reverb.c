@@ -3,297 +3,1185 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "reverb.h"
+#include "fixed_point.h"
+#include "dma.h"
+#include "mem_dma.h"
+#include "effects_controller.h"
+#include "reverb_presets.h"     // REVERB_PRESETS (gerado)
+
+// Maior trecho processado de uma vez (um bloco de DMA por canal)
+#define REVERB_CHUNK   AUDIO_BLOCK_FRAMES
+
+#if REVERB_WINDOW_LEN != AUDIO_BLOCK_FRAMES
+#error "REVERB_WINDOW_LEN (reverb.h) deve ser igual a AUDIO_BLOCK_FRAMES"
+#endif
+
+// --- POOLS NA ARENA DE EFEITOS (slot principal) ---
+// Linhas longas na CE0; all-pass, combs curtos e janelas de DMA na DARAM.
+// Bancos e pools so divididos entre o preset atual e o prximo (ou a
+// cauda do anterior): cada Reverb marca os seus em banks e pool.
+static Int16* g_reverbMemory[REVERB_MEM_BANKS];         // Bancos da CE0
+static Int16* g_reverbFastMemory[REVERB_FAST_POOLS];    // REVERB_FAST_MEM_SIZE cada
+static Int16* s_combWindow;              // REVERB_WINDOW_WORDS palavras (do atual)
+
+#define REVERB_BANKS_ALL   ((Uint8)((1u << REVERB_MEM_BANKS) - 1u))
+
+// Linhas com janela de DMA: combs L e R (Schroeder), linhas da FDN ou
+// atrasos e all-pass fixos do tanque do plate
+#define REVERB_MAX_LINES   (2 * REVERB_NUM_COMBS)
+#define PLATE_LINES        (2 * (REVERB_PLATE_TANK_LINES - 1))
+
+#if REVERB_FDN_LINES > REVERB_MAX_LINES || PLATE_LINES > REVERB_MAX_LINES
+#error "As janelas de DMA (REVERB_WINDOW_WORDS) no cobrem as linhas da FDN/plate"
+#endif
+
+#if REVERB_MEM_BANKS > 8
+#error "Reverb.banks tem um bit por banco: no mximo 8 bancos"
+#endif
 
-#define FS_FLOAT 48000.0f
+Reverb       g_reverb;
 
-// --- POOL DE MEMRIA NICO ---
-#pragma DATA_SECTION(g_reverbMemory, "effectsMem")
-#pragma DATA_ALIGN(g_reverbMemory, 4)
-static Int16 g_reverbMemory[REVERB_MEM_SIZE];
+// Troca de preset: o prximo (montado pelo main loop) e a cauda do
+// anterior (s a ISR mexe depois da troca)
+static Reverb s_reverbNext;
+static Reverb s_reverbTail;
 
-Reverb       g_reverb;
+static volatile Uint8 s_tailActive = 0;     // Escrito s pela ISR (e no init)
+static volatile Uint8 s_tailCutReq = 0;     // Pedido do main loop
+static Uint16 s_tailGain  = 32767;          // Rampa do corte (Q15)
+static Uint16 s_tailQuiet = 0;              // Quadros seguidos abaixo do piso
+static Uint16 s_tailHold  = 0;              // Quadros exigidos (linha mais longa)
+
+// Rampa do dry na troca: os presets tm dry_gain diferentes
+static Int16  s_dryFrom = 0;                        // dry_gain do anterior
+static Uint16 s_dryPos  = EFFECT_XFADE_FRAMES;      // Quadros j na rampa
+
+// Scratch do processamento por bloco (DARAM): soma dos combs e sinal wet
+#pragma DATA_ALIGN(s_combAcc, 4)
+static Int32 s_combAcc[REVERB_CHUNK];
+
+#pragma DATA_ALIGN(s_wetBlock, 4)
+static Int16 s_wetBlock[REVERB_CHUNK];
+
+// Sada da cauda (L, R) antes da soma
+#pragma DATA_ALIGN(s_tailLeft, 4)
+static Int16 s_tailLeft[REVERB_CHUNK];
+
+#pragma DATA_ALIGN(s_tailRight, 4)
+static Int16 s_tailRight[REVERB_CHUNK];
+
+// Entrada de cada metade do tanque do plate
+#pragma DATA_ALIGN(s_plateHalf, 4)
+static Int16 s_plateHalf[2][REVERB_CHUNK];
 
 // Preset padro
 ReverbPreset g_reverbPreset = REVERB_PRESET_ROOM_2;
 
-// --- Estrutura de Presets ---
-typedef struct {
-    float comb_ms[REVERB_NUM_COMBS];
-    float ap_ms[REVERB_NUM_ALLPASSES];
+// Limpeza em partes: linhas com realimentao, primeira janela de cada
+// uma e as outras linhas (all-pass; no plate, difusores e all-pass
+// modulados)
+#define CLEAR_OTHERS    (REVERB_PLATE_DIFFUSERS + 2)
+#define CLEAR_REGIONS   (2 * REVERB_MAX_LINES + CLEAR_OTHERS)
 
-    float comb_gains[REVERB_NUM_COMBS];
-    float ap_gains[REVERB_NUM_ALLPASSES];
+#if CLEAR_OTHERS < 2 * REVERB_NUM_ALLPASSES
+#error "CLEAR_OTHERS no cobre os all-pass"
+#endif
 
-    float wet_gain;
-    float dry_gain;
+static Reverb* s_clearTarget = &g_reverb;
+static Uint16 s_clearRegion = CLEAR_REGIONS;
+static Uint16 s_clearPos = 0;
 
-    // Damping (lowpass por shift) para os combs:
-    // 0 = sem damping. 2..6 recomendado.
-    Uint8 comb_damp_shift;
-} ReverbPresetCfg;
+// Incio de uma linha do preset na memria (posio fixa, gerada);
+// 'map' leva o banco do preset ao banco da arena
+static Int16* lineBuffer(const ReverbLineLayout* l, const Uint8* map, Uint8 pool)
+{
+    return l->ext ? &g_reverbMemory[map[l->bank]][l->offset]
+                  : &g_reverbFastMemory[pool][l->offset];
+}
 
-// -------------------- Presets --------------------
-// ROOM 2 foi ajustado para:
-// - delays menores (mais "room", menos "hall")
-// - feedback menor (decay mais controlado)
-// - damping (menos metlico)
-// - wet menor e dry um pouco reduzido (mix melhor)
-static const ReverbPresetCfg REVERB_PRESETS[REVERB_PRESET_COUNT] = {
+// Linha com espao para duas janelas  frente do ponteiro: o prefetch da
+// prxima janela no alcana o trecho que o bloco atual vai escrever
+static int combUsesWindow(Uint16 samples)
+{
+    return samples >= 2u * REVERB_CHUNK;
+}
 
-   // REV-HALL (ajustado para ficar mais parecido com o 01.wav)
-    {
-   // comb_ms (pequenos ajustes para quebrar ressonncias / ficar mais natural)
-       { 24.90f, 29.35f, 41.70f, 34.10f },
+// Copia buffer[pos..pos+n) circular <-> janela linear (1 ou 2 cpias)
+static void combLineToWindow(const CombFilter* c, Uint16 pos, Int16* win, Uint16 n)
+{
+    Uint16 run = c->delay_samples - pos;
 
-   // all-pass (mantm difuso, mas com menos brilho de anel)
-       { 2.20f, 6.40f },
+    if (run > n) run = n;
+    memDmaCopy(win, &c->buffer[pos], run);
+    memDmaCopy(win + run, c->buffer, n - run);
+}
 
-   // comb_gains (reduz RT/cauda e evita sustento demais)
-       { 0.70f, 0.78f, 0.73f, 0.75f },
+static void combWindowToLine(const CombFilter* c, Uint16 pos, const Int16* win, Uint16 n)
+{
+    Uint16 run = c->delay_samples - pos;
 
-   // ap_gains (um pouco menor para reduzir ringing)
-       { 0.60f, 0.58f },
+    if (run > n) run = n;
+    memDmaCopy(&c->buffer[pos], win, run);
+    memDmaCopy(c->buffer, win + run, n - run);
+}
 
-   // wet_gain (mais prximo do seu udio: presente, mas sem afogar)
-       0.38f,
-       1.00f,  // dry_gain (para manter ataque igual ao seu)
-       0      // comb_damp_shift = 0 (DESLIGADO -> mantm o timbre)
-     },
+// Inicializa um nico ncleo de Reverb (Canal L = 0 ou R = 1), sem janelas
+static void initReverbCore(ReverbCore* core, const ReverbPresetLayout* p, int ch,
+                           const Uint8* map, Uint8 pool)
+{
+    int i;
 
-     // ROOM 2:
-     {
-         { 200.0f, 300.0f, 400.0f, 500.0f },  // comb_ms
-         { 7.06f, 6.46f },                    // all-pass_ms
-         { 0.50f, 0.48f, 0.56f, 0.44f },      // comb_gains
-         { 0.716f, 0.613f },                  // ap_gains
-         0.2f                                  // wet_gain
-     },
+    // Configura Comb Filters
+    for (i = 0; i < REVERB_NUM_COMBS; i++) {
+        const ReverbLineLayout* l = &p->comb[ch][i];
+        CombFilter* c = &core->comb[i];
+        Uint16 samples = l->delay_samples;
 
-    // REV-STAGE
-     {
-        { 46.27f, 39.96f, 28.03f, 51.85f },
-        { 3.50f, 1.20f },
-        { 0.758f, 0.854f, 0.796f, 0.825f },
-        { 0.70f,  0.70f },
-        0.50f,
-        1.00f,
-        4
+        c->buffer        = lineBuffer(l, map, pool);
+        c->delay_samples = samples;
+        c->gain_Q15      = l->gain_Q15;
+        c->ptr           = 0;
+
+        // Damping
+        c->damp_shift = p->comb_damp_shift;
+        c->damp_state = 0;
+
+        c->windowed  = (Uint8)(l->ext && combUsesWindow(samples));
+        c->window[0] = c->window[1] = (Int16*)0;
+        c->winCur    = 0;
     }
-};
 
-// -------------------- Helpers --------------------
+    // Configura All-Pass Filters
+    for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
+        const ReverbLineLayout* l = &p->allpass[ch][i];
+        AllPassFilter* ap = &core->allpass[i];
 
-static inline Int16 sat16(Int32 x) {
-    if (x > 32767)  return 32767;
-    if (x < -32768) return -32768;
-    return (Int16)x;
+        ap->buffer        = lineBuffer(l, map, pool);
+        ap->delay_samples = l->delay_samples;
+        ap->gain_Q15      = l->gain_Q15;
+        ap->ptr           = 0;
+    }
 }
 
-static Int16 floatToQ15(float x) {
-    if (x >= 1.0f)  return 32767;
-    if (x <= -1.0f) return -32768;
-    return (Int16)(x * 32768.0f);
+// Linhas da FDN: combs sem sada prpria, a realimentao passa pela matriz
+static void initFdnLines(Reverb* r, const ReverbPresetLayout* p,
+                         const Uint8* map, Uint8 pool)
+{
+    int i;
+
+    for (i = 0; i < REVERB_FDN_LINES; i++) {
+        const ReverbLineLayout* l = &p->fdn[i];
+        CombFilter* c = &r->fdn[i];
+
+        c->buffer        = lineBuffer(l, map, pool);
+        c->delay_samples = l->delay_samples;
+        c->gain_Q15      = l->gain_Q15;
+        c->ptr           = 0;
+        c->damp_shift    = p->fdn_damp_shift[i];
+        c->damp_state    = 0;
+        c->windowed      = (Uint8)(l->ext && combUsesWindow(l->delay_samples));
+        c->window[0]     = c->window[1] = (Int16*)0;
+        c->winCur        = 0;
+    }
 }
 
-static Uint16 msToSamples(float ms) {
-    // Executa s na init -> no pesa (float ok)
-    return (Uint16)(ms * (FS_FLOAT / 1000.0f));
+// Linha de atraso do tanque do plate (mesmos campos de um comb)
+static void initPlateLine(CombFilter* c, const ReverbLineLayout* l, Uint8 shift,
+                          const Uint8* map, Uint8 pool)
+{
+    c->buffer        = lineBuffer(l, map, pool);
+    c->delay_samples = l->delay_samples;
+    c->gain_Q15      = l->gain_Q15;
+    c->ptr           = 0;
+    c->damp_shift    = shift;
+    c->damp_state    = 0;
+    c->windowed      = (Uint8)(l->ext && combUsesWindow(l->delay_samples));
+    c->window[0]     = c->window[1] = (Int16*)0;
+    c->winCur        = 0;
 }
 
-static Int16* allocMemory(Uint16 size) {
-    Int16* ptr;
+// Plate: difusores no pool da DARAM, tanque na CE0
+static void initPlate(Reverb* r, const ReverbPresetLayout* p,
+                      const Uint8* map, Uint8 pool)
+{
+    int i, h;
+
+    for (i = 0; i < REVERB_PLATE_DIFFUSERS; i++) {
+        const ReverbLineLayout* l = &p->plate_diffuser[i];
+        AllPassFilter* ap = &r->plateDiffuser[i];
 
-    // Se faltar memria, NO "volta pro incio" (isso estraga o reverb).
-    // Em DSP limitado, melhor "clamp" e garantir estabilidade.
-    if ((Uint32)g_reverb.memAllocated + size > REVERB_MEM_SIZE) {
-        // Retorna NULL para o init reduzir o risco de crash
-        return (Int16*)0;
+        ap->buffer        = lineBuffer(l, map, pool);
+        ap->delay_samples = l->delay_samples;
+        ap->gain_Q15      = l->gain_Q15;
+        ap->ptr           = 0;
     }
 
-    ptr = &g_reverbMemory[g_reverb.memAllocated];
-    g_reverb.memAllocated += size;
-    return ptr;
+    for (h = 0; h < 2; h++) {
+        const ReverbLineLayout* l = p->plate_tank[h];
+        PlateTank* t = &r->plate[h];
+
+        t->mod.buffer        = lineBuffer(&l[REVERB_PLATE_MOD], map, pool);
+        t->mod.len           = l[REVERB_PLATE_MOD].delay_samples;
+        t->mod.depth         = p->plate_mod_depth;
+        t->mod.delay_samples = t->mod.len - t->mod.depth - 1;
+        t->mod.gain_Q15      = l[REVERB_PLATE_MOD].gain_Q15;
+        t->mod.ptr           = 0;
+        t->mod.phase         = (Uint32)h << 31;     // LFOs em oposio
+        t->mod.phase_inc     = p->plate_mod_inc;
+
+        initPlateLine(&t->delay1,  &l[REVERB_PLATE_DELAY1], p->plate_damp_shift, map, pool);
+        initPlateLine(&t->allpass, &l[REVERB_PLATE_AP],     0, map, pool);
+        initPlateLine(&t->delay2,  &l[REVERB_PLATE_DELAY2], 0, map, pool);
+
+        for (i = 0; i < REVERB_PLATE_TAPS; i++) r->plateTap[h][i] = p->plate_tap[h][i];
+    }
 }
 
-// Inicializa um nico ncleo de Reverb (Canal L ou R)
-// use_spread: 1 para adicionar o spread (Canal R), 0 para normal (Canal L)
-static void initReverbCore(ReverbCore* core, const ReverbPresetCfg* p, int use_spread)
+// Monta 'r' com o preset 'preset' nos primeiros bancos de 'freeBanks' e
+// no pool 'pool'. As linhas ainda precisam ser zeradas.
+static void setupReverb(Reverb* r, Uint8 preset, Uint8 freeBanks, Uint8 pool)
 {
-    int i, j;
+    const ReverbPresetLayout* p = &REVERB_PRESETS[preset];
+    Uint8 map[REVERB_MEM_BANKS];
+    Uint8 b, n = 0;
+
+    r->banks = 0;
+    for (b = 0; b < REVERB_MEM_BANKS; b++) map[b] = 0;
+    for (b = 0; b < REVERB_MEM_BANKS; b++) {
+        if (n < p->extBanks && (freeBanks & (1u << b))) {
+            map[n++] = b;
+            r->banks |= (Uint8)(1u << b);
+        }
+    }
 
-    // Configura Comb Filters
+    r->wet_gain_Q15  = p->wet_gain_Q15;
+    r->dry_gain_Q15  = p->dry_gain_Q15;
+    r->memAllocated  = p->extWords;
+    r->fastAllocated = p->fastWords;
+    r->pool          = pool;
+    r->preset        = preset;
+    r->engine        = p->engine;
+
+    if (p->engine == REVERB_ENGINE_FDN) {
+        initFdnLines(r, p, map, pool);
+    } else if (p->engine == REVERB_ENGINE_PLATE) {
+        initPlate(r, p, map, pool);
+    } else {
+        initReverbCore(&r->left,  p, 0, map, pool);
+        initReverbCore(&r->right, p, 1, map, pool);
+    }
+}
+
+// Linhas com realimentao de 'r' em lines[], na ordem das janelas de DMA
+static Uint16 feedbackLines(Reverb* r, CombFilter** lines)
+{
+    Uint16 i;
+
+    if (r->engine == REVERB_ENGINE_FDN) {
+        for (i = 0; i < REVERB_FDN_LINES; i++) lines[i] = &r->fdn[i];
+        return REVERB_FDN_LINES;
+    }
+    if (r->engine == REVERB_ENGINE_PLATE) {
+        for (i = 0; i < 2; i++) {
+            lines[3 * i]     = &r->plate[i].delay1;
+            lines[3 * i + 1] = &r->plate[i].allpass;
+            lines[3 * i + 2] = &r->plate[i].delay2;
+        }
+        return PLATE_LINES;
+    }
     for (i = 0; i < REVERB_NUM_COMBS; i++) {
-        CombFilter* c = &core->comb[i];
+        lines[i]                    = &r->left.comb[i];
+        lines[REVERB_NUM_COMBS + i] = &r->right.comb[i];
+    }
+    return 2 * REVERB_NUM_COMBS;
+}
 
-        Uint16 samples = msToSamples(p->comb_ms[i]);
-        if (use_spread) samples += REVERB_SPREAD;
+// As janelas de DMA so do preset atual. winCur = 0 e a janela 0 tem que
+// corresponder a buffer[ptr..): s vale com a linha e a janela zeradas.
+static void attachWindows(Reverb* r)
+{
+    CombFilter* lines[REVERB_MAX_LINES];
+    Uint16 n = feedbackLines(r, lines);
+    Uint16 i;
 
-        if (samples < 2) samples = 2;
+    for (i = 0; i < n; i++) {
+        CombFilter* c = lines[i];
 
-        c->buffer = allocMemory(samples);
-        if (!c->buffer) {
-            // Falta de memria: degrade seguro -> delay mnimo
-            samples = 2;
-            c->buffer = &g_reverbMemory[0]; // ponteiro vlido (no crash)
+        c->winCur = 0;
+        if (c->windowed) {
+            c->window[0] = &s_combWindow[(2 * i)     * REVERB_CHUNK];
+            c->window[1] = &s_combWindow[(2 * i + 1) * REVERB_CHUNK];
         }
+    }
+}
 
-        c->delay_samples = samples;
-        c->gain_Q15      = floatToQ15(p->comb_gains[i]);
-        c->ptr           = 0;
-
-        // Damping
-        c->damp_shift = p->comb_damp_shift;
-        c->damp_state = 0;
+// Sem janelas as linhas so lidas e escritas direto (a cauda). S com as
+// cpias de DMA concludas: a a linha na CE0 est completa.
+static void detachWindows(Reverb* r)
+{
+    CombFilter* lines[REVERB_MAX_LINES];
+    Uint16 n = feedbackLines(r, lines);
+    Uint16 i;
 
-        for (j = 0; j < samples; j++) c->buffer[j] = 0;
+    for (i = 0; i < n; i++) {
+        lines[i]->window[0] = lines[i]->window[1] = (Int16*)0;
     }
+}
 
-    // Configura All-Pass Filters
-    for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
-        AllPassFilter* ap = &core->allpass[i];
+// Regio 'r' da limpeza em *buf; retorna o tamanho (0: nada a zerar)
+static Uint16 clearRegion(Uint16 r, Int16** buf)
+{
+    CombFilter* lines[REVERB_MAX_LINES];
+    Uint16 n = feedbackLines(s_clearTarget, lines);
+    AllPassFilter* ap;
+
+    if (r < n) {
+        *buf = lines[r]->buffer;
+        return lines[r]->delay_samples;
+    }
+    r -= n;
+    if (r < n) {
+        *buf = lines[r]->window[0];
+        return *buf ? REVERB_CHUNK : 0;
+    }
+    r -= n;
+    if (s_clearTarget->engine == REVERB_ENGINE_PLATE) {
+        if (r < REVERB_PLATE_DIFFUSERS) {
+            *buf = s_clearTarget->plateDiffuser[r].buffer;
+            return s_clearTarget->plateDiffuser[r].delay_samples;
+        }
+        r -= REVERB_PLATE_DIFFUSERS;
+        if (r < 2) {
+            *buf = s_clearTarget->plate[r].mod.buffer;
+            return s_clearTarget->plate[r].mod.len;
+        }
+    }
+    if (s_clearTarget->engine != REVERB_ENGINE_SCHROEDER || r >= 2 * REVERB_NUM_ALLPASSES) {
+        *buf = (Int16*)0;
+        return 0;
+    }
+    ap = r < REVERB_NUM_ALLPASSES ? &s_clearTarget->left.allpass[r]
+                                  : &s_clearTarget->right.allpass[r - REVERB_NUM_ALLPASSES];
+    *buf = ap->buffer;
+    return ap->delay_samples;
+}
 
-        Uint16 samples = msToSamples(p->ap_ms[i]);
-        if (samples < 2) samples = 2;
+static void clearBegin(Reverb* r)
+{
+    s_clearTarget = r;
+    s_clearRegion = 0;
+    s_clearPos = 0;
+}
 
-        ap->buffer = allocMemory(samples);
-        if (!ap->buffer) {
-            samples = 2;
-            ap->buffer = &g_reverbMemory[0];
+static Uint8 clearStep(Uint16 words)
+{
+    Int16* buf;
+    Uint16 len;
+
+    while (words > 0 && s_clearRegion < CLEAR_REGIONS) {
+        len = clearRegion(s_clearRegion, &buf);
+        words -= effectClearChunk(buf, len, &s_clearPos, words);
+        if (s_clearPos >= len) {
+            s_clearRegion++;
+            s_clearPos = 0;
         }
+    }
+    return s_clearRegion >= CLEAR_REGIONS;
+}
 
-        ap->delay_samples = samples;
-        ap->gain_Q15      = floatToQ15(p->ap_gains[i]);
-        ap->ptr           = 0;
+// Inicializao Global: s cpia da tabela gerada; as linhas so zeradas
+// por reverbInitStep
+void reverbInitBegin(void)
+{
+    Uint16 b;
 
-        for (j = 0; j < samples; j++) ap->buffer[j] = 0;
+    // Toma o slot principal da arena (a memria do efeito anterior)
+    effectMemAcquire(EFFECT_SLOT_MAIN, EFFECT_REVERB);
+    for (b = 0; b < REVERB_MEM_BANKS; b++) {
+        g_reverbMemory[b] = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_EXT, REVERB_MEM_BANK_WORDS);
     }
+    for (b = 0; b < REVERB_FAST_POOLS; b++) {
+        g_reverbFastMemory[b] = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, REVERB_FAST_MEM_SIZE);
+    }
+    s_combWindow = effectMemAlloc(EFFECT_SLOT_MAIN, EFFECT_MEM_FAST, REVERB_WINDOW_WORDS);
+
+    if (g_reverbPreset >= REVERB_PRESET_COUNT) g_reverbPreset = REVERB_PRESET_HALL;
+
+    // Memria nova: nenhuma cauda
+    s_tailActive = 0;
+    s_dryPos     = EFFECT_XFADE_FRAMES;
+
+    setupReverb(&g_reverb, g_reverbPreset, REVERB_BANKS_ALL, 0);
+    attachWindows(&g_reverb);
+
+    clearBegin(&g_reverb);
+}
+
+Uint8 reverbInitStep(Uint16 words)
+{
+    return clearStep(words);
 }
 
-// Inicializao Global
 void initReverb(void)
 {
-    g_reverb.memAllocated = 0;
+    reverbInitBegin();
+    while (!reverbInitStep(0xFFFF)) {
+    }
+}
 
-    if (g_reverbPreset >= REVERB_PRESET_COUNT) g_reverbPreset = REVERB_PRESET_HALL;
-    const ReverbPresetCfg* p = &REVERB_PRESETS[g_reverbPreset];
+// -------------------- Processamento por bloco --------------------
+// Cada filtro percorre o bloco inteiro com o estado em variveis locais
+// (registradores). Como delay_samples >= 2, o bloco  dividido em trechos
+// que nunca do a volta no buffer circular: o lao interno no tem desvio
+// de wrap e l/escreve o buffer com passo unitrio.
+
+// Lao do comb sobre um trecho linear (sem wrap): acc[k] += filtrado;
+// p = x + g * filtrado. Retorna o estado do damping.
+static Int16 combRun(Int16* p, const Int16* x, Int32* acc, Uint16 run,
+                     Int16 gain, Int16 state, Uint8 shift)
+{
+    Uint16 k;
+
+    if (shift != 0) {
+        // filtered = state + (delayed - state) >> shift
+        for (k = 0; k < run; k++) {
+            Int16 diff = C55_SUB16(p[k], state);
+            state = C55_ADD16(state, diff >> shift);
+            acc[k] += (Int32)state;
+            p[k] = q15_add(x[k], q15_mul(gain, state));
+        }
+    } else {
+        for (k = 0; k < run; k++) {
+            Int16 delayed = p[k];
+            acc[k] += (Int32)delayed;
+            p[k] = q15_add(x[k], q15_mul(gain, delayed));
+        }
+    }
+    return state;
+}
+
+// Comb com linha na DARAM: trechos que no do a volta no buffer
+static void processCombBlock(CombFilter* c, const Int16* x, Int32* acc, Uint16 frames)
+{
+    Int16* buf   = c->buffer;
+    Uint16 delay = c->delay_samples;
+    Uint16 ptr   = c->ptr;
+    Int16  state = c->damp_state;
+
+    while (frames > 0) {
+        Uint16 run = delay - ptr;
+
+        if (run > frames) run = frames;
+
+        state = combRun(&buf[ptr], x, acc, run, c->gain_Q15, state, c->damp_shift);
+
+        ptr += run;
+        if (ptr >= delay) ptr = 0;
+        x      += run;
+        acc    += run;
+        frames -= run;
+    }
+
+    c->ptr = ptr;
+    c->damp_state = state;
+}
+
+// Linha na CE0 (frames <= REVERB_CHUNK). window[winCur] j tem
+// buffer[ptr..ptr+REVERB_CHUNK): o lao s toca a DARAM e o DMA traz a
+// prxima janela e devolve a atual  CE0 em segundo plano.
+static Uint16 windowNextPtr(const CombFilter* c, Uint16 frames)
+{
+    Uint16 next = c->ptr + frames;
+
+    if (next >= c->delay_samples) next -= c->delay_samples;
+    return next;
+}
 
-    g_reverb.wet_gain_Q15 = floatToQ15(p->wet_gain);
-    g_reverb.dry_gain_Q15 = floatToQ15(p->dry_gain);
+// Antes do trecho. Bloco cheio: a prxima janela comea logo aps esta
+static void lineWindowBegin(const CombFilter* c, Uint16 frames)
+{
+    if (frames == REVERB_CHUNK) {
+        combLineToWindow(c, windowNextPtr(c, frames), c->window[c->winCur ^ 1], REVERB_CHUNK);
+    }
+}
 
-    // L sem spread
-    initReverbCore(&g_reverb.left, p, 0);
+// Depois do trecho: devolve a janela atual e passa para a prxima. Bloco
+// parcial: a janela seguinte  lida depois da devoluo (fila FIFO)
+static void lineWindowEnd(CombFilter* c, Uint16 frames)
+{
+    Uint16 next = windowNextPtr(c, frames);
 
-    // R com spread
-    initReverbCore(&g_reverb.right, p, 1);
+    combWindowToLine(c, c->ptr, c->window[c->winCur], frames);
+    if (frames != REVERB_CHUNK) {
+        combLineToWindow(c, next, c->window[c->winCur ^ 1], REVERB_CHUNK);
+    }
+    c->ptr = next;
+    c->winCur ^= 1;
 }
 
-// All-Pass
-static Int16 processAllPass(Int16 input, AllPassFilter* apf)
+static void processCombWindow(CombFilter* c, const Int16* x, Int32* acc, Uint16 frames)
 {
-    Int16 delayed = apf->buffer[apf->ptr];
+    lineWindowBegin(c, frames);
+    c->damp_state = combRun(c->window[c->winCur], x, acc, frames, c->gain_Q15,
+                            c->damp_state, c->damp_shift);
+    lineWindowEnd(c, frames);
+}
 
-    // v[n] = x[n] + g*d[n]
-    Int32 vn = (Int32)input + (((Int32)apf->gain_Q15 * (Int32)delayed) >> 15);
+// Lao do all-pass sobre um trecho linear (sem wrap), x in-place: p tem
+// as amostras mais antigas da linha e recebe as novas
+static void allPassRun(Int16* p, Int16* x, Uint16 run, Int16 gain)
+{
+    Uint16 k;
 
-    // y[n] = -g*v[n] + d[n]
-    Int32 output = -(((Int32)apf->gain_Q15 * vn) >> 15) + (Int32)delayed;
+    for (k = 0; k < run; k++) {
+        Int16 delayed = p[k];
 
-    apf->buffer[apf->ptr] = sat16(vn);
+        // v[n] = x[n] + g*d[n]  (v fica em 32 bits para o ramo de sada)
+        Int32 vn = (Int32)x[k] + (Int32)q15_mul(gain, delayed);
 
-    apf->ptr++;
-    if (apf->ptr >= apf->delay_samples) apf->ptr = 0;
+        // y[n] = -g*v[n] + d[n]
+        Int32 output = -(((Int32)gain * vn) >> 15) + (Int32)delayed;
 
-    return sat16(output);
+        p[k] = q15_sat(vn);
+        x[k] = q15_sat(output);
+    }
 }
 
-// Processa uma amostra (Comb Paralelo + AP Srie) com damping barato + mix dry/wet
-static Int16 processReverbSample(Int16 input, ReverbCore* core, Int16 dryGain, Int16 wetGain)
+// All-Pass in-place sobre o bloco
+static void processAllPassBlock(AllPassFilter* apf, Int16* x, Uint16 frames)
 {
-    int i;
-    Int32 accComb = 0;
+    Int16* buf   = apf->buffer;
+    Uint16 delay = apf->delay_samples;
+    Uint16 ptr   = apf->ptr;
 
-    // 1) Combs em paralelo
-    for (i = 0; i < REVERB_NUM_COMBS; i++) {
-        CombFilter* c = &core->comb[i];
+    while (frames > 0) {
+        Uint16 run = delay - ptr;
 
-        Int16 delayed = c->buffer[c->ptr];
+        if (run > frames) run = frames;
 
-        // ----------------- DAMPING (barato, por shift) -----------------
-        // filtered = state + (delayed - state) >> shift
-        // shift=0 -> sem damping
-        Int16 filtered;
-        if (c->damp_shift != 0) {
-            Int16 diff = (Int16)(delayed - c->damp_state);
-            filtered = (Int16)(c->damp_state + (diff >> c->damp_shift));
-            c->damp_state = filtered;
-        } else {
-            filtered = delayed;
+        allPassRun(&buf[ptr], x, run, apf->gain_Q15);
+
+        ptr += run;
+        if (ptr >= delay) ptr = 0;
+        x      += run;
+        frames -= run;
+    }
+
+    apf->ptr = ptr;
+}
+
+// Processa um canal (Comb Paralelo + AP Srie + mix dry/wet), in-place
+static void processReverbChannel(Int16* x, Uint16 frames, ReverbCore* core,
+                                 Int16 dryGain, Int16 wetGain)
+{
+    Uint16 i, k;
+
+    while (frames > 0) {
+        Uint16 n = frames > REVERB_CHUNK ? REVERB_CHUNK : frames;
+
+        // 1) Combs em paralelo, um de cada vez sobre o bloco
+        for (k = 0; k < n; k++) s_combAcc[k] = 0;
+        for (i = 0; i < REVERB_NUM_COMBS; i++) {
+            CombFilter* c = &core->comb[i];
+
+            if (c->window[0]) processCombWindow(c, x, s_combAcc, n);
+            else              processCombBlock(c, x, s_combAcc, n);
+        }
+
+        // Atenuao da soma dos combs (4 x Int16 >> 2 sempre cabe em 16 bits)
+        for (k = 0; k < n; k++) s_wetBlock[k] = (Int16)(s_combAcc[k] >> 2);
+
+        // 2) All-pass em srie (difuso)
+        for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
+            processAllPassBlock(&core->allpass[i], s_wetBlock, n);
+        }
+
+        // 3) Mix Dry/Wet real (evita "input+wet" estourar fcil)
+        for (k = 0; k < n; k++) {
+            x[k] = q15_add(q15_mul(dryGain, x[k]), q15_mul(wetGain, s_wetBlock[k]));
         }
-        // ---------------------------------------------------------------
 
-        accComb += (Int32)filtered;
+        x      += n;
+        frames -= n;
 
-        // Feedback com sinal filtrado (reduz ringing)
-        Int32 fb = (Int32)input + (((Int32)c->gain_Q15 * (Int32)filtered) >> 15);
-        c->buffer[c->ptr] = sat16(fb);
+        // Mais de um trecho na chamada: as janelas do prximo precisam chegar
+        if (frames > 0) memDmaWait();
+    }
+}
 
-        c->ptr++;
-        if (c->ptr >= c->delay_samples) c->ptr = 0;
+// -------------------- FDN --------------------
+// Por quadro: l a amostra mais antiga de cada linha (damping de um polo,
+// como nos combs), mistura pela matriz de Householder A = I - (2/N) 11^T
+// (s_i - soma/4: ortogonal, s somas e shift) e escreve de volta
+// entrada_i + g_i * (A s)_i. L e R entram e saem de todas as linhas com os
+// sinais REVERB_FDN_SIGN_*: uma rede s para os dois canais.
+
+// Trecho sem wrap em nenhuma linha: p[i] aponta para a amostra mais
+// antiga da linha i (na janela ou na prpria linha)
+static void fdnRun(Reverb* r, Int16* const* p, Int16* left, Int16* right,
+                   Uint16 run, Int16 dry)
+{
+    Int16 state[REVERB_FDN_LINES];
+    Int16 gain[REVERB_FDN_LINES];
+    Uint8 shift[REVERB_FDN_LINES];
+    Int16 wet = r->wet_gain_Q15;
+    Uint16 i, k;
+
+    for (i = 0; i < REVERB_FDN_LINES; i++) {
+        state[i] = r->fdn[i].damp_state;
+        gain[i]  = r->fdn[i].gain_Q15;
+        shift[i] = r->fdn[i].damp_shift;
     }
 
-    // Atenuao da soma dos combs
-    Int16 combOut = sat16(accComb >> 2);
+    for (k = 0; k < run; k++) {
+        Int16 xl = left[k];
+        Int16 xr = right[k];
+        Int32 sum = 0, yl = 0, yr = 0, fb;
 
-    // 2) All-pass em srie (difuso)
-    Int16 apSignal = combOut;
-    for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
-        apSignal = processAllPass(apSignal, &core->allpass[i]);
+        for (i = 0; i < REVERB_FDN_LINES; i++) {
+            Int16 diff = C55_SUB16(p[i][k], state[i]);
+            Int16 st = C55_ADD16(state[i], diff >> shift[i]);
+
+            state[i] = st;
+            sum += st;
+            yl += REVERB_FDN_SIGN_L(i) * (Int32)st;
+            yr += REVERB_FDN_SIGN_R(i) * (Int32)st;
+        }
+        fb = sum >> REVERB_FDN_MIX_SHIFT;
+
+        for (i = 0; i < REVERB_FDN_LINES; i++) {
+            Int32 in = (REVERB_FDN_SIGN_L(i) * (Int32)xl + REVERB_FDN_SIGN_R(i) * (Int32)xr) >> 1;
+            Int16 mixed = q15_sat((Int32)state[i] - fb);
+
+            p[i][k] = q15_sat(in + q15_mul(gain[i], mixed));
+        }
+
+        left[k]  = q15_add(q15_mul(dry, xl), q15_mul(wet, q15_sat(yl >> 2)));
+        right[k] = q15_add(q15_mul(dry, xr), q15_mul(wet, q15_sat(yr >> 2)));
     }
 
-    // 3) Mix Dry/Wet real (evita input+wet estourar fcil)
-    Int32 dryPart = ((Int32)dryGain * (Int32)input) >> 15;
-    Int32 wetPart = ((Int32)wetGain * (Int32)apSignal) >> 15;
+    for (i = 0; i < REVERB_FDN_LINES; i++) r->fdn[i].damp_state = state[i];
+}
+
+// Blocos planares, in-place. Linhas com janela so lidas da janela atual;
+// as outras em trechos que no do a volta em nenhuma delas.
+static void processFdn(Reverb* r, Int16* left, Int16* right, Uint16 frames, Int16 dry)
+{
+    Int16* p[REVERB_FDN_LINES];
+    Uint16 i;
+
+    while (frames > 0) {
+        Uint16 n = frames > REVERB_CHUNK ? REVERB_CHUNK : frames;
+        Uint16 pos = 0;
 
-    return sat16(dryPart + wetPart);
+        for (i = 0; i < REVERB_FDN_LINES; i++) {
+            if (r->fdn[i].window[0]) lineWindowBegin(&r->fdn[i], n);
+        }
+
+        while (pos < n) {
+            Uint16 run = n - pos;
+
+            for (i = 0; i < REVERB_FDN_LINES; i++) {
+                CombFilter* c = &r->fdn[i];
+
+                if (c->window[0]) {
+                    p[i] = &c->window[c->winCur][pos];
+                } else {
+                    if (c->delay_samples - c->ptr < run) run = c->delay_samples - c->ptr;
+                    p[i] = &c->buffer[c->ptr];
+                }
+            }
+
+            fdnRun(r, p, left + pos, right + pos, run, dry);
+
+            for (i = 0; i < REVERB_FDN_LINES; i++) {
+                CombFilter* c = &r->fdn[i];
+
+                if (c->window[0]) continue;
+                c->ptr += run;
+                if (c->ptr >= c->delay_samples) c->ptr = 0;
+            }
+            pos += run;
+        }
+
+        for (i = 0; i < REVERB_FDN_LINES; i++) {
+            if (r->fdn[i].window[0]) lineWindowEnd(&r->fdn[i], n);
+        }
+
+        left   += n;
+        right  += n;
+        frames -= n;
+
+        // Mais de um trecho na chamada: as janelas do prximo precisam chegar
+        if (frames > 0) memDmaWait();
+    }
 }
 
-// rxBlock intercalado: L, R, L, R...
-void processAudioReverb(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize)
+// -------------------- Plate --------------------
+// Dattorro: entrada mono -> 4 all-pass (difuso) -> tanque em oito. Cada
+// metade recebe a entrada mais a sada da outra (atraso 2 x decay); as
+// sadas L e R somam 7 taps de linhas das duas metades. Todas as linhas do
+// tanque so mais longas que um trecho, ento cada estgio percorre o
+// trecho inteiro de uma vez, como os combs.
+
+// Linha do tanque a partir do quadro 'pos' do trecho: na janela, ou direto
+// no buffer com *run reduzido para no dar a volta
+static Int16* lineSpan(CombFilter* c, Uint16 pos, Uint16* run)
 {
-    int i;
-    Int16 wet = g_reverb.wet_gain_Q15;
-    Int16 dry = g_reverb.dry_gain_Q15;
+    Uint16 at, room;
+
+    if (c->window[0]) return &c->window[c->winCur][pos];
+
+    at = c->ptr + pos;
+    if (at >= c->delay_samples) at -= c->delay_samples;
+    room = c->delay_samples - at;
+    if (room < *run) *run = room;
+    return &c->buffer[at];
+}
+
+// Fim do trecho de n quadros: devolve a janela ou avana o ponteiro
+static void lineAdvance(CombFilter* c, Uint16 n)
+{
+    if (c->window[0]) {
+        lineWindowEnd(c, n);
+        return;
+    }
+    c->ptr += n;
+    if (c->ptr >= c->delay_samples) c->ptr -= c->delay_samples;
+}
+
+// acc[k] += sign * (amostra escrita d quadros antes do quadro k), com o
+// trecho j escrito. Antes do trecho a linha est na CE0 (a janela do
+// trecho anterior j voltou); dentro dele, na janela.
+static void tapAccumulate(const CombFilter* c, Uint16 d, Int16 sign, Int32* acc, Uint16 n)
+{
+    Uint16 split = (c->window[0] && d < n) ? d : n;
+    Uint16 pos = c->ptr >= d ? c->ptr - d : c->ptr + c->delay_samples - d;
+    Uint16 k = 0;
+
+    while (k < split) {
+        Uint16 run = c->delay_samples - pos;
+        const Int16* p = &c->buffer[pos];
+        Uint16 j;
+
+        if (run > split - k) run = split - k;
+        for (j = 0; j < run; j++) acc[k + j] += sign * (Int32)p[j];
+
+        k   += run;
+        pos += run;
+        if (pos >= c->delay_samples) pos = 0;
+    }
+    for (; k < n; k++) acc[k] += sign * (Int32)c->window[c->winCur][k - d];
+}
+
+// All-pass modulado, in-place, direto no buffer (CE0)
+static void modAllPassRun(ModAllPassFilter* m, Int16* x, Uint16 n)
+{
+    Int16* buf   = m->buffer;
+    Uint16 len   = m->len;
+    Uint16 ptr   = m->ptr;
+    Uint16 base  = m->delay_samples - m->depth;
+    Uint16 span  = 2 * m->depth;
+    Int16  gain  = m->gain_Q15;
+    Uint32 phase = m->phase;
+    Uint32 inc   = m->phase_inc;
+    Uint16 k;
+
+    for (k = 0; k < n; k++) {
+        Uint16 u = (Uint16)(phase >> 16);
+        Uint16 tri = u < 0x8000u ? (Uint16)(u << 1) : (Uint16)((0xFFFFu - u) << 1);
+        Uint32 off = (Uint32)span * tri;                 // Q16
+        Uint16 d = base + (Uint16)(off >> 16);
+        Int16 frac = (Int16)((off >> 1) & 0x7FFF);
+        Uint16 ia = ptr >= d ? ptr - d : ptr + len - d;  // d quadros atrs
+        Uint16 ib = ia ? ia - 1 : len - 1;               // d + 1
+        Int16 delayed = q15_sat((Int32)buf[ia] +
+                                ((((Int32)buf[ib] - buf[ia]) * frac) >> 15));
+        Int32 vn = (Int32)x[k] + (Int32)q15_mul(gain, delayed);
+
+        buf[ptr] = q15_sat(vn);
+        x[k] = q15_sat(-(((Int32)gain * vn) >> 15) + (Int32)delayed);
+
+        if (++ptr >= len) ptr = 0;
+        phase += inc;
+    }
+
+    m->ptr = ptr;
+    m->phase = phase;
+}
+
+// Uma metade do tanque sobre o trecho, x (entrada) in-place
+static void plateHalf(PlateTank* t, Int16* x, Uint16 n)
+{
+    Int16 state = t->delay1.damp_state;
+    Uint16 pos, run, k;
+
+    modAllPassRun(&t->mod, x, n);
+
+    // Atraso 1 + damping + decay
+    for (pos = 0; pos < n; pos += run) {
+        Int16* p;
+
+        run = n - pos;
+        p = lineSpan(&t->delay1, pos, &run);
+        for (k = 0; k < run; k++) {
+            Int16 delayed = p[k];
+
+            p[k] = x[pos + k];
+            state = C55_ADD16(state, C55_SUB16(delayed, state) >> t->delay1.damp_shift);
+            x[pos + k] = q15_mul(t->delay1.gain_Q15, state);
+        }
+    }
+    t->delay1.damp_state = state;
+
+    for (pos = 0; pos < n; pos += run) {
+        Int16* p;
 
-    for (i = 0; i < blockSize; i += 2) {
+        run = n - pos;
+        p = lineSpan(&t->allpass, pos, &run);
+        allPassRun(p, x + pos, run, t->allpass.gain_Q15);
+    }
 
-        // ESQ
-        txBlock[i] = (Uint16)processReverbSample(
-            (Int16)rxBlock[i],
-            &g_reverb.left,
-            dry,
-            wet
-        );
+    // Atraso 2: a sada j foi lida para a outra metade
+    for (pos = 0; pos < n; pos += run) {
+        Int16* p;
 
-        // DIR
-        txBlock[i + 1] = (Uint16)processReverbSample(
-            (Int16)rxBlock[i + 1],
-            &g_reverb.right,
-            dry,
-            wet
-        );
+        run = n - pos;
+        p = lineSpan(&t->delay2, pos, &run);
+        for (k = 0; k < run; k++) p[k] = x[pos + k];
     }
 }
 
+static CombFilter* plateTapLine(PlateTank* t, Uint16 j)
+{
+    switch (REVERB_PLATE_TAP_LINE(j)) {
+        case REVERB_PLATE_AP:     return &t->allpass;
+        case REVERB_PLATE_DELAY2: return &t->delay2;
+        default:                  return &t->delay1;
+    }
+}
+
+// Blocos planares, in-place
+static void processPlate(Reverb* r, Int16* left, Int16* right, Uint16 frames, Int16 dry)
+{
+    CombFilter* lines[REVERB_MAX_LINES];
+    Uint16 numLines = feedbackLines(r, lines);
+    Int16 wet = r->wet_gain_Q15;
+    Uint16 h, i, j, k;
+
+    while (frames > 0) {
+        Uint16 n = frames > REVERB_CHUNK ? REVERB_CHUNK : frames;
+        Uint16 pos, run;
+
+        for (i = 0; i < numLines; i++) {
+            if (lines[i]->window[0]) lineWindowBegin(lines[i], n);
+        }
+
+        // 1) Entrada mono (L + R) / 4 e difusores
+        for (k = 0; k < n; k++) {
+            s_wetBlock[k] = (Int16)(((Int32)left[k] + right[k]) >> 2);
+        }
+        for (i = 0; i < REVERB_PLATE_DIFFUSERS; i++) {
+            processAllPassBlock(&r->plateDiffuser[i], s_wetBlock, n);
+        }
+
+        // 2) Sada do atraso 2 de cada metade, antes de ser reescrita,
+        //    vai para a entrada da outra
+        for (h = 0; h < 2; h++) {
+            CombFilter* d2 = &r->plate[h].delay2;
+            Int16* fb = s_plateHalf[h ^ 1];
+
+            for (pos = 0; pos < n; pos += run) {
+                const Int16* p;
+
+                run = n - pos;
+                p = lineSpan(d2, pos, &run);
+                for (k = 0; k < run; k++) fb[pos + k] = p[k];
+            }
+        }
+        for (h = 0; h < 2; h++) {
+            Int16 decay = r->plate[h ^ 1].delay2.gain_Q15;
+            Int16* x = s_plateHalf[h];
+
+            for (k = 0; k < n; k++) x[k] = q15_add(s_wetBlock[k], q15_mul(decay, x[k]));
+        }
+
+        // 3) Tanque
+        plateHalf(&r->plate[0], s_plateHalf[0], n);
+        plateHalf(&r->plate[1], s_plateHalf[1], n);
+
+        // 4) Taps (soma / 2) e mix
+        for (h = 0; h < 2; h++) {
+            Int16* x = h == 0 ? left : right;
+
+            for (k = 0; k < n; k++) s_combAcc[k] = 0;
+            for (j = 0; j < REVERB_PLATE_TAPS; j++) {
+                PlateTank* t = &r->plate[REVERB_PLATE_TAP_HALF(h, j)];
+
+                tapAccumulate(plateTapLine(t, j), r->plateTap[h][j],
+                              REVERB_PLATE_TAP_SIGN(j), s_combAcc, n);
+            }
+            for (k = 0; k < n; k++) {
+                x[k] = q15_add(q15_mul(dry, x[k]), q15_mul(wet, q15_sat(s_combAcc[k] >> 1)));
+            }
+        }
+
+        for (i = 0; i < numLines; i++) lineAdvance(lines[i], n);
+
+        left   += n;
+        right  += n;
+        frames -= n;
+
+        // Mais de um trecho na chamada: as janelas do prximo precisam chegar
+        if (frames > 0) memDmaWait();
+    }
+}
+
+// Um preset sobre blocos planares, in-place
+static void reverbRun(Reverb* r, Int16* left, Int16* right, Uint16 frames, Int16 dry)
+{
+    if (r->engine == REVERB_ENGINE_FDN) {
+        processFdn(r, left, right, frames, dry);
+        return;
+    }
+    if (r->engine == REVERB_ENGINE_PLATE) {
+        processPlate(r, left, right, frames, dry);
+        return;
+    }
+    processReverbChannel(left,  frames, &r->left,  dry, r->wet_gain_Q15);  // ESQ
+    processReverbChannel(right, frames, &r->right, dry, r->wet_gain_Q15);  // DIR
+}
+
+// -------------------- Cauda do preset anterior --------------------
+
+#define TAIL_GAIN_STEP   (1u << EFFECT_XFADE_SHIFT)     // Rampa do corte
+
+// Soma um trecho da cauda a x. Retorna o maior entre 'peak' e o pico do
+// trecho.
+static Int16 mixTail(Int16* x, const Int16* tail, Uint16 n, Int16 peak, Uint8 cutting)
+{
+    Uint16 gain = s_tailGain;
+    Uint16 k;
+
+    for (k = 0; k < n; k++) {
+        Int16 t = tail[k];
+        Int16 mag = t < 0 ? ~t : t;     // |t| sem estourar em -32768
+
+        if (mag > peak) peak = mag;
+        if (cutting) {
+            t = q15_mul((Int16)gain, t);
+            gain = gain > TAIL_GAIN_STEP ? gain - TAIL_GAIN_STEP : 0;
+        }
+        x[k] = q15_add(x[k], t);
+    }
+    return peak;
+}
+
+// O preset anterior com entrada zero, somado  sada
+static void processTail(Int16* left, Int16* right, Uint16 frames)
+{
+    while (frames > 0 && s_tailActive) {
+        Uint16 n = frames > REVERB_CHUNK ? REVERB_CHUNK : frames;
+        Uint8 cutting = s_tailCutReq;
+        Int16 peak;
+        Uint16 k;
+
+        for (k = 0; k < n; k++) s_tailLeft[k] = s_tailRight[k] = 0;
+        reverbRun(&s_reverbTail, s_tailLeft, s_tailRight, n, 0);
+
+        peak = mixTail(left,  s_tailLeft,  n, 0,    cutting);
+        peak = mixTail(right, s_tailRight, n, peak, cutting);
+
+        if (cutting) {
+            Uint32 drop = (Uint32)n << EFFECT_XFADE_SHIFT;
+
+            s_tailGain = drop >= s_tailGain ? 0 : (Uint16)(s_tailGain - drop);
+        }
+
+        // Silncio por uma volta inteira da linha mais longa: o que sobrou
+        // nas linhas tambm est abaixo do piso
+        if (peak >= REVERB_TAIL_FLOOR)    s_tailQuiet = 0;
+        else if (s_tailQuiet < s_tailHold) s_tailQuiet += n;
+
+        if (s_tailGain == 0 || s_tailQuiet >= s_tailHold) s_tailActive = 0;
+
+        left   += n;
+        right  += n;
+        frames -= n;
+    }
+}
+
+// Linha com realimentao + all-pass mais longos; no plate, uma volta
+// inteira do tanque
+static Uint16 longestPath(Reverb* r)
+{
+    CombFilter* lines[REVERB_MAX_LINES];
+    Uint16 n = feedbackLines(r, lines);
+    Uint16 line = 0, ap = 0;
+    Uint16 i;
+
+    if (r->engine == REVERB_ENGINE_PLATE) {
+        for (i = 0; i < n; i++) line += lines[i]->delay_samples;
+        return line + r->plate[0].mod.len + r->plate[1].mod.len;
+    }
+
+    for (i = 0; i < n; i++) {
+        if (lines[i]->delay_samples > line) line = lines[i]->delay_samples;
+    }
+    for (i = 0; r->engine == REVERB_ENGINE_SCHROEDER && i < REVERB_NUM_ALLPASSES; i++) {
+        if (r->left.allpass[i].delay_samples > ap)  ap = r->left.allpass[i].delay_samples;
+        if (r->right.allpass[i].delay_samples > ap) ap = r->right.allpass[i].delay_samples;
+    }
+    return line + ap;
+}
+
+// Logo aps a troca: o preset novo roda sem dry e o dry vai do ganho do
+// anterior ao do novo em EFFECT_XFADE_FRAMES quadros, como a rampa da ISR.
+// A entrada fica em s_tailLeft/s_tailRight, que a cauda s usa depois.
+static void reverbRunDryRamp(Int16* left, Int16* right, Uint16 frames)
+{
+    Int32 d = (Int32)g_reverb.dry_gain_Q15 - s_dryFrom;
+    Uint16 k;
+
+    for (k = 0; k < frames; k++) {
+        s_tailLeft[k]  = left[k];
+        s_tailRight[k] = right[k];
+    }
+    reverbRun(&g_reverb, left, right, frames, 0);
+
+    for (k = 0; k < frames; k++) {
+        Int32 g = (Int32)s_dryPos << EFFECT_XFADE_SHIFT;
+        Int16 dry = (Int16)(s_dryFrom + ((d * g) >> 15));
+
+        left[k]  = q15_add(left[k],  q15_mul(dry, s_tailLeft[k]));
+        right[k] = q15_add(right[k], q15_mul(dry, s_tailRight[k]));
+        if (s_dryPos < EFFECT_XFADE_FRAMES) s_dryPos++;
+    }
+}
+
+// Blocos planares, in-place: L e R passam pelo preset atual
+void processAudioReverb(Int16* left, Int16* right, Uint16 frames)
+{
+    // Janelas pedidas no bloco anterior (o DMA teve um bloco inteiro)
+    memDmaWait();
+
+    if (s_dryPos < EFFECT_XFADE_FRAMES && frames <= REVERB_CHUNK) {
+        reverbRunDryRamp(left, right, frames);
+    } else {
+        reverbRun(&g_reverb, left, right, frames, g_reverb.dry_gain_Q15);
+    }
+
+    if (s_tailActive) processTail(left, right, frames);
+}
+
+// -------------------- Troca de preset --------------------
+
+static Uint8 bankCount(Uint8 mask)
+{
+    Uint8 n = 0;
+
+    for (; mask != 0; mask >>= 1) n += mask & 1u;
+    return n;
+}
+
+Uint8 reverbStageNeeded(void)
+{
+    return g_reverbPreset != g_reverb.preset;
+}
+
+Uint8 reverbStageFits(void)
+{
+    ReverbPreset preset = g_reverbPreset < REVERB_PRESET_COUNT ? g_reverbPreset
+                                                               : REVERB_PRESET_HALL;
+
+    // A cauda ainda ocupa os bancos e o outro pool
+    if (s_tailActive) return 0;
+    return bankCount(REVERB_BANKS_ALL & ~g_reverb.banks) >= REVERB_PRESETS[preset].extBanks;
+}
+
+void reverbStageBegin(void)
+{
+    if (g_reverbPreset >= REVERB_PRESET_COUNT) g_reverbPreset = REVERB_PRESET_HALL;
+
+    setupReverb(&s_reverbNext, g_reverbPreset, REVERB_BANKS_ALL & ~g_reverb.banks,
+                g_reverb.pool ^ 1u);
+    clearBegin(&s_reverbNext);
+}
+
+Uint8 reverbStageStep(Uint16 words)
+{
+    return clearStep(words);
+}
+
+void reverbStageSwap(void)
+{
+    CombFilter* lines[REVERB_MAX_LINES];
+    Uint16 n, i, k;
+
+    // Janelas do bloco anterior devolvidas: as linhas na CE0 esto completas
+    memDmaWait();
+
+    s_reverbTail = g_reverb;
+    detachWindows(&s_reverbTail);
+
+    // O novo herda as janelas, zeradas como as suas linhas
+    g_reverb = s_reverbNext;
+    attachWindows(&g_reverb);
+    n = feedbackLines(&g_reverb, lines);
+    for (i = 0; i < n; i++) {
+        Int16* w = lines[i]->window[0];
+
+        for (k = 0; w && k < REVERB_CHUNK; k++) w[k] = 0;
+    }
+
+    s_dryFrom    = s_reverbTail.dry_gain_Q15;
+    s_dryPos     = s_dryFrom == g_reverb.dry_gain_Q15 ? EFFECT_XFADE_FRAMES : 0;
+
+    s_tailHold   = longestPath(&s_reverbTail);
+    s_tailQuiet  = 0;
+    s_tailGain   = 32767;
+    s_tailCutReq = 0;
+    s_tailActive = 1;
+}
+
+Uint8 reverbTailBusy(void)
+{
+    return s_tailActive;
+}
+
+void reverbTailCut(void)
+{
+    s_tailCutReq = 1;
+}
+
+// S reinicia se a memria ainda for do reverb; seno o preset  aplicado
+// quando o controlador preparar o reverb (reverbInitBegin)
+static int reverbOwnsMemory(void)
+{
+    return effectMemOwner(EFFECT_SLOT_MAIN) == EFFECT_REVERB;
+}
+
+// Linhas e buffers so refeitos pelo controlador, com o reverb fora da ISR
+static void reinitReverb(void)
+{
+    if (reverbOwnsMemory()) effectRestart(EFFECT_REVERB);
+}
+
 void clearReverb(void)
 {
-    initReverb();
+    reinitReverb();
 }
 
 void setReverbPreset(ReverbPreset preset)
 {
     if (preset >= REVERB_PRESET_COUNT) preset = REVERB_PRESET_HALL;
+
+    // Mesmo preset j pedido: mantm a cauda (sem fade-out/fade-in)
+    if (preset == g_reverbPreset && reverbOwnsMemory()) return;
+
+    // Reverb em uso: o controlador monta o preset novo ao lado do atual
     g_reverbPreset = preset;
-    initReverb();
+    if (reverbOwnsMemory()) effectPresetChange(EFFECT_REVERB);
 }
 
 ReverbPreset getReverbPreset(void)
@@ -3,6 +3,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "tremolo.h"
+#include "fixed_point.h"
 #include <math.h>
 
 // Tabela de Seno em Q15 (256 pontos)
@@ -45,32 +46,28 @@ void initTremolo(void)
 }
 
 // Processamento do Tremolo (otimizado Q15)
-void processAudioTremolo(Uint16* rxBlock, Uint16* txBlock, Uint16 blockSize)
+// Blocos planares, in-place. O ganho é calculado uma vez por quadro e
+// aplicado aos dois canais (oscilador avança a 48 kHz).
+void processAudioTremolo(Int16* left, Int16* right, Uint16 frames)
 {
     int i;
-    Int16 xin, yout;
-    Int32 temp;
+    Int16 half_depth = g_tremolo.depth >> 1;
+    Int16 offset = 32767 - half_depth;
     
-    for (i = 0; i < blockSize; i++)
+    for (i = 0; i < frames; i++)
     {
-        // Converte entrada para Int16
-        xin = (Int16)rxBlock[i];
-        
         // Processa tremolo
         Int16 mod = g_tremolo.current_val;
-        Int16 half_depth = g_tremolo.depth >> 1;
-        Int16 offset = 32767 - half_depth;
-        Int16 variable = (Int16)(((Int32)half_depth * mod) >> 15);
+        Int16 variable = q15_mul(half_depth, mod);
         Int16 gain = offset + variable;
         
-        // Aplica ganho
-        temp = (Int32)xin * gain;
-        yout = (Int16)(temp >> 15);
-        txBlock[i] = (Uint16)yout;
+        // Aplica ganho (gain > 0: nunca satura)
+        left[i]  = q15_mul(left[i], gain);
+        right[i] = q15_mul(right[i], gain);
         
-        // Atualiza oscilador para próxima amostra
+        // Atualiza oscilador para o próximo quadro
         g_tremolo.phase_acc += g_tremolo.phase_inc;
         Uint16 index = (Uint16)(g_tremolo.phase_acc >> 24);
         g_tremolo.current_val = sine_table[index];
     }
-}
\ No newline at end of file
+}
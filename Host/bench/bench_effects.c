@@ -0,0 +1,354 @@
+//////////////////////////////////////////////////////////////////////////////
+// bench_effects.c - Benchmark por efeito da cadeia de Final_Project_Pro_MAX
+//
+// Passa cada configuração de effect_chain.c por muitos blocos de
+// AUDIO_BLOCK_SIZE palavras (sinal sintético e gravado) e mede o tempo de
+// processAudioBlock(). Reporta ns/amostra, amostras/s e a folga em relação
+// ao prazo de tempo real de um bloco. O resultado vai para um CSV e pode ser
+// comparado com um baseline: sai com código 1 se algum kernel piorar além
+// do limiar.
+//
+// A comparação usa o tempo normalizado por uma carga de calibração medida
+// junto com cada efeito, para que variações de clock da máquina (turbo,
+// vizinhos na VM) não apareçam como regressão.
+//
+// Uso:
+//   bench_effects [--blocks N] [--repeat R] [--input arquivo.pcm]
+//                 [--out resultado.csv] [--baseline baseline.csv]
+//                 [--threshold 0.25] [--only nome]
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "dma.h"
+#include "effect_chain.h"
+
+#define BENCH_INPUT_BLOCKS   64     // Blocos distintos de entrada (ciclo)
+#define BENCH_WARMUP_BLOCKS  16
+#define BENCH_MAX_RESULTS    64
+#define BENCH_NAME_LEN       32
+#define CALIB_LEN            4096
+
+// Prazo de um bloco: AUDIO_BLOCK_FRAMES quadros estéreo a 48 kHz
+#define BLOCK_BUDGET_NS \
+    (1.0e9 * (double)AUDIO_BLOCK_FRAMES / (double)AUDIO_SAMPLE_RATE)
+
+typedef struct {
+    char   config[BENCH_NAME_LEN];
+    char   input[BENCH_NAME_LEN];
+    double nsPerSample;
+    double norm;            // nsPerSample / tempo da calibração (ns)
+} BenchResult;
+
+static Int16 s_input[BENCH_INPUT_BLOCKS][AUDIO_BLOCK_SIZE];
+static Int16 s_output[AUDIO_BLOCK_SIZE];
+static Int16 s_calib[CALIB_LEN];
+static volatile Int32 s_calibSink;
+
+// ---------------------------------------------------------------------------
+// Entradas
+// ---------------------------------------------------------------------------
+
+// Seno de 440 Hz + ruído (LCG fixo: o benchmark é determinístico)
+static void makeSyntheticInput(void)
+{
+    Uint32 seed = 12345u;
+    Uint32 n;
+    Uint16 b, i;
+
+    for (b = 0; b < BENCH_INPUT_BLOCKS; b++) {
+        for (i = 0; i < AUDIO_BLOCK_SIZE; i += AUDIO_NUM_CHANNELS) {
+            double v;
+
+            n = (Uint32)b * AUDIO_BLOCK_FRAMES + i / AUDIO_NUM_CHANNELS;
+            seed = seed * 1664525u + 1013904223u;
+            v = 0.5 * sin(2.0 * M_PI * 440.0 * n / AUDIO_SAMPLE_RATE)
+              + 0.1 * ((double)(Int16)(seed >> 16) / 32768.0);
+
+            s_input[b][i]     = (Int16)(v * 32767.0);
+            s_input[b][i + 1] = (Int16)(-v * 32767.0);
+        }
+    }
+}
+
+// PCM 16 bits mono (ex.: data/piano8kHz.pcm), duplicado em L e R
+static int loadRecordedInput(const char* path)
+{
+    FILE* f = fopen(path, "rb");
+    Uint16 b, i;
+    unsigned char raw[2];
+
+    if (!f) return 0;
+
+    for (b = 0; b < BENCH_INPUT_BLOCKS; b++) {
+        for (i = 0; i < AUDIO_BLOCK_SIZE; i += AUDIO_NUM_CHANNELS) {
+            Int16 x;
+
+            if (fread(raw, 1, 2, f) != 2) {
+                rewind(f);
+                if (fread(raw, 1, 2, f) != 2) {
+                    fclose(f);
+                    return 0;
+                }
+            }
+            x = (Int16)(raw[0] | (raw[1] << 8));
+            s_input[b][i]     = x;
+            s_input[b][i + 1] = x;
+        }
+    }
+    fclose(f);
+    return 1;
+}
+
+// ---------------------------------------------------------------------------
+// Medição
+// ---------------------------------------------------------------------------
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1.0e9 + (double)ts.tv_nsec;
+}
+
+// Carga de calibração: MAC Q15 com dependência entre iterações, o mesmo
+// tipo de trabalho dos kernels (ns por chamada)
+static double timeCalibration(void)
+{
+    double t0 = nowNs();
+    Int32 acc = 0;
+    Uint16 k, i;
+
+    for (k = 0; k < 16; k++) {
+        for (i = 0; i < CALIB_LEN; i++) {
+            acc += ((Int32)s_calib[i] * (Int16)acc) >> 15;
+            s_calib[i] = (Int16)(acc + i);
+        }
+    }
+    s_calibSink = acc;
+    return nowNs() - t0;
+}
+
+// Menor tempo por bloco entre 'repeat' rodadas de 'blocks' blocos. A
+// calibração é medida intercalada com as rodadas (menor tempo também).
+static double timeConfig(const HostChainConfig* cfg, long blocks, int repeat,
+                         double* calibNs)
+{
+    double best = 0.0;
+    double bestCalib = 0.0;
+    long b;
+    int r;
+
+    hostChainApply(cfg);
+    for (b = 0; b < BENCH_WARMUP_BLOCKS; b++) {
+        hostChainProcess(s_input[b % BENCH_INPUT_BLOCKS], s_output);
+    }
+
+    for (r = 0; r < repeat; r++) {
+        double t0, dt, c;
+
+        c = timeCalibration();
+        if (r == 0 || c < bestCalib) bestCalib = c;
+
+        t0 = nowNs();
+        for (b = 0; b < blocks; b++) {
+            hostChainProcess(s_input[b % BENCH_INPUT_BLOCKS], s_output);
+        }
+        dt = (nowNs() - t0) / (double)blocks;
+        if (r == 0 || dt < best) best = dt;
+    }
+    *calibNs = bestCalib;
+    return best;
+}
+
+// ---------------------------------------------------------------------------
+// Baseline
+// ---------------------------------------------------------------------------
+
+static int loadBaseline(const char* path, BenchResult* out, int max)
+{
+    FILE* f = fopen(path, "r");
+    char line[256];
+    int n = 0;
+
+    if (!f) return -1;
+
+    while (n < max && fgets(line, sizeof(line), f)) {
+        BenchResult* r = &out[n];
+
+        if (line[0] == '#' || strncmp(line, "config,", 7) == 0) continue;
+        if (sscanf(line, "%31[^,],%31[^,],%lf,%*f,%*f,%*f,%*f,%lf",
+                   r->config, r->input, &r->nsPerSample, &r->norm) == 4) {
+            n++;
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+static const BenchResult* findResult(const BenchResult* list, int n,
+                                     const char* config, const char* input)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (strcmp(list[i].config, config) == 0 &&
+            strcmp(list[i].input, input) == 0) {
+            return &list[i];
+        }
+    }
+    return (const BenchResult*)0;
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "uso: bench_effects [--blocks N] [--repeat R] [--input arquivo.pcm]\n"
+        "                   [--out resultado.csv] [--baseline baseline.csv]\n"
+        "                   [--threshold 0.25] [--only nome]\n");
+}
+
+int main(int argc, char** argv)
+{
+    long blocks = 2000;
+    int repeat = 5;
+    double threshold = 0.25;
+    const char* inputPath = NULL;
+    const char* outPath = NULL;
+    const char* baselinePath = NULL;
+    const char* only = NULL;
+
+    static BenchResult results[BENCH_MAX_RESULTS];
+    static BenchResult baseline[BENCH_MAX_RESULTS];
+    int nResults = 0;
+    int nBaseline = 0;
+    int regressions = 0;
+    int pass, i;
+    FILE* out = NULL;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--blocks") == 0 && i + 1 < argc) {
+            blocks = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--input") == 0 && i + 1 < argc) {
+            inputPath = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baselinePath = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            threshold = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (blocks < 1 || repeat < 1) {
+        usage();
+        return 2;
+    }
+
+    if (baselinePath) {
+        nBaseline = loadBaseline(baselinePath, baseline, BENCH_MAX_RESULTS);
+        if (nBaseline < 0) {
+            fprintf(stderr, "bench_effects: baseline '%s' não encontrado\n",
+                    baselinePath);
+            return 2;
+        }
+    }
+
+    printf("Bloco: %d palavras = %d quadros estéreo @ %d Hz -> prazo %.3f ms\n\n",
+           AUDIO_BLOCK_SIZE, AUDIO_BLOCK_FRAMES, AUDIO_SAMPLE_RATE,
+           BLOCK_BUDGET_NS / 1.0e6);
+    printf("%-20s %-10s %10s %14s %10s %9s %s\n", "config", "input",
+           "ns/amostra", "amostras/s", "bloco(us)", "folga(%)", "baseline");
+
+    // Passo 0: sintético. Passo 1: gravado (se houver arquivo)
+    for (pass = 0; pass < 2; pass++) {
+        const char* inputName = pass == 0 ? "synthetic" : "recorded";
+        Uint16 c;
+
+        if (pass == 0) {
+            makeSyntheticInput();
+        } else {
+            if (!inputPath) break;
+            if (!loadRecordedInput(inputPath)) {
+                fprintf(stderr, "bench_effects: não foi possível ler '%s'\n",
+                        inputPath);
+                return 2;
+            }
+        }
+
+        for (c = 0; c < g_hostChainConfigCount; c++) {
+            const HostChainConfig* cfg = &g_hostChainConfigs[c];
+            const BenchResult* base;
+            BenchResult* r;
+            double blockNs, headroom, calibNs;
+            char note[48] = "";
+
+            if (only && strcmp(only, cfg->name) != 0) continue;
+            if (nResults >= BENCH_MAX_RESULTS) break;
+
+            blockNs  = timeConfig(cfg, blocks, repeat, &calibNs);
+            headroom = 100.0 * (1.0 - blockNs / BLOCK_BUDGET_NS);
+
+            r = &results[nResults++];
+            snprintf(r->config, sizeof(r->config), "%s", cfg->name);
+            snprintf(r->input, sizeof(r->input), "%s", inputName);
+            r->nsPerSample = blockNs / (double)AUDIO_BLOCK_SIZE;
+            r->norm        = r->nsPerSample / calibNs;
+
+            base = findResult(baseline, nBaseline, r->config, r->input);
+            if (base) {
+                double delta = r->norm / base->norm - 1.0;
+                snprintf(note, sizeof(note), "%+.1f%%%s", 100.0 * delta,
+                         delta > threshold ? "  REGRESSAO" : "");
+                if (delta > threshold) regressions++;
+            } else if (baselinePath) {
+                snprintf(note, sizeof(note), "(sem baseline)");
+            }
+
+            printf("%-20s %-10s %10.3f %14.0f %10.2f %9.1f %s\n",
+                   r->config, r->input, r->nsPerSample,
+                   1.0e9 / r->nsPerSample, blockNs / 1.0e3, headroom, note);
+        }
+    }
+
+    if (outPath) {
+        out = fopen(outPath, "w");
+        if (!out) {
+            fprintf(stderr, "bench_effects: não foi possível criar '%s'\n",
+                    outPath);
+            return 2;
+        }
+        fprintf(out, "config,input,ns_per_sample,samples_per_s,block_us,"
+                     "budget_us,headroom_pct,norm\n");
+        for (i = 0; i < nResults; i++) {
+            double blockNs = results[i].nsPerSample * AUDIO_BLOCK_SIZE;
+            fprintf(out, "%s,%s,%.4f,%.0f,%.3f,%.3f,%.2f,%.6e\n",
+                    results[i].config, results[i].input,
+                    results[i].nsPerSample, 1.0e9 / results[i].nsPerSample,
+                    blockNs / 1.0e3, BLOCK_BUDGET_NS / 1.0e3,
+                    100.0 * (1.0 - blockNs / BLOCK_BUDGET_NS),
+                    results[i].norm);
+        }
+        fclose(out);
+    }
+
+    if (regressions) {
+        printf("\n%d kernel(s) acima do limiar de %.0f%%\n", regressions,
+               100.0 * threshold);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,359 @@
+//////////////////////////////////////////////////////////////////////////////
+// bench_fft.c - Benchmark e precisão da FFT Q15 de Final_Project_Pro_MAX
+//
+// Para n = 64..FFT_MAX_POINTS mede o tempo de fftForward, fftInverse,
+// fftRealForward e fftRealInverse (menor tempo entre as rodadas) e a SNR
+// de cada uma contra a DFT em double do mesmo vetor Q15, já com o
+// expoente do bloco aplicado. A entrada é ruído de -6 dBFS com um seno
+// (LCG fixo: determinístico).
+//
+// Uso:
+//   bench_fft [--repeat R] [--out resultado.csv] [--check] [--min-snr DB]
+//
+// --check sai com código 1 se alguma SNR ficar abaixo de --min-snr (50 dB
+// por padrão; a ponto flutuante em bloco perde 1 a 3 dB por oitava: ~61 dB
+// em 2048 pontos). Também passa vetores de fundo de escala (32767 e
+// -32768) por todas as transformadas de FFT_MIN_POINTS a FFT_MAX_POINTS,
+// sem medir tempo: cada um deve manter a SNR e nenhuma saída pode passar
+// de 32765 em módulo (fft.h). O ctest roda assim, com uma repetição.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "fft.h"
+
+#define BENCH_MIN_POINTS   64
+#define BENCH_TRANSFORMS   4
+#define BENCH_OUT_LIMIT    32765        // Maior módulo na saída (fft.h)
+
+typedef Int16 (*FftFunc)(Int16* x, Uint16 n);
+
+typedef struct {
+    const char* name;
+    FftFunc     func;
+    int         real;       // Entrada ou saída real (formato empacotado)
+    int         inverse;
+} FftKind;
+
+static const FftKind s_kinds[BENCH_TRANSFORMS] = {
+    { "complex_fwd", fftForward,     0, 0 },
+    { "complex_inv", fftInverse,     0, 1 },
+    { "real_fwd",    fftRealForward, 1, 0 },
+    { "real_inv",    fftRealInverse, 1, 1 },
+};
+
+static Int16  s_input[2 * FFT_MAX_POINTS];
+static Int16  s_work[2 * FFT_MAX_POINTS];
+static double s_refRe[FFT_MAX_POINTS];
+static double s_refIm[FFT_MAX_POINTS];
+
+static double nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1.0e9 + (double)ts.tv_nsec;
+}
+
+// Ruído de -6 dBFS + seno no bin 5.3 (palavras = 2n para complexa, n real)
+static void makeInput(Uint16 words)
+{
+    Uint32 seed = 2024u;
+    Uint16 i;
+
+    for (i = 0; i < words; i++) {
+        double v;
+
+        seed = seed * 1664525u + 1013904223u;
+        v = 0.25 * ((double)(Int16)(seed >> 16) / 32768.0)
+          + 0.25 * sin(2.0 * M_PI * 5.3 * i / words);
+        s_input[i] = (Int16)floor(v * 32767.0 + 0.5);
+    }
+}
+
+// Vetores de fundo de escala, palavras = 2n (complexa) ou n (real)
+typedef enum {
+    EXTREME_PAIR,       // 32767 no início e -32768 no meio
+    EXTREME_SQUARE,     // 32767, -32768 alternados por ponto
+    EXTREME_MIN,        // Tudo -32768
+    EXTREME_NOISE,      // 32767 ou -32768 ao acaso
+    EXTREME_COUNT
+} ExtremeVector;
+
+static const char* const s_extremeNames[EXTREME_COUNT] = {
+    "par", "quadrada", "minimo", "ruido_cheio"
+};
+
+static void makeExtreme(ExtremeVector vec, const FftKind* kind, Uint16 words)
+{
+    Uint32 seed = 2024u;
+    Uint16 i;
+
+    for (i = 0; i < words; i++) {
+        Uint16 t = kind->real ? i : i / 2;
+
+        seed = seed * 1664525u + 1013904223u;
+        switch (vec) {
+            case EXTREME_PAIR:
+                s_input[i] = i == 0 ? 32767 : i == words / 2 ? -32768 : 0;
+                break;
+            case EXTREME_SQUARE:
+                s_input[i] = (t & 1) ? -32768 : 32767;
+                break;
+            case EXTREME_MIN:
+                s_input[i] = -32768;
+                break;
+            default:
+                s_input[i] = (seed >> 31) ? -32768 : 32767;
+                break;
+        }
+    }
+}
+
+// Referência em double no formato da saída de cada transformada: a
+// complexa devolve n bins (ou n * IDFT), a real direta n/2 bins empacotados
+// e a real inversa n amostras (n * IDFT do espectro hermitiano)
+static void reference(const FftKind* kind, Uint16 n)
+{
+    Uint16 bins = kind->real && !kind->inverse ? n / 2 : n;
+    double sign = kind->inverse ? 1.0 : -1.0;
+    Uint16 k, t;
+
+    for (k = 0; k < bins; k++) {
+        double re = 0.0, im = 0.0;
+
+        for (t = 0; t < n; t++) {
+            double a = sign * 2.0 * M_PI * (double)((Uint32)k * t % n) / n;
+            double xr, xi;
+
+            if (!kind->real) {
+                xr = s_input[2 * t];
+                xi = s_input[2 * t + 1];
+            } else if (!kind->inverse) {
+                xr = s_input[t];
+                xi = 0.0;
+            } else if (t == 0) {            // Espectro hermitiano empacotado
+                xr = s_input[0];
+                xi = 0.0;
+            } else if (t == n / 2) {
+                xr = s_input[1];
+                xi = 0.0;
+            } else if (t < n / 2) {
+                xr = s_input[2 * t];
+                xi = s_input[2 * t + 1];
+            } else {
+                xr = s_input[2 * (n - t)];
+                xi = -s_input[2 * (n - t) + 1];
+            }
+            re += xr * cos(a) - xi * sin(a);
+            im += xr * sin(a) + xi * cos(a);
+        }
+        s_refRe[k] = re;
+        s_refIm[k] = im;
+    }
+
+    // Real direta: Re(X[n/2]) vai no lugar de Im(X[0])
+    if (kind->real && !kind->inverse) {
+        double re = 0.0;
+
+        for (t = 0; t < n; t++) re += (t & 1) ? -s_input[t] : s_input[t];
+        s_refIm[0] = re;
+    }
+}
+
+static double snrDb(const FftKind* kind, Uint16 n, Int16 exponent)
+{
+    double scale = ldexp(1.0, exponent);
+    double sig = 0.0, err = 0.0, d;
+    Uint16 k;
+
+    if (kind->real && kind->inverse) {
+        for (k = 0; k < n; k++) {
+            d = s_work[k] * scale - s_refRe[k];
+            sig += s_refRe[k] * s_refRe[k];
+            err += d * d;
+        }
+    } else {
+        Uint16 bins = kind->real ? n / 2 : n;
+
+        for (k = 0; k < bins; k++) {
+            d = s_work[2 * k] * scale - s_refRe[k];
+            sig += s_refRe[k] * s_refRe[k];
+            err += d * d;
+            d = s_work[2 * k + 1] * scale - s_refIm[k];
+            sig += s_refIm[k] * s_refIm[k];
+            err += d * d;
+        }
+    }
+    return err > 0.0 ? 10.0 * log10(sig / err) : 200.0;
+}
+
+// Menor tempo por transformada (ns); a cópia da entrada não entra na conta
+static double timeKind(const FftKind* kind, Uint16 n, Uint16 words, int repeat)
+{
+    long calls = 1 + 200000L / n;
+    double best = 0.0;
+    long c;
+    int r;
+
+    for (r = 0; r < repeat; r++) {
+        double t0, copy, dt;
+
+        t0 = nowNs();
+        for (c = 0; c < calls; c++) memcpy(s_work, s_input, words * sizeof(Int16));
+        copy = nowNs() - t0;
+
+        t0 = nowNs();
+        for (c = 0; c < calls; c++) {
+            memcpy(s_work, s_input, words * sizeof(Int16));
+            kind->func(s_work, n);
+        }
+        dt = (nowNs() - t0 - copy) / (double)calls;
+        if (r == 0 || dt < best) best = dt;
+    }
+    return best;
+}
+
+static Uint16 outputPeak(Uint16 words)
+{
+    Uint16 peak = 0;
+    Uint16 i;
+
+    for (i = 0; i < words; i++) {
+        Int32 v = s_work[i];
+        Uint16 m = (Uint16)(v < 0 ? -v : v);
+
+        if (m > peak) peak = m;
+    }
+    return peak;
+}
+
+// Vetores de fundo de escala em todos os tamanhos; devolve as falhas
+static int checkExtremes(double minSnr)
+{
+    int failures = 0;
+    Uint16 n;
+
+    for (n = FFT_MIN_POINTS; n <= FFT_MAX_POINTS && n != 0; n <<= 1) {
+        Uint16 k;
+
+        for (k = 0; k < BENCH_TRANSFORMS; k++) {
+            const FftKind* kind = &s_kinds[k];
+            Uint16 words = kind->real ? n : 2 * n;
+            int vec;
+
+            for (vec = 0; vec < EXTREME_COUNT; vec++) {
+                Int16 exponent;
+                Uint16 peak;
+                double snr;
+
+                makeExtreme((ExtremeVector)vec, kind, words);
+                reference(kind, n);
+                memcpy(s_work, s_input, words * sizeof(Int16));
+                exponent = kind->func(s_work, n);
+                snr = snrDb(kind, n, exponent);
+                peak = outputPeak(words);
+
+                if (snr < minSnr || peak > BENCH_OUT_LIMIT) {
+                    printf("%-12s %6u %-12s pico %5u  SNR %7.2f dB  FALHOU\n",
+                           kind->name, n, s_extremeNames[vec], peak, snr);
+                    failures++;
+                }
+            }
+        }
+    }
+    printf("\nfundo de escala (n = %d..%d): %d falha(s)\n",
+           FFT_MIN_POINTS, FFT_MAX_POINTS, failures);
+    return failures;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "uso: bench_fft [--repeat R] [--out resultado.csv] [--check] [--min-snr DB]\n");
+}
+
+int main(int argc, char** argv)
+{
+    int repeat = 5;
+    int check = 0;
+    double minSnr = 50.0;
+    const char* outPath = NULL;
+    FILE* out = NULL;
+    int failures = 0;
+    Uint16 n;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (strcmp(argv[i], "--check") == 0) {
+            check = 1;
+        } else if (strcmp(argv[i], "--min-snr") == 0 && i + 1 < argc) {
+            minSnr = atof(argv[++i]);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (repeat < 1) {
+        usage();
+        return 2;
+    }
+
+    if (outPath) {
+        out = fopen(outPath, "w");
+        if (!out) {
+            fprintf(stderr, "bench_fft: não foi possível criar '%s'\n", outPath);
+            return 2;
+        }
+        fprintf(out, "transform,points,ns_per_call,ns_per_point_log2,exponent,snr_db\n");
+    }
+
+    fftInit();
+    printf("%-12s %6s %12s %14s %5s %9s\n",
+           "transformada", "n", "ns/chamada", "ns/(n log2 n)", "exp", "SNR(dB)");
+
+    for (n = BENCH_MIN_POINTS; n <= FFT_MAX_POINTS && n != 0; n <<= 1) {
+        Uint16 log2n = 0;
+        Uint16 k;
+
+        while ((1u << log2n) < n) log2n++;
+
+        for (k = 0; k < BENCH_TRANSFORMS; k++) {
+            const FftKind* kind = &s_kinds[k];
+            Uint16 words = kind->real ? n : 2 * n;
+            double ns, snr;
+            Int16 exponent;
+
+            makeInput(words);
+            reference(kind, n);
+            memcpy(s_work, s_input, words * sizeof(Int16));
+            exponent = kind->func(s_work, n);
+            snr = snrDb(kind, n, exponent);
+            ns = timeKind(kind, n, words, repeat);
+
+            printf("%-12s %6u %12.0f %14.3f %5d %9.2f%s\n", kind->name, n, ns,
+                   ns / ((double)n * log2n), exponent, snr,
+                   snr < minSnr ? "  ABAIXO" : "");
+            if (out) {
+                fprintf(out, "%s,%u,%.1f,%.4f,%d,%.2f\n", kind->name, n, ns,
+                        ns / ((double)n * log2n), exponent, snr);
+            }
+            if (snr < minSnr) failures++;
+        }
+    }
+    if (out) fclose(out);
+
+    if (check) failures += checkExtremes(minSnr);
+    if (check && failures) {
+        printf("\n%d transformada(s) abaixo de %.1f dB de SNR ou acima de %d\n",
+               failures, minSnr, BENCH_OUT_LIMIT);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////////
+// effect_chain.c - Configurações da cadeia de efeitos (ferramentas de host)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include "effect_chain.h"
+#include "dma.h"
+#include "effects_controller.h"
+#include "pitch_shift.h"
+
+// Notas usadas em main.c (checkSwitch)
+#define NOTE_B   493.88f
+#define NOTE_D   293.66f
+#define NOTE_F   349.23f
+#define NOTE_GB  369.99f
+
+#define GRAIN    PITCH_MODE_GRAIN
+#define VOC      PITCH_MODE_VOCODER
+#define SYNC     PITCH_MODE_GRAIN_SYNC
+
+const HostChainConfig g_hostChainConfigs[] = {
+    { "loopback",             EFFECT_LOOPBACK,    REVERB_PRESET_HALL,     0, 0.0f,    GRAIN },
+    { "reverb_hall",          EFFECT_REVERB,      REVERB_PRESET_HALL,     0, 0.0f,    GRAIN },
+    { "reverb_room2",         EFFECT_REVERB,      REVERB_PRESET_ROOM_2,   0, 0.0f,    GRAIN },
+    { "reverb_stage",         EFFECT_REVERB,      REVERB_PRESET_STAGE,    0, 0.0f,    GRAIN },
+    { "reverb_fdn_hall",      EFFECT_REVERB,      REVERB_PRESET_FDN_HALL, 0, 0.0f,    GRAIN },
+    { "reverb_fdn_room",      EFFECT_REVERB,      REVERB_PRESET_FDN_ROOM, 0, 0.0f,    GRAIN },
+    { "reverb_plate",         EFFECT_REVERB,      REVERB_PRESET_PLATE,    0, 0.0f,    GRAIN },
+    { "conv_reverb",          EFFECT_CONV_REVERB, REVERB_PRESET_HALL,     0, 0.0f,    GRAIN },
+    { "stage_pitch_b",        EFFECT_REVERB,      REVERB_PRESET_STAGE,    1, NOTE_B,  VOC   },
+    { "stage_pitch_d",        EFFECT_REVERB,      REVERB_PRESET_STAGE,    1, NOTE_D,  SYNC  },
+    { "stage_pitch_f",        EFFECT_REVERB,      REVERB_PRESET_STAGE,    1, NOTE_F,  SYNC  },
+    { "stage_pitch_gb",       EFFECT_REVERB,      REVERB_PRESET_STAGE,    1, NOTE_GB, VOC   },
+    { "stage_pitch_b_grain",  EFFECT_REVERB,      REVERB_PRESET_STAGE,    1, NOTE_B,  GRAIN },
+    { "stage_pitch_gb_grain", EFFECT_REVERB,      REVERB_PRESET_STAGE,    1, NOTE_GB, GRAIN },
+    { "stage_pitch_d_grain",  EFFECT_REVERB,      REVERB_PRESET_STAGE,    1, NOTE_D,  GRAIN },
+    { "stage_pitch_f_grain",  EFFECT_REVERB,      REVERB_PRESET_STAGE,    1, NOTE_F,  GRAIN },
+    { "pitch_b",              EFFECT_LOOPBACK,    REVERB_PRESET_HALL,     1, NOTE_B,  GRAIN },
+    { "pitch_b_pv",           EFFECT_LOOPBACK,    REVERB_PRESET_HALL,     1, NOTE_B,  VOC   },
+    { "pitch_b_sync",         EFFECT_LOOPBACK,    REVERB_PRESET_HALL,     1, NOTE_B,  SYNC  },
+    { "flanger",              EFFECT_FLANGER,     REVERB_PRESET_HALL,     0, 0.0f,    GRAIN },
+    { "tremolo",              EFFECT_TREMOLO,     REVERB_PRESET_HALL,     0, 0.0f,    GRAIN },
+};
+
+const Uint16 g_hostChainConfigCount =
+    (Uint16)(sizeof(g_hostChainConfigs) / sizeof(g_hostChainConfigs[0]));
+
+const HostChainConfig* hostChainFind(const char* name)
+{
+    Uint16 i;
+
+    for (i = 0; i < g_hostChainConfigCount; i++) {
+        if (strcmp(g_hostChainConfigs[i].name, name) == 0) {
+            return &g_hostChainConfigs[i];
+        }
+    }
+    return (const HostChainConfig*)0;
+}
+
+void hostChainApply(const HostChainConfig* cfg)
+{
+    // Parte do zero, como após o reset da placa
+    initEffectController();
+    setPitchShiftEnabled(0);
+    hostChainRequest(cfg);
+}
+
+void hostChainRequest(const HostChainConfig* cfg)
+{
+    // Mesma ordem de checkSwitch(): modo -> pitch -> frequência -> preset ->
+    // efeito
+    if (cfg->pitchEnabled) {
+        setPitchShiftMode(cfg->pitchMode);
+        setPitchShiftEnabled(1);
+        setPitchFrequency(cfg->pitchFreq);
+    } else {
+        setPitchShiftEnabled(0);
+    }
+    if (cfg->effect == EFFECT_REVERB) {
+        setReverbPreset(cfg->preset);
+    }
+    setEffect(cfg->effect);
+}
+
+void hostChainProcess(const Int16* in, Int16* out)
+{
+    // processAudioBlock só lê o bloco de entrada (RxBuffer na placa)
+    processAudioBlock((Uint16*)in, (Uint16*)out, AUDIO_BLOCK_SIZE);
+}
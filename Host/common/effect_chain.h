@@ -0,0 +1,43 @@
+//////////////////////////////////////////////////////////////////////////////
+// effect_chain.h - Configurações da cadeia de efeitos para as ferramentas
+//                  de host (benchmark, renderizador, simulador, testes)
+//
+// Cada configuração reproduz um passo de checkSwitch() em main.c: mesma
+// sequência de chamadas ao controlador, mesmo preset e mesma nota do
+// pitch shift. O áudio passa sempre por processAudioBlock(), o mesmo
+// caminho usado pela ISR de DMA na placa.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef EFFECT_CHAIN_H_
+#define EFFECT_CHAIN_H_
+
+#include "tistdtypes.h"
+#include "reverb.h"
+
+typedef struct {
+    const char*  name;          // Identificador usado nos arquivos/flags
+    Uint8        effect;        // EFFECT_* de effects_controller.h
+    ReverbPreset preset;        // Usado apenas com EFFECT_REVERB
+    Uint8        pitchEnabled;  // Estágio de pitch shift antes do efeito
+    float        pitchFreq;     // Nota alvo (Hz) do pitch shift
+    Uint8        pitchMode;     // PITCH_MODE_* do pitch shift
+} HostChainConfig;
+
+extern const HostChainConfig g_hostChainConfigs[];
+extern const Uint16          g_hostChainConfigCount;
+
+// Procura uma configuração pelo nome (NULL se não existir)
+const HostChainConfig* hostChainFind(const char* name);
+
+// Reinicia o controlador e aplica a configuração (estado "frio")
+void hostChainApply(const HostChainConfig* cfg);
+
+// Pede a configuração sem reiniciar, como um passo do SW1. Com o DMA
+// parado ela é aplicada na hora; com audioDmaRunning, effectControllerPoll
+// leva a cadeia até ela.
+void hostChainRequest(const HostChainConfig* cfg);
+
+// Processa um bloco intercalado L,R de AUDIO_BLOCK_SIZE palavras
+void hostChainProcess(const Int16* in, Int16* out);
+
+#endif /* EFFECT_CHAIN_H_ */
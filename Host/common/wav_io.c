@@ -0,0 +1,201 @@
+//////////////////////////////////////////////////////////////////////////////
+// wav_io.c - Leitura e escrita de arquivos WAV (ferramentas de host)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "wav_io.h"
+
+#define WAVE_FORMAT_PCM         0x0001
+#define WAVE_FORMAT_IEEE_FLOAT  0x0003
+#define WAVE_FORMAT_EXTENSIBLE  0xFFFE
+
+static uint32_t rd32(const unsigned char* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t rd16(const unsigned char* p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static void wr32(unsigned char* p, uint32_t v)
+{
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+    p[2] = (unsigned char)(v >> 16);
+    p[3] = (unsigned char)(v >> 24);
+}
+
+static void wr16(unsigned char* p, uint16_t v)
+{
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+}
+
+static int fail(char* err, Uint16 errLen, const char* msg)
+{
+    if (err && errLen) snprintf(err, errLen, "%s", msg);
+    return -1;
+}
+
+// Converte uma amostra do formato do arquivo para Int16
+static Int16 decodeSample(const unsigned char* p, uint16_t format,
+                          uint16_t bits)
+{
+    if (format == WAVE_FORMAT_IEEE_FLOAT) {
+        float f;
+        uint32_t u = rd32(p);
+
+        memcpy(&f, &u, sizeof(f));
+        if (f >= 1.0f)  return 32767;
+        if (f <= -1.0f) return -32768;
+        return (Int16)(f * 32767.0f);
+    }
+
+    switch (bits) {
+        case 8:  return (Int16)(((int)p[0] - 128) * 256);   // 8 bits: sem sinal
+        case 16: return (Int16)rd16(p);
+        case 24: return (Int16)rd16(p + 1);                 // 16 bits superiores
+        default: return (Int16)rd16(p + 2);                 // 32 bits
+    }
+}
+
+int wavRead(const char* path, WavAudio* wav, char* err, Uint16 errLen)
+{
+    FILE* f;
+    unsigned char hdr[12];
+    unsigned char ck[8];
+    unsigned char fmt[40];
+    unsigned char* data = NULL;
+    uint32_t dataLen = 0;
+    uint16_t format = 0, channels = 0, bits = 0, blockAlign = 0;
+    uint32_t rate = 0;
+    int haveFmt = 0;
+    uint32_t n, bytesPerSample;
+
+    memset(wav, 0, sizeof(*wav));
+
+    f = fopen(path, "rb");
+    if (!f) return fail(err, errLen, "não foi possível abrir");
+
+    if (fread(hdr, 1, 12, f) != 12 ||
+        memcmp(hdr, "RIFF", 4) != 0 || memcmp(hdr + 8, "WAVE", 4) != 0) {
+        fclose(f);
+        return fail(err, errLen, "não é um arquivo RIFF/WAVE");
+    }
+
+    // Percorre os chunks até encontrar 'fmt ' e 'data'
+    while (fread(ck, 1, 8, f) == 8) {
+        uint32_t len = rd32(ck + 4);
+
+        if (memcmp(ck, "fmt ", 4) == 0) {
+            uint32_t keep = len < sizeof(fmt) ? len : (uint32_t)sizeof(fmt);
+
+            if (len < 16 || fread(fmt, 1, keep, f) != keep) break;
+            if (len > keep) fseek(f, (long)(len - keep), SEEK_CUR);
+
+            format     = rd16(fmt);
+            channels   = rd16(fmt + 2);
+            rate       = rd32(fmt + 4);
+            blockAlign = rd16(fmt + 12);
+            bits       = rd16(fmt + 14);
+            if (format == WAVE_FORMAT_EXTENSIBLE && len >= 26) {
+                format = rd16(fmt + 24);    // SubFormat GUID
+            }
+            haveFmt = 1;
+        } else if (memcmp(ck, "data", 4) == 0) {
+            data = (unsigned char*)malloc(len ? len : 1);
+            if (!data) break;
+            dataLen = (uint32_t)fread(data, 1, len, f);    // aceita arquivo truncado
+            break;
+        } else {
+            fseek(f, (long)(len + (len & 1)), SEEK_CUR);    // chunks têm padding par
+        }
+    }
+    fclose(f);
+
+    if (!haveFmt || !data) {
+        free(data);
+        return fail(err, errLen, "chunks 'fmt ' ou 'data' ausentes");
+    }
+    if (!(format == WAVE_FORMAT_PCM &&
+          (bits == 8 || bits == 16 || bits == 24 || bits == 32)) &&
+        !(format == WAVE_FORMAT_IEEE_FLOAT && bits == 32)) {
+        free(data);
+        return fail(err, errLen, "formato não suportado (PCM 8/16/24/32 ou float32)");
+    }
+    bytesPerSample = bits / 8;
+    if (channels == 0 || blockAlign < channels * bytesPerSample) {
+        free(data);
+        return fail(err, errLen, "cabeçalho 'fmt ' inconsistente");
+    }
+
+    wav->sampleRate = rate;
+    wav->channels   = channels;
+    wav->frames     = dataLen / blockAlign;
+    wav->stereo     = (Int16*)malloc((size_t)wav->frames * 2 * sizeof(Int16) + 1);
+    if (!wav->stereo) {
+        free(data);
+        return fail(err, errLen, "memória insuficiente");
+    }
+
+    for (n = 0; n < wav->frames; n++) {
+        const unsigned char* p = data + (size_t)n * blockAlign;
+        Int16 l = decodeSample(p, format, bits);
+        Int16 r = channels > 1 ? decodeSample(p + bytesPerSample, format, bits) : l;
+
+        wav->stereo[2 * n]     = l;
+        wav->stereo[2 * n + 1] = r;
+    }
+
+    free(data);
+    return 0;
+}
+
+int wavWriteStereo16(const char* path, const Int16* stereo, Uint32 frames,
+                     Uint32 sampleRate)
+{
+    FILE* f = fopen(path, "wb");
+    unsigned char hdr[44];
+    uint32_t dataLen = frames * 4u;
+    uint32_t i;
+
+    if (!f) return -1;
+
+    memcpy(hdr, "RIFF", 4);
+    wr32(hdr + 4, 36u + dataLen);
+    memcpy(hdr + 8, "WAVEfmt ", 8);
+    wr32(hdr + 16, 16);
+    wr16(hdr + 20, WAVE_FORMAT_PCM);
+    wr16(hdr + 22, 2);
+    wr32(hdr + 24, sampleRate);
+    wr32(hdr + 28, sampleRate * 4u);
+    wr16(hdr + 32, 4);
+    wr16(hdr + 34, 16);
+    memcpy(hdr + 36, "data", 4);
+    wr32(hdr + 40, dataLen);
+    fwrite(hdr, 1, sizeof(hdr), f);
+
+    // Little-endian explícito (independe do host)
+    for (i = 0; i < frames * 2u; i++) {
+        unsigned char s[2];
+
+        wr16(s, (uint16_t)stereo[i]);
+        fwrite(s, 1, 2, f);
+    }
+
+    if (fclose(f) != 0) return -1;
+    return 0;
+}
+
+void wavFree(WavAudio* wav)
+{
+    free(wav->stereo);
+    wav->stereo = NULL;
+    wav->frames = 0;
+}
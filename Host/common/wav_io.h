@@ -0,0 +1,29 @@
+//////////////////////////////////////////////////////////////////////////////
+// wav_io.h - Leitura e escrita de arquivos WAV (ferramentas de host)
+//
+// Lê WAV PCM 8/16/24/32 bits ou float 32 bits com qualquer número de
+// canais, percorrendo os chunks RIFF (sem supor cabeçalho de 44 bytes).
+// As amostras são entregues como Int16 estéreo intercalado (L,R), o mesmo
+// formato do RxBuffer da placa: mono é duplicado e canais extras são
+// descartados. A escrita gera sempre PCM 16 bits.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef WAV_IO_H_
+#define WAV_IO_H_
+
+#include "tistdtypes.h"
+
+typedef struct {
+    Uint32 sampleRate;
+    Uint16 channels;        // Canais do arquivo original
+    Uint32 frames;          // Quadros (amostras por canal)
+    Int16* stereo;          // frames * 2 amostras intercaladas (malloc)
+} WavAudio;
+
+// Retorna 0 em sucesso; em erro preenche 'err' (pode ser NULL)
+int  wavRead(const char* path, WavAudio* wav, char* err, Uint16 errLen);
+int  wavWriteStereo16(const char* path, const Int16* stereo, Uint32 frames,
+                      Uint32 sampleRate);
+void wavFree(WavAudio* wav);
+
+#endif /* WAV_IO_H_ */
@@ -0,0 +1,817 @@
+//////////////////////////////////////////////////////////////////////////////
+// ref_models.c - Modelos de referência em double (ver ref_models.h)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "ref_models.h"
+#include "effects_controller.h"
+#include "flanger.h"
+#include "tremolo.h"
+#include "reverb.h"
+#include "conv_reverb.h"
+#include "pitch_shift.h"
+#include "dma.h"
+
+#define TWO_PI      (2.0 * M_PI)
+#define PHASE_SCALE 4294967296.0        // 2^32: fase dos osciladores
+
+// ---------------------------------------------------------------------------
+// Linha de atraso genérica
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    double* buf;
+    Uint32  len;
+    Uint32  pos;
+} RefDelay;
+
+static int delayInit(RefDelay* d, Uint32 len)
+{
+    d->buf = (double*)calloc(len, sizeof(double));
+    d->len = len;
+    d->pos = 0;
+    return d->buf ? 0 : -1;
+}
+
+static void delayFree(RefDelay* d)
+{
+    free(d->buf);
+    d->buf = NULL;
+}
+
+// Amostra de 'delay' posições atrás da escrita mais recente (delay >= 0)
+static double delayRead(const RefDelay* d, double delay)
+{
+    Uint32 i0 = (Uint32)floor(delay);
+    double frac = delay - (double)i0;
+    Uint32 a = (d->pos + d->len - 1 - i0 % d->len) % d->len;
+    Uint32 b = (a + d->len - 1) % d->len;
+
+    return d->buf[a] + frac * (d->buf[b] - d->buf[a]);
+}
+
+static void delayWrite(RefDelay* d, double x)
+{
+    d->buf[d->pos] = x;
+    d->pos = (d->pos + 1) % d->len;
+}
+
+// ---------------------------------------------------------------------------
+// Estado da cadeia
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    RefDelay line;
+    double   gain;
+    double   dampState;
+    double   dampScale;         // 1 / 2^damp_shift (1.0 = sem damping)
+} RefComb;
+
+typedef struct {
+    RefDelay line;
+    double   gain;
+} RefAllPass;
+
+typedef struct {
+    RefComb    comb[REVERB_NUM_COMBS];
+    RefAllPass allpass[REVERB_NUM_ALLPASSES];
+} RefReverbCore;
+
+// Metade do tanque do plate
+typedef struct {
+    RefDelay mod;               // All-pass modulado
+    double   modGain, modCenter, modDepth;
+    double   phase, phaseInc;   // LFO (ciclos)
+    RefDelay delay1, allpass, delay2;
+    double   decay1, apGain, decay2;
+    double   dampState, dampScale;
+} RefPlateTank;
+
+typedef struct {
+    Uint8  effect;
+    Uint8  pitchEnabled;
+
+    // Pitch shift
+    RefDelay pitchLine[2];      // L, R
+    double   pitchPhase;        // 0..1
+    double   pitchRate;         // Incremento de fase por quadro
+    double   pitchWindow;       // Janela em quadros
+    int      pitchSync;         // PITCH_MODE_GRAIN_SYNC: reinício no período
+    double   pitchPeriod;       // Período detectado (quadros); 0 = nenhum
+    double   pitchOffset[2];    // Atraso extra de cada grão (quadros)
+    Uint16   pitchSyncPos;      // Quadros no bloco atual
+
+    // Pitch shift por vocoder de fase: anéis de entrada e saída, fases de
+    // análise e de síntese por bin
+    int      pvEnabled;
+    double   pvRatio;
+    double   pvIn[2][PV_FFT_POINTS];
+    double   pvOla[2][PV_FFT_POINTS];
+    double   pvPhase[2][PV_BINS];
+    double   pvSynth[2][PV_BINS];
+    Uint16   pvBase, pvPos;
+
+    // Flanger
+    RefDelay flangerLine[2];
+    double   flangerPhase;      // 0..1
+    double   flangerInc;
+    double   flangerL0, flangerA, flangerG;
+
+    // Tremolo
+    double   tremPhase;
+    double   tremInc;
+    double   tremDepth;
+
+    // Reverb
+    RefReverbCore reverb[2];    // L, R
+    RefComb  fdn[REVERB_FDN_LINES];
+    int      reverbFdn;         // Preset com REVERB_ENGINE_FDN
+    int      reverbPlate;       // Preset com REVERB_ENGINE_PLATE
+    RefAllPass   plateDiffuser[REVERB_PLATE_DIFFUSERS];
+    RefPlateTank plate[2];
+    Uint16       plateTap[2][REVERB_PLATE_TAPS];
+    double   reverbDry, reverbWet;
+
+    // Convolução: IR efetiva (espectros quantizados de conv_ir.h de volta
+    // ao tempo) e histórico linear duplicado de cada canal
+    double*  convIr;
+    double*  convHist[2];
+    Uint32   convHistLen;       // IR + um bloco de latência
+    Uint32   convPos;
+} RefChain;
+
+static RefChain s_ref;
+
+static double q15ToDouble(Int16 x)
+{
+    return (double)x / 32768.0;
+}
+
+static int initReverbCore(RefReverbCore* ref, const ReverbCore* core)
+{
+    Uint16 i;
+
+    for (i = 0; i < REVERB_NUM_COMBS; i++) {
+        const CombFilter* c = &core->comb[i];
+        RefComb* r = &ref->comb[i];
+
+        if (delayInit(&r->line, c->delay_samples) != 0) return -1;
+        r->gain      = q15ToDouble(c->gain_Q15);
+        r->dampState = 0.0;
+        r->dampScale = 1.0 / (double)(1u << c->damp_shift);
+    }
+    for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
+        const AllPassFilter* ap = &core->allpass[i];
+        RefAllPass* r = &ref->allpass[i];
+
+        if (delayInit(&r->line, ap->delay_samples) != 0) return -1;
+        r->gain = q15ToDouble(ap->gain_Q15);
+    }
+    return 0;
+}
+
+static int initFdn(const Reverb* rev)
+{
+    Uint16 i;
+
+    for (i = 0; i < REVERB_FDN_LINES; i++) {
+        const CombFilter* c = &rev->fdn[i];
+        RefComb* r = &s_ref.fdn[i];
+
+        if (delayInit(&r->line, c->delay_samples) != 0) return -1;
+        r->gain      = q15ToDouble(c->gain_Q15);
+        r->dampState = 0.0;
+        r->dampScale = 1.0 / (double)(1u << c->damp_shift);
+    }
+    return 0;
+}
+
+static int initPlate(const Reverb* rev)
+{
+    Uint16 h, i;
+
+    for (i = 0; i < REVERB_PLATE_DIFFUSERS; i++) {
+        const AllPassFilter* ap = &rev->plateDiffuser[i];
+
+        if (delayInit(&s_ref.plateDiffuser[i].line, ap->delay_samples) != 0) return -1;
+        s_ref.plateDiffuser[i].gain = q15ToDouble(ap->gain_Q15);
+    }
+    for (h = 0; h < 2; h++) {
+        const PlateTank* t = &rev->plate[h];
+        RefPlateTank* r = &s_ref.plate[h];
+
+        if (delayInit(&r->mod, t->mod.len) != 0 ||
+            delayInit(&r->delay1, t->delay1.delay_samples) != 0 ||
+            delayInit(&r->allpass, t->allpass.delay_samples) != 0 ||
+            delayInit(&r->delay2, t->delay2.delay_samples) != 0) {
+            return -1;
+        }
+        r->modGain   = q15ToDouble(t->mod.gain_Q15);
+        r->modCenter = (double)t->mod.delay_samples;
+        r->modDepth  = (double)t->mod.depth;
+        r->phase     = (double)t->mod.phase / PHASE_SCALE;
+        r->phaseInc  = (double)t->mod.phase_inc / PHASE_SCALE;
+        r->decay1    = q15ToDouble(t->delay1.gain_Q15);
+        r->apGain    = q15ToDouble(t->allpass.gain_Q15);
+        r->decay2    = q15ToDouble(t->delay2.gain_Q15);
+        r->dampState = 0.0;
+        r->dampScale = 1.0 / (double)(1u << t->delay1.damp_shift);
+        for (i = 0; i < REVERB_PLATE_TAPS; i++) s_ref.plateTap[h][i] = rev->plateTap[h][i];
+    }
+    return 0;
+}
+
+// IDFT real de cada partição (bins 0..N/2 de conv_ir.h): os primeiros
+// CONV_PART_FRAMES pontos são a IR que o kernel aplica
+static int initConv(void)
+{
+    const double scale = ldexp(1.0, CONV_IR_EXP) / CONV_FFT_POINTS;
+    Uint16 p, n, k;
+
+    s_ref.convHistLen = CONV_IR_FRAMES + CONV_PART_FRAMES;
+    s_ref.convIr      = (double*)calloc(CONV_IR_FRAMES, sizeof(double));
+    s_ref.convHist[0] = (double*)calloc(2 * s_ref.convHistLen, sizeof(double));
+    s_ref.convHist[1] = (double*)calloc(2 * s_ref.convHistLen, sizeof(double));
+    if (!s_ref.convIr || !s_ref.convHist[0] || !s_ref.convHist[1]) return -1;
+
+    for (p = 0; p < CONV_IR_PARTITIONS; p++) {
+        const Int16* h = convReverbIrPartition(p);
+
+        for (n = 0; n < CONV_PART_FRAMES; n++) {
+            double v = h[0] + ((n & 1) ? -h[1] : h[1]);
+
+            for (k = 1; k < CONV_FFT_POINTS / 2; k++) {
+                double a = TWO_PI * (double)((Uint32)k * n % CONV_FFT_POINTS) / CONV_FFT_POINTS;
+                v += 2.0 * (h[2 * k] * cos(a) - h[2 * k + 1] * sin(a));
+            }
+            s_ref.convIr[(Uint32)p * CONV_PART_FRAMES + n] = v * scale;
+        }
+    }
+    return 0;
+}
+
+int refChainInit(const HostChainConfig* cfg)
+{
+    refChainFree();
+    memset(&s_ref, 0, sizeof(s_ref));
+
+    s_ref.effect = cfg->effect;
+    s_ref.pitchEnabled = cfg->pitchEnabled;
+
+    if (cfg->pitchEnabled && cfg->pitchMode == PITCH_MODE_VOCODER) {
+        // Mesma razão Q14 do kernel: os bins vão para os mesmos lugares
+        Int32 ratio = 16384L - (g_pitch.delay_rate >> 7);
+
+        s_ref.pvEnabled = 1;
+        s_ref.pvRatio = (double)ratio / 16384.0;
+    } else if (cfg->pitchEnabled) {
+        // A fase do kernel é Q32 e o atraso inteiro são os 11 bits de cima
+        s_ref.pitchWindow = (double)g_pitch.window_size;
+        s_ref.pitchRate   = (1.0 - (double)cfg->pitchFreq / ROOT_FREQ_HZ)
+                          / s_ref.pitchWindow;
+        s_ref.pitchPhase  = 0.0;
+        s_ref.pitchSync   = cfg->pitchMode == PITCH_MODE_GRAIN_SYNC;
+        if (delayInit(&s_ref.pitchLine[0], PITCH_BUF_SIZE) != 0 ||
+            delayInit(&s_ref.pitchLine[1], PITCH_BUF_SIZE) != 0) {
+            return -1;
+        }
+    }
+
+    switch (cfg->effect) {
+        case EFFECT_FLANGER:
+            s_ref.flangerInc = (double)LFO_INC / PHASE_SCALE;
+            s_ref.flangerL0  = (double)FLANGER_L0;
+            s_ref.flangerA   = (double)FLANGER_A;
+            s_ref.flangerG   = q15ToDouble(FLANGER_G);
+            if (delayInit(&s_ref.flangerLine[0], FLANGER_DELAY_SIZE) != 0 ||
+                delayInit(&s_ref.flangerLine[1], FLANGER_DELAY_SIZE) != 0) {
+                return -1;
+            }
+            break;
+
+        case EFFECT_TREMOLO:
+            s_ref.tremInc   = (double)g_tremolo.phase_inc / PHASE_SCALE;
+            s_ref.tremDepth = q15ToDouble(g_tremolo.depth);
+            break;
+
+        case EFFECT_REVERB:
+            s_ref.reverbDry = q15ToDouble(g_reverb.dry_gain_Q15);
+            s_ref.reverbWet = q15ToDouble(g_reverb.wet_gain_Q15);
+            s_ref.reverbFdn   = g_reverb.engine == REVERB_ENGINE_FDN;
+            s_ref.reverbPlate = g_reverb.engine == REVERB_ENGINE_PLATE;
+            if (s_ref.reverbFdn) {
+                if (initFdn(&g_reverb) != 0) return -1;
+            } else if (s_ref.reverbPlate) {
+                if (initPlate(&g_reverb) != 0) return -1;
+            } else if (initReverbCore(&s_ref.reverb[0], &g_reverb.left) != 0 ||
+                initReverbCore(&s_ref.reverb[1], &g_reverb.right) != 0) {
+                return -1;
+            }
+            break;
+
+        case EFFECT_CONV_REVERB:
+            if (initConv() != 0) return -1;
+            break;
+
+        default:
+            break;
+    }
+    return 0;
+}
+
+void refChainFree(void)
+{
+    Uint16 c, i;
+
+    for (c = 0; c < 2; c++) {
+        delayFree(&s_ref.pitchLine[c]);
+        delayFree(&s_ref.flangerLine[c]);
+        for (i = 0; i < REVERB_NUM_COMBS; i++) delayFree(&s_ref.reverb[c].comb[i].line);
+        for (i = 0; i < REVERB_NUM_ALLPASSES; i++) delayFree(&s_ref.reverb[c].allpass[i].line);
+    }
+    for (i = 0; i < REVERB_FDN_LINES; i++) delayFree(&s_ref.fdn[i].line);
+    for (i = 0; i < REVERB_PLATE_DIFFUSERS; i++) delayFree(&s_ref.plateDiffuser[i].line);
+    for (c = 0; c < 2; c++) {
+        delayFree(&s_ref.plate[c].mod);
+        delayFree(&s_ref.plate[c].delay1);
+        delayFree(&s_ref.plate[c].allpass);
+        delayFree(&s_ref.plate[c].delay2);
+    }
+    free(s_ref.convIr);
+    free(s_ref.convHist[0]);
+    free(s_ref.convHist[1]);
+    s_ref.convIr = s_ref.convHist[0] = s_ref.convHist[1] = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// Modelos
+// ---------------------------------------------------------------------------
+
+// Os modelos processam um quadro L,R por chamada: fases e LFOs avançam
+// uma vez por quadro, como nos kernels.
+
+// Média L+R 'delay' quadros atrás
+static double pitchMono(double delay)
+{
+    return 0.5 * (delayRead(&s_ref.pitchLine[0], delay) + delayRead(&s_ref.pitchLine[1], delay));
+}
+
+// Período dos últimos quadros, com a mesma AMDF do kernel: decimada, o
+// primeiro vale abaixo de 1/3 da média dos atrasos anteriores e refino
+// em volta, com o vértice do V pelos vizinhos do mínimo
+static double pitchPeriod(void)
+{
+    double hist[PITCH_SYNC_HIST];
+    double sum = 0.0, best = 0.0, prev = 0.0, before = -1.0, after = -1.0;
+    Uint16 bestLag = 0, period = 0, lag, i, j;
+
+    for (i = 0; i < PITCH_SYNC_HIST; i++) {
+        hist[i] = 0.0;
+        for (j = 0; j < PITCH_SYNC_DECIM; j++) hist[i] += pitchMono(i * PITCH_SYNC_DECIM + j);
+        hist[i] /= PITCH_SYNC_DECIM;
+    }
+
+    for (lag = 1; lag <= PITCH_SYNC_MAX_LAG; lag++) {
+        double d = 0.0;
+
+        for (i = 0; i < PITCH_SYNC_WINDOW; i++) d += fabs(hist[i] - hist[i + lag]);
+        sum += d;
+        if (bestLag != 0) {
+            if (d >= best) break;
+            best = d;
+            bestLag = lag;
+        } else if (lag >= PITCH_SYNC_MIN_LAG && 3.0 * d * lag < sum) {
+            best = d;
+            bestLag = lag;
+        }
+    }
+    if (bestLag == 0) return 0.0;
+
+    for (lag = bestLag * PITCH_SYNC_DECIM - (PITCH_SYNC_DECIM - 1);
+         lag <= bestLag * PITCH_SYNC_DECIM + (PITCH_SYNC_DECIM - 1); lag++) {
+        double d = 0.0;
+
+        for (i = 0; i < PITCH_SYNC_FINE_WINDOW; i++) {
+            d += fabs(pitchMono(2 * i) - pitchMono(2 * i + lag));
+        }
+        if (lag == period + 1) after = d;
+        if (period == 0 || d < best) {
+            before = lag > bestLag * PITCH_SYNC_DECIM - (PITCH_SYNC_DECIM - 1) ? prev : -1.0;
+            after = -1.0;
+            best = d;
+            period = lag;
+        }
+        prev = d;
+    }
+    if (before >= 0.0 && after >= 0.0 && fmax(before, after) > best) {
+        return period + 0.5 * (before - after) / (fmax(before, after) - best);
+    }
+    return period;
+}
+
+// Atraso extra do grão que reinicia: múltiplo do período até o outro grão
+static double pitchSyncOffset(double delay, double otherDelay)
+{
+    if (s_ref.pitchPeriod <= 0.0) return 0.0;
+    return otherDelay - delay - s_ref.pitchPeriod * floor((otherDelay - delay) / s_ref.pitchPeriod);
+}
+
+static void pitchFrame(double* lr)
+{
+    double phA = s_ref.pitchPhase;
+    double phB = phA + 0.5;
+    double gainA, gainB;
+    double w = s_ref.pitchWindow;
+    Uint16 ch;
+
+    if (s_ref.pitchSync && s_ref.pitchSyncPos++ % AUDIO_BLOCK_FRAMES == 0) {
+        s_ref.pitchPeriod = pitchPeriod();
+    }
+
+    if (phB >= 1.0) phB -= 1.0;
+    gainA = phA < 0.5 ? 2.0 * phA : 2.0 * (1.0 - phA);
+    gainB = phB < 0.5 ? 2.0 * phB : 2.0 * (1.0 - phB);
+
+    for (ch = 0; ch < 2; ch++) {
+        RefDelay* line = &s_ref.pitchLine[ch];
+
+        delayWrite(line, lr[ch]);
+        lr[ch] = gainA * delayRead(line, phA * w + s_ref.pitchOffset[0])
+               + gainB * delayRead(line, phB * w + s_ref.pitchOffset[1]);
+    }
+
+    s_ref.pitchPhase += s_ref.pitchRate;
+    s_ref.pitchPhase -= floor(s_ref.pitchPhase);
+
+    // Reinício de grão: A quando a fase dá a volta, B quando passa de 1/2
+    if (s_ref.pitchSync) {
+        double a = s_ref.pitchPhase, b = a < 0.5 ? a + 0.5 : a - 0.5;
+
+        if ((phA < 0.5) != (a < 0.5)) {
+            if ((a < 0.5) == (s_ref.pitchRate > 0.0)) {
+                s_ref.pitchOffset[0] = pitchSyncOffset(a * w, b * w + s_ref.pitchOffset[1]);
+            } else {
+                s_ref.pitchOffset[1] = pitchSyncOffset(b * w, a * w + s_ref.pitchOffset[0]);
+            }
+        }
+    }
+}
+
+// FFT complexa radix-2 in-place em double (sign = -1 direta, +1 inversa)
+static void refFft(double* re, double* im, Uint16 n, double sign)
+{
+    Uint16 i, j, len, k;
+
+    for (i = 1, j = 0; i < n; i++) {
+        Uint16 bit = n >> 1;
+
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            double t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+    for (len = 2; len <= n; len <<= 1) {
+        for (k = 0; k < len / 2; k++) {
+            double a = sign * TWO_PI * k / len;
+            double wr = cos(a), wi = sin(a);
+
+            for (i = k; i < n; i += len) {
+                Uint16 m = i + len / 2;
+                double xr = re[m] * wr - im[m] * wi;
+                double xi = re[m] * wi + im[m] * wr;
+
+                re[m] = re[i] - xr;
+                im[m] = im[i] - xi;
+                re[i] += xr;
+                im[i] += xi;
+            }
+        }
+    }
+}
+
+static double pvHann(Uint16 t)
+{
+    return 0.5 - 0.5 * cos(TWO_PI * t / PV_FFT_POINTS);
+}
+
+// Pico de módulo a que o bin k pertence (mesma regra do kernel)
+static Uint16 pvPeakOf(const double* mag, Uint16 k)
+{
+    for (;;) {
+        double lo = k > 1 ? mag[k - 1] : -1.0;
+        double hi = k < PV_BINS - 1 ? mag[k + 1] : -1.0;
+
+        if (lo <= mag[k] && hi <= mag[k]) return k;
+        k = lo > hi ? k - 1 : k + 1;
+    }
+}
+
+// Um hop do canal ch: análise, travamento, deslocamento e overlap-add
+static void pvHop(Uint16 ch)
+{
+    static double re[PV_FFT_POINTS], im[PV_FFT_POINTS];
+    static double mag[PV_BINS], adv[PV_BINS], outMag[PV_BINS], outPh[PV_BINS];
+    double* phase = s_ref.pvPhase[ch];
+    double* synth = s_ref.pvSynth[ch];
+    const double r = s_ref.pvRatio;
+    double dc;
+    Uint16 t, k, p;
+
+    for (t = 0; t < PV_FFT_POINTS; t++) {
+        re[t] = s_ref.pvIn[ch][(s_ref.pvBase + t) & PV_FFT_MASK] * pvHann(t);
+        im[t] = 0.0;
+    }
+    refFft(re, im, PV_FFT_POINTS, -1.0);
+
+    // Frequência de cada bin pela diferença de fase (desvio principal)
+    dc = re[0];
+    for (k = 1; k < PV_BINS; k++) {
+        double ph = atan2(im[k], re[k]);
+        double dev = ph - phase[k] - TWO_PI * k * PV_HOP / PV_FFT_POINTS;
+
+        dev -= TWO_PI * floor(dev / TWO_PI + 0.5);
+        mag[k] = hypot(re[k], im[k]);
+        adv[k] = r * (TWO_PI * k * PV_HOP / PV_FFT_POINTS + dev);
+        phase[k] = ph;
+    }
+    for (k = 1; k < PV_BINS; k++) {
+        if (pvPeakOf(mag, k) == k) synth[k] += adv[k];
+    }
+    for (k = 1; k < PV_BINS; k++) {
+        p = pvPeakOf(mag, k);
+        if (p != k) synth[k] = synth[p] + phase[k] - phase[p];
+    }
+
+    // Deslocamento rígido de cada pico com os vizinhos; no mesmo destino
+    // os módulos somam e fica a fase do mais forte
+    for (k = 0; k < PV_BINS; k++) outMag[k] = outPh[k] = 0.0;
+    for (k = 1; k < PV_BINS; k++) {
+        Int32 j;
+
+        p = pvPeakOf(mag, k);
+        j = (Int32)k + (Int32)floor(p * r + 0.5) - p;
+        if (j < 1 || j >= PV_BINS) continue;
+        if (mag[k] > outMag[j]) outPh[j] = synth[k];
+        outMag[j] += mag[k];
+    }
+
+    // Espectro hermitiano (Nyquist zerado) e IFFT
+    re[0] = dc;
+    im[0] = 0.0;
+    re[PV_BINS] = im[PV_BINS] = 0.0;
+    for (k = 1; k < PV_BINS; k++) {
+        re[k] = outMag[k] * cos(outPh[k]);
+        im[k] = outMag[k] * sin(outPh[k]);
+        re[PV_FFT_POINTS - k] = re[k];
+        im[PV_FFT_POINTS - k] = -im[k];
+    }
+    refFft(re, im, PV_FFT_POINTS, 1.0);
+
+    // Hann x Hann com 75% de sobreposição soma 1.5
+    for (t = 0; t < PV_FFT_POINTS; t++) {
+        s_ref.pvOla[ch][(s_ref.pvBase + t) & PV_FFT_MASK] +=
+            re[t] / PV_FFT_POINTS * pvHann(t) * (2.0 / 3.0);
+    }
+}
+
+// Mesmo anel do kernel: saída com PV_FFT_POINTS quadros de atraso
+static void pvFrame(double* lr)
+{
+    Uint16 n = (s_ref.pvBase + s_ref.pvPos) & PV_FFT_MASK;
+    Uint16 ch;
+
+    for (ch = 0; ch < 2; ch++) {
+        s_ref.pvIn[ch][n] = lr[ch];
+        lr[ch] = s_ref.pvOla[ch][n];
+        s_ref.pvOla[ch][n] = 0.0;
+    }
+    if (++s_ref.pvPos == PV_HOP) {
+        s_ref.pvBase = (s_ref.pvBase + PV_HOP) & PV_FFT_MASK;
+        s_ref.pvPos = 0;
+        pvHop(0);
+        pvHop(1);
+    }
+}
+
+static void flangerFrame(double* lr)
+{
+    double delay;
+    Uint16 ch;
+
+    // O kernel avança a fase antes de ler o LFO
+    s_ref.flangerPhase += s_ref.flangerInc;
+    s_ref.flangerPhase -= floor(s_ref.flangerPhase);
+
+    delay = s_ref.flangerL0 + s_ref.flangerA * sin(TWO_PI * s_ref.flangerPhase);
+    if (delay < 1.0) delay = 1.0;
+
+    for (ch = 0; ch < 2; ch++) {
+        RefDelay* line = &s_ref.flangerLine[ch];
+        double x = lr[ch];
+
+        // Leitura antes da escrita: atraso 1 = amostra anterior
+        lr[ch] = x + s_ref.flangerG * delayRead(line, delay - 1.0);
+        delayWrite(line, x);
+    }
+}
+
+static void tremoloFrame(double* lr)
+{
+    double half = 0.5 * s_ref.tremDepth;
+    double gain = (1.0 - half) + half * sin(TWO_PI * s_ref.tremPhase);
+
+    lr[0] *= gain;
+    lr[1] *= gain;
+
+    s_ref.tremPhase += s_ref.tremInc;
+    s_ref.tremPhase -= floor(s_ref.tremPhase);
+}
+
+static double reverbSample(double x, RefReverbCore* core)
+{
+    double acc = 0.0, ap;
+    Uint16 i;
+
+    for (i = 0; i < REVERB_NUM_COMBS; i++) {
+        RefComb* c = &core->comb[i];
+        double delayed = c->line.buf[c->line.pos];
+
+        c->dampState += (delayed - c->dampState) * c->dampScale;
+        acc += c->dampState;
+        delayWrite(&c->line, x + c->gain * c->dampState);
+    }
+
+    ap = 0.25 * acc;
+    for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
+        RefAllPass* a = &core->allpass[i];
+        double delayed = a->line.buf[a->line.pos];
+        double v = ap + a->gain * delayed;
+
+        delayWrite(&a->line, v);
+        ap = -a->gain * v + delayed;
+    }
+
+    return s_ref.reverbDry * x + s_ref.reverbWet * ap;
+}
+
+// FDN: matriz de Householder I - (2/N) 11^T sobre as saídas amortecidas,
+// L e R entram e saem de todas as linhas com os sinais do kernel
+static void fdnFrame(double* lr)
+{
+    double s[REVERB_FDN_LINES];
+    double sum = 0.0, yl = 0.0, yr = 0.0;
+    Uint16 i;
+
+    for (i = 0; i < REVERB_FDN_LINES; i++) {
+        RefComb* c = &s_ref.fdn[i];
+
+        c->dampState += (c->line.buf[c->line.pos] - c->dampState) * c->dampScale;
+        s[i] = c->dampState;
+        sum += s[i];
+        yl  += REVERB_FDN_SIGN_L(i) * s[i];
+        yr  += REVERB_FDN_SIGN_R(i) * s[i];
+    }
+
+    for (i = 0; i < REVERB_FDN_LINES; i++) {
+        RefComb* c = &s_ref.fdn[i];
+        double in = 0.5 * (REVERB_FDN_SIGN_L(i) * lr[0] + REVERB_FDN_SIGN_R(i) * lr[1]);
+        double mixed = s[i] - sum * (2.0 / REVERB_FDN_LINES);
+
+        delayWrite(&c->line, in + c->gain * mixed);
+    }
+
+    lr[0] = s_ref.reverbDry * lr[0] + s_ref.reverbWet * 0.25 * yl;
+    lr[1] = s_ref.reverbDry * lr[1] + s_ref.reverbWet * 0.25 * yr;
+}
+
+// All-pass com a leitura em 'delayed' (v entra na linha)
+static double allPassStep(RefDelay* line, double gain, double delayed, double x)
+{
+    double v = x + gain * delayed;
+
+    delayWrite(line, v);
+    return -gain * v + delayed;
+}
+
+static const RefDelay* plateTapLine(const RefPlateTank* t, Uint16 j)
+{
+    switch (REVERB_PLATE_TAP_LINE(j)) {
+        case REVERB_PLATE_AP:     return &t->allpass;
+        case REVERB_PLATE_DELAY2: return &t->delay2;
+        default:                  return &t->delay1;
+    }
+}
+
+// Plate (Dattorro): difusores na entrada mono e tanque em oito; os taps
+// contam a partir da escrita do quadro atual
+static void plateFrame(double* lr)
+{
+    double x = 0.25 * (lr[0] + lr[1]);
+    double fb[2];
+    Uint16 h, i, j;
+
+    for (i = 0; i < REVERB_PLATE_DIFFUSERS; i++) {
+        RefAllPass* a = &s_ref.plateDiffuser[i];
+
+        x = allPassStep(&a->line, a->gain, a->line.buf[a->line.pos], x);
+    }
+
+    // Saída do atraso 2 de cada metade antes da escrita deste quadro
+    for (h = 0; h < 2; h++) {
+        fb[h] = s_ref.plate[h].delay2.buf[s_ref.plate[h].delay2.pos];
+    }
+
+    for (h = 0; h < 2; h++) {
+        RefPlateTank* t = &s_ref.plate[h];
+        double tri = t->phase < 0.5 ? 2.0 * t->phase : 2.0 * (1.0 - t->phase);
+        double d = t->modCenter - t->modDepth + 2.0 * t->modDepth * tri;
+        double y = x + s_ref.plate[h ^ 1].decay2 * fb[h ^ 1];
+        double delayed;
+
+        // d quadros atrás: delayRead conta a escrita mais recente como 0
+        y = allPassStep(&t->mod, t->modGain, delayRead(&t->mod, d - 1.0), y);
+        t->phase += t->phaseInc;
+        t->phase -= floor(t->phase);
+
+        delayed = t->delay1.buf[t->delay1.pos];
+        delayWrite(&t->delay1, y);
+        t->dampState += (delayed - t->dampState) * t->dampScale;
+        y = t->decay1 * t->dampState;
+
+        y = allPassStep(&t->allpass, t->apGain, t->allpass.buf[t->allpass.pos], y);
+        delayWrite(&t->delay2, y);
+    }
+
+    for (h = 0; h < 2; h++) {
+        double acc = 0.0;
+
+        for (j = 0; j < REVERB_PLATE_TAPS; j++) {
+            const RefPlateTank* t = &s_ref.plate[REVERB_PLATE_TAP_HALF(h, j)];
+
+            acc += REVERB_PLATE_TAP_SIGN(j) * delayRead(plateTapLine(t, j), s_ref.plateTap[h][j]);
+        }
+        lr[h] = s_ref.reverbDry * lr[h] + s_ref.reverbWet * 0.5 * acc;
+    }
+}
+
+// y[n] = soma h[m] * x[n - B - m]: convolução com um bloco de atraso
+static void convFrame(double* lr)
+{
+    const Uint32 len = s_ref.convHistLen;
+    Uint32 pos = s_ref.convPos;
+    Uint16 ch;
+    Uint32 m;
+
+    for (ch = 0; ch < 2; ch++) {
+        double* hist = s_ref.convHist[ch];
+        const double* x;
+        double acc = 0.0;
+
+        // Cópia dupla: hist[pos + 1 .. pos + len] é a janela em ordem
+        hist[pos] = hist[pos + len] = lr[ch];
+        x = &hist[pos + len - CONV_PART_FRAMES];
+        for (m = 0; m < CONV_IR_FRAMES; m++) acc += s_ref.convIr[m] * x[-(long)m];
+        lr[ch] = acc;
+    }
+    s_ref.convPos = pos + 1 == len ? 0 : pos + 1;
+}
+
+void refChainProcess(const double* in, double* out, Uint32 words)
+{
+    Uint32 i;
+
+    for (i = 0; i + 1 < words; i += 2) {
+        double lr[2];
+
+        lr[0] = in[i];
+        lr[1] = in[i + 1];
+
+        if (s_ref.pvEnabled) pvFrame(lr);
+        else if (s_ref.pitchEnabled) pitchFrame(lr);
+
+        switch (s_ref.effect) {
+            case EFFECT_FLANGER: flangerFrame(lr); break;
+            case EFFECT_TREMOLO: tremoloFrame(lr); break;
+            case EFFECT_REVERB:
+                if (s_ref.reverbFdn) {
+                    fdnFrame(lr);
+                    break;
+                }
+                if (s_ref.reverbPlate) {
+                    plateFrame(lr);
+                    break;
+                }
+                lr[0] = reverbSample(lr[0], &s_ref.reverb[0]);
+                lr[1] = reverbSample(lr[1], &s_ref.reverb[1]);
+                break;
+            case EFFECT_CONV_REVERB: convFrame(lr); break;
+            default: break;
+        }
+        out[i]     = lr[0];
+        out[i + 1] = lr[1];
+    }
+}
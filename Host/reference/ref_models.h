@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////////////////////////////
+// ref_models.h - Modelos de referência em double dos efeitos embarcados
+//
+// Cada modelo implementa a mesma equação dos kernels Q15 de
+// Final_Project_Pro_MAX, com os mesmos parâmetros, mas sem quantização,
+// tabelas ou saturação interna:
+//
+//   flanger   y = x + G * x[n - (L0 + A*sin(2*pi*fase))], interpolação
+//             linear, fase de 32 bits com incremento LFO_INC
+//   tremolo   y = x * ((1 - d/2) + d/2 * sin(2*pi*fase))
+//   reverb    4 combs paralelos com damping de 1 polo + 2 all-pass em
+//             série por canal, mix dry/wet
+//   conv      y = soma h[m] * x[n - B - m] (B = um bloco), com a IR que
+//             os espectros de conv_ir.h representam
+//   pitch     dois grãos com delay = fase * janela, janelas triangulares
+//             defasadas de 180 graus
+//   pitch pv  vocoder de fase: STFT com Hann (PV_FFT_POINTS, hop PV_HOP),
+//             travamento de fase nos picos, cada pico e seus vizinhos
+//             deslocados de round(pico * razão) - pico bins, overlap-add
+//
+// Os atrasos, ganhos e incrementos são lidos dos #defines e do estado dos
+// kernels depois de hostChainApply(): a referência acompanha qualquer
+// mudança de preset no firmware. Os ganhos em Q15 são convertidos de volta
+// para double (erro de quantização de coeficiente < 2^-15).
+//
+// Assim como processAudioBlock(), os modelos recebem o fluxo intercalado
+// L,R: cada canal tem seu próprio estado e os osciladores avançam uma vez
+// por quadro.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef REF_MODELS_H_
+#define REF_MODELS_H_
+
+#include "tistdtypes.h"
+#include "effect_chain.h"
+
+// Prepara a cadeia de referência para 'cfg'. Deve ser chamada logo após
+// hostChainApply(cfg), com os kernels no estado de reset.
+// Retorna 0 em sucesso, -1 sem memória.
+int  refChainInit(const HostChainConfig* cfg);
+
+// Processa 'words' palavras intercaladas (escala 1.0 = fundo de escala).
+// Pode ser chamada em pedaços de qualquer tamanho par (quadros inteiros).
+void refChainProcess(const double* in, double* out, Uint32 words);
+
+void refChainFree(void);
+
+#endif /* REF_MODELS_H_ */
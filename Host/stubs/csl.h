@@ -0,0 +1,21 @@
+//////////////////////////////////////////////////////////////////////////////
+// csl.h - Stub da Chip Support Library para o build no PC (host)
+//
+// Substitui o csl.h do C55xxCSL apenas no build de host. Nenhum registrador
+// é acessado: as funções existem para que dma.c/effects_* compilem e linkem
+// em gcc/clang sem alterar o código do firmware.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_CSL_H_
+#define HOST_CSL_H_
+
+#include "tistdtypes.h"
+
+// Palavra-chave de ISR do compilador TI (cl55) não existe no gcc/clang
+#ifndef interrupt
+#define interrupt
+#endif
+
+void CSL_init(void);
+
+#endif /* HOST_CSL_H_ */
@@ -0,0 +1,64 @@
+//////////////////////////////////////////////////////////////////////////////
+// csl_dma.h - Stub do módulo DMA da CSL para o build no PC (host)
+//
+// Mantém o layout de DMA_Config do C5502 (13 campos) para que os
+// inicializadores estáticos de dma.c compilem sem alteração. As macros
+// _RMK descartam os argumentos: no host não há registradores a montar.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_CSL_DMA_H_
+#define HOST_CSL_DMA_H_
+
+#include "csl.h"
+
+// Endereços de DMA no C5502 são endereços de byte de 24 bits;
+// no host basta um inteiro (evita casts ponteiro <-> inteiro)
+typedef Uint32 DMA_AdrPtr;
+
+typedef struct {
+    Uint16     dmacsdp;
+    Uint16     dmaccr;
+    Uint16     dmacicr;
+    DMA_AdrPtr dmacssal;
+    Uint16     dmacssau;
+    DMA_AdrPtr dmacdsal;
+    Uint16     dmacdsau;
+    Uint16     dmacen;
+    Uint16     dmacfn;
+    Int16      dmacsfi;
+    Int16      dmacsei;
+    Int16      dmacdfi;
+    Int16      dmacdei;
+} DMA_Config;
+
+typedef struct {
+    Uint16     chaNum;
+    Uint16     eventId;
+    Uint16     running;
+    DMA_Config config;
+} DMA_Obj;
+
+typedef DMA_Obj* DMA_Handle;
+
+// Canais
+#define DMA_CHA0     0
+#define DMA_CHA1     1
+#define DMA_CHA2     2
+#define DMA_CHA3     3
+#define DMA_CHA4     4
+#define DMA_CHA5     5
+#define DMA_CHA_CNT  6
+
+// Montagem de registradores: sem efeito no host
+#define DMA_DMACSDP_RMK(...)  0
+#define DMA_DMACCR_RMK(...)   0
+#define DMA_DMACICR_RMK(...)  0
+
+DMA_Handle DMA_open(int chaNum, Uint32 flags);
+void       DMA_close(DMA_Handle hDma);
+void       DMA_config(DMA_Handle hDma, DMA_Config* config);
+void       DMA_start(DMA_Handle hDma);
+void       DMA_stop(DMA_Handle hDma);
+Uint16     DMA_getEventId(DMA_Handle hDma);
+
+#endif /* HOST_CSL_DMA_H_ */
@@ -0,0 +1,21 @@
+//////////////////////////////////////////////////////////////////////////////
+// csl_irq.h - Stub do módulo IRQ da CSL para o build no PC (host)
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_CSL_IRQ_H_
+#define HOST_CSL_IRQ_H_
+
+#include "csl.h"
+
+typedef void (*IRQ_IsrPtr)(void);
+
+void IRQ_setVecs(Uint32 vecs);
+void IRQ_globalEnable(void);
+void IRQ_globalDisable(void);
+
+void IRQ_enable(Uint16 eventId);
+void IRQ_disable(Uint16 eventId);
+void IRQ_clear(Uint16 eventId);
+void IRQ_plug(Uint16 eventId, IRQ_IsrPtr isr);
+
+#endif /* HOST_CSL_IRQ_H_ */
@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////////////
+// csl_stubs.c - Implementação vazia da CSL/BSL para o build no PC (host)
+//
+// Só o necessário para linkar dma.c fora da placa. Os canais de DMA são
+// objetos estáticos que guardam a última configuração recebida.
+//////////////////////////////////////////////////////////////////////////////
+
+#include "csl.h"
+#include "csl_dma.h"
+#include "csl_irq.h"
+#include "ezdsp5502.h"
+#include "ezdsp5502_mcbsp.h"
+#include "host_stubs.h"
+
+// Garante em tempo de compilação que tistdtypes.h reproduz as larguras do
+// C55x no host (um array de tamanho negativo não compila)
+typedef char c55xInt16Check [(sizeof(Int16)  == 2) ? 1 : -1];
+typedef char c55xIntCheck   [(sizeof(Int)    == 2) ? 1 : -1];
+typedef char c55xUint8Check [(sizeof(Uint8)  == 2) ? 1 : -1];
+typedef char c55xInt32Check [(sizeof(Int32)  == 4) ? 1 : -1];
+typedef char c55xUint32Check[(sizeof(Uint32) == 4) ? 1 : -1];
+
+// Ids de evento dos canais de DMA (mesma ordem do C5502: DMAC0..DMAC5)
+#define DMA_EVENT_BASE 8
+#define IRQ_EVENT_CNT  32
+
+static DMA_Obj s_dmaChannels[DMA_CHA_CNT];
+
+static IRQ_IsrPtr s_irqTable[IRQ_EVENT_CNT];
+static Uint16     s_irqEnabled[IRQ_EVENT_CNT];
+
+// =================== CSL ===================
+
+void CSL_init(void) {}
+
+// =================== DMA ===================
+
+DMA_Handle DMA_open(int chaNum, Uint32 flags)
+{
+    DMA_Handle h;
+    (void)flags;
+
+    if (chaNum < 0 || chaNum >= DMA_CHA_CNT) return (DMA_Handle)0;
+
+    h = &s_dmaChannels[chaNum];
+    h->chaNum  = (Uint16)chaNum;
+    h->eventId = (Uint16)(DMA_EVENT_BASE + chaNum);
+    h->running = 0;
+    return h;
+}
+
+void DMA_close(DMA_Handle hDma)
+{
+    if (hDma) hDma->running = 0;
+}
+
+void DMA_config(DMA_Handle hDma, DMA_Config* config)
+{
+    if (hDma && config) hDma->config = *config;
+}
+
+void DMA_start(DMA_Handle hDma)
+{
+    if (hDma) hDma->running = 1;
+}
+
+void DMA_stop(DMA_Handle hDma)
+{
+    if (hDma) hDma->running = 0;
+}
+
+Uint16 DMA_getEventId(DMA_Handle hDma)
+{
+    return hDma ? hDma->eventId : 0;
+}
+
+// =================== IRQ ===================
+
+void IRQ_setVecs(Uint32 vecs) { (void)vecs; }
+void IRQ_globalEnable(void) {}
+void IRQ_globalDisable(void) {}
+
+void IRQ_enable(Uint16 eventId)
+{
+    if (eventId < IRQ_EVENT_CNT) s_irqEnabled[eventId] = 1;
+}
+
+void IRQ_disable(Uint16 eventId)
+{
+    if (eventId < IRQ_EVENT_CNT) s_irqEnabled[eventId] = 0;
+}
+
+void IRQ_clear(Uint16 eventId) { (void)eventId; }
+
+void IRQ_plug(Uint16 eventId, IRQ_IsrPtr isr)
+{
+    if (eventId < IRQ_EVENT_CNT) s_irqTable[eventId] = isr;
+}
+
+// =================== BSL ===================
+
+Int16 EZDSP5502_init(void) { return 0; }
+void  EZDSP5502_wait(Uint32 delay) { (void)delay; }
+void  EZDSP5502_waitusec(Uint32 usec) { (void)usec; }
+
+Int16 EZDSP5502_MCBSP_init(void) { return 0; }
+void  EZDSP5502_MCBSP_close(void) {}
+
+// =================== Acesso do host (host_stubs.h) ===================
+
+Uint16 hostDmaEventId(int chaNum)
+{
+    if (chaNum < 0 || chaNum >= DMA_CHA_CNT) return 0;
+    return (Uint16)(DMA_EVENT_BASE + chaNum);
+}
+
+Uint16 hostDmaRunning(int chaNum)
+{
+    if (chaNum < 0 || chaNum >= DMA_CHA_CNT) return 0;
+    return s_dmaChannels[chaNum].running;
+}
+
+IRQ_IsrPtr hostIrqIsr(Uint16 eventId)
+{
+    return eventId < IRQ_EVENT_CNT ? s_irqTable[eventId] : (IRQ_IsrPtr)0;
+}
+
+Uint16 hostIrqEnabled(Uint16 eventId)
+{
+    return eventId < IRQ_EVENT_CNT ? s_irqEnabled[eventId] : 0;
+}
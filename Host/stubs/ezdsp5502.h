@@ -0,0 +1,14 @@
+//////////////////////////////////////////////////////////////////////////////
+// ezdsp5502.h - Stub do BSL do eZdsp5502 para o build no PC (host)
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_EZDSP5502_H_
+#define HOST_EZDSP5502_H_
+
+#include "csl.h"
+
+Int16 EZDSP5502_init(void);
+void  EZDSP5502_wait(Uint32 delay);
+void  EZDSP5502_waitusec(Uint32 usec);
+
+#endif /* HOST_EZDSP5502_H_ */
@@ -0,0 +1,13 @@
+//////////////////////////////////////////////////////////////////////////////
+// ezdsp5502_mcbsp.h - Stub da McBSP do BSL para o build no PC (host)
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_EZDSP5502_MCBSP_H_
+#define HOST_EZDSP5502_MCBSP_H_
+
+#include "ezdsp5502.h"
+
+Int16 EZDSP5502_MCBSP_init(void);
+void  EZDSP5502_MCBSP_close(void);
+
+#endif /* HOST_EZDSP5502_MCBSP_H_ */
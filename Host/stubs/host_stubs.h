@@ -0,0 +1,22 @@
+//////////////////////////////////////////////////////////////////////////////
+// host_stubs.h - Acesso ao estado dos stubs de CSL (somente build de host)
+//
+// Permite que o simulador veja o que o firmware configurou: qual ISR foi
+// ligada a cada evento e quais canais de DMA estão rodando.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef HOST_STUBS_H_
+#define HOST_STUBS_H_
+
+#include "csl_dma.h"
+#include "csl_irq.h"
+
+// Id de evento de interrupção do canal de DMA 'chaNum'
+Uint16     hostDmaEventId(int chaNum);
+Uint16     hostDmaRunning(int chaNum);
+
+// ISR registrada por IRQ_plug (NULL se nenhuma) e se o evento está habilitado
+IRQ_IsrPtr hostIrqIsr(Uint16 eventId);
+Uint16     hostIrqEnabled(Uint16 eventId);
+
+#endif /* HOST_STUBS_H_ */
@@ -0,0 +1,374 @@
+//////////////////////////////////////////////////////////////////////////////
+// golden_test.c - Regressão bit a bit dos kernels Q15 contra vetores de ouro
+//
+// Para cada configuração de effect_chain.c (todos os efeitos e presets do
+// SW1) e cada sinal de entrada, processa o sinal bloco a bloco com
+// processAudioBlock() a partir do estado de reset e compara a saída, amostra
+// por amostra, com a saída esperada versionada em golden/.
+//
+// Comprimento: GOLDEN_BLOCKS blocos de AUDIO_BLOCK_SIZE; nos reverbs, pelo
+// menos duas voltas da linha mais longa do preset (e duas vezes a IR da
+// convolução), para que a realimentação e o FDL entrem na comparação. As
+// entradas têm GOLDEN_MAX_BLOCKS blocos e cada configuração usa o começo.
+//
+// Sinais (estéreo intercalado):
+//   impulse   impulso de fundo de escala (L no quadro 0, R no quadro 64)
+//   sweep     varredura logarítmica 20 Hz -> 20 kHz, -3 dBFS, repetida a
+//             cada GOLDEN_BLOCKS blocos
+//   noise     ruído branco uniforme (LCG fixo), L e R independentes
+//   square    quadrada de fundo de escala (1 kHz em L, 750 Hz em R)
+//   tail      ruído por 2 blocos seguido de silêncio (cauda dos efeitos)
+//
+// Arquivos: golden/input/<sinal>.q15 e golden/expected/<config>/<sinal>.q15,
+// Int16 little-endian. Entradas e saídas são lidas do disco: os geradores
+// abaixo só rodam com --update, para que a entrada nunca dependa da libm.
+//
+// Uso:
+//   golden_test --dir golden/              compara (ctest)
+//   golden_test --dir golden/ --update     regrava entradas e saídas
+//   ... [--config nome]                    só uma configuração
+//
+// Uma mudança de kernel que altere o som de propósito deve vir com os
+// vetores regravados por --update no mesmo commit.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include "dma.h"
+#include "effect_chain.h"
+#include "effects_controller.h"
+#include "reverb_presets.h"     // REVERB_PRESETS (atrasos das linhas)
+
+#define GOLDEN_BLOCKS     8
+#define GOLDEN_MAX_BLOCKS 192       // 1.02 s: duas voltas do ROOM 2 (24023)
+#define GOLDEN_WORDS      (GOLDEN_MAX_BLOCKS * AUDIO_BLOCK_SIZE)
+#define GOLDEN_FRAMES     (GOLDEN_WORDS / AUDIO_NUM_CHANNELS)
+#define GOLDEN_PATH_LEN   512
+#define GOLDEN_MAX_REPORT 4         // Divergências impressas por vetor
+
+typedef void (*SignalGen)(Int16* out);
+
+typedef struct {
+    const char* name;
+    SignalGen   generate;
+} GoldenSignal;
+
+static Int16 s_input[GOLDEN_WORDS];
+static Int16 s_output[GOLDEN_WORDS];
+static Int16 s_expected[GOLDEN_WORDS];
+static unsigned char s_bytes[GOLDEN_WORDS * 2];
+
+// ---------------------------------------------------------------------------
+// Geradores (apenas com --update)
+// ---------------------------------------------------------------------------
+
+static Uint32 s_seed;
+
+static Int16 noiseSample(Int16 amplitude)
+{
+    s_seed = s_seed * 1664525u + 1013904223u;
+    return (Int16)(((Int32)(Int16)(s_seed >> 16) * amplitude) >> 15);
+}
+
+static Int16 toQ15(double x)
+{
+    double v = floor(x * 32768.0 + 0.5);
+    if (v > 32767.0)  v = 32767.0;
+    if (v < -32768.0) v = -32768.0;
+    return (Int16)v;
+}
+
+static void genImpulse(Int16* out)
+{
+    memset(out, 0, GOLDEN_WORDS * sizeof(Int16));
+    out[0] = 32767;
+    out[64 * 2 + 1] = 32767;
+}
+
+static void genSweep(Int16* out)
+{
+    const double f0 = 20.0, f1 = 20000.0;
+    const Uint32 period = (Uint32)GOLDEN_BLOCKS * AUDIO_BLOCK_FRAMES;
+    const double T = (double)period / AUDIO_SAMPLE_RATE;
+    const double k = log(f1 / f0);
+    Uint32 n;
+
+    for (n = 0; n < GOLDEN_FRAMES; n++) {
+        double t = (double)(n % period) / AUDIO_SAMPLE_RATE;
+        double phase = 2.0 * M_PI * f0 * T / k * (exp(t * k / T) - 1.0);
+        Int16 v = toQ15(0.7071 * sin(phase));
+        out[2 * n]     = v;
+        out[2 * n + 1] = v;
+    }
+}
+
+static void genNoise(Int16* out)
+{
+    Uint32 i;
+
+    s_seed = 0x1234567u;
+    for (i = 0; i < GOLDEN_WORDS; i++) {
+        out[i] = noiseSample(16384);
+    }
+}
+
+static void genSquare(Int16* out)
+{
+    Uint32 n;
+
+    // Períodos inteiros em quadros: 48 (1 kHz) e 64 (750 Hz)
+    for (n = 0; n < GOLDEN_FRAMES; n++) {
+        out[2 * n]     = (n % 48) < 24 ? 32767 : -32768;
+        out[2 * n + 1] = (n % 64) < 32 ? 32767 : -32768;
+    }
+}
+
+static void genTail(Int16* out)
+{
+    Uint32 i;
+
+    s_seed = 0x7654321u;
+    memset(out, 0, GOLDEN_WORDS * sizeof(Int16));
+    for (i = 0; i < 2 * AUDIO_BLOCK_SIZE; i++) {
+        out[i] = noiseSample(24576);
+    }
+}
+
+static const GoldenSignal s_signals[] = {
+    { "impulse", genImpulse },
+    { "sweep",   genSweep   },
+    { "noise",   genNoise   },
+    { "square",  genSquare  },
+    { "tail",    genTail    },
+};
+
+#define GOLDEN_SIGNAL_COUNT (sizeof(s_signals) / sizeof(s_signals[0]))
+
+// ---------------------------------------------------------------------------
+// Arquivos
+// ---------------------------------------------------------------------------
+
+static int makeDir(const char* path)
+{
+    if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "golden_test: não foi possível criar %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+static int readVector(const char* path, Int16* v, Uint32 words)
+{
+    FILE* f = fopen(path, "rb");
+    size_t n;
+    Uint32 i;
+
+    if (!f) {
+        fprintf(stderr, "golden_test: %s não encontrado (rode com --update)\n", path);
+        return -1;
+    }
+    // Um byte a mais para notar um arquivo maior que o esperado
+    n = fread(s_bytes, 1, 2 * words + (words < GOLDEN_WORDS), f);
+    fclose(f);
+    if (n != 2 * words) {
+        fprintf(stderr, "golden_test: %s: tamanho %s, esperado %lu\n",
+                path, n > 2 * words ? "maior" : "menor", (unsigned long)(2 * words));
+        return -1;
+    }
+    for (i = 0; i < words; i++) {
+        v[i] = (Int16)(s_bytes[2 * i] | (s_bytes[2 * i + 1] << 8));
+    }
+    return 0;
+}
+
+static int writeVector(const char* path, const Int16* v, Uint32 words)
+{
+    FILE* f = fopen(path, "wb");
+    Uint32 i;
+    int ok;
+
+    if (!f) {
+        fprintf(stderr, "golden_test: não foi possível gravar %s\n", path);
+        return -1;
+    }
+    for (i = 0; i < words; i++) {
+        s_bytes[2 * i]     = (unsigned char)((Uint16)v[i] & 0xFF);
+        s_bytes[2 * i + 1] = (unsigned char)((Uint16)v[i] >> 8);
+    }
+    ok = fwrite(s_bytes, 1, 2 * words, f) == 2 * words;
+    return (fclose(f) == 0 && ok) ? 0 : -1;
+}
+
+// ---------------------------------------------------------------------------
+// Execução
+// ---------------------------------------------------------------------------
+
+static Uint16 maxDelay(const ReverbLineLayout* l, Uint16 count, Uint16 longest)
+{
+    Uint16 i;
+
+    for (i = 0; i < count; i++) {
+        if (l[i].delay_samples > longest) longest = l[i].delay_samples;
+    }
+    return longest;
+}
+
+// Blocos comparados em 'cfg': duas voltas da linha mais longa do preset
+// (qualquer motor) ou da IR da convolução
+static Uint16 goldenBlocks(const HostChainConfig* cfg)
+{
+    const ReverbPresetLayout* p = &REVERB_PRESETS[cfg->preset];
+    Uint32 frames = 0;
+    Uint16 blocks;
+
+    if (cfg->effect == EFFECT_CONV_REVERB) {
+        frames = 2UL * CONV_IR_PARTITIONS * CONV_PART_FRAMES;
+    } else if (cfg->effect == EFFECT_REVERB) {
+        Uint16 longest = 0;
+
+        longest = maxDelay(&p->comb[0][0], 2 * REVERB_NUM_COMBS, longest);
+        longest = maxDelay(&p->allpass[0][0], 2 * REVERB_NUM_ALLPASSES, longest);
+        longest = maxDelay(p->fdn, REVERB_FDN_LINES, longest);
+        longest = maxDelay(p->plate_diffuser, REVERB_PLATE_DIFFUSERS, longest);
+        longest = maxDelay(&p->plate_tank[0][0], 2 * REVERB_PLATE_TANK_LINES, longest);
+        frames = 2UL * longest;
+    }
+
+    blocks = (Uint16)((frames + AUDIO_BLOCK_FRAMES - 1) / AUDIO_BLOCK_FRAMES);
+    return blocks > GOLDEN_BLOCKS ? blocks : GOLDEN_BLOCKS;
+}
+
+static void render(const HostChainConfig* cfg, const Int16* in, Int16* out, Uint16 blocks)
+{
+    Uint16 b;
+
+    hostChainApply(cfg);
+    for (b = 0; b < blocks; b++) {
+        hostChainProcess(&in[b * AUDIO_BLOCK_SIZE], &out[b * AUDIO_BLOCK_SIZE]);
+    }
+}
+
+// Retorna o número de amostras divergentes
+static Uint32 compare(const char* config, const char* signal,
+                      const Int16* got, const Int16* want, Uint32 words)
+{
+    Uint32 i, bad = 0;
+    Int32 maxDiff = 0;
+
+    for (i = 0; i < words; i++) {
+        Int32 d = (Int32)got[i] - (Int32)want[i];
+        if (d == 0) continue;
+        if (d < 0) d = -d;
+        if (d > maxDiff) maxDiff = d;
+        if (bad < GOLDEN_MAX_REPORT) {
+            fprintf(stderr, "  %s/%s: quadro %lu %s: obtido %d, esperado %d\n",
+                    config, signal, (unsigned long)(i / 2), (i & 1) ? "R" : "L",
+                    got[i], want[i]);
+        }
+        bad++;
+    }
+    if (bad) {
+        fprintf(stderr, "  %s/%s: %lu de %lu amostras divergentes (erro máx. %ld)\n",
+                config, signal, (unsigned long)bad, (unsigned long)words, (long)maxDiff);
+    }
+    return bad;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "uso: golden_test --dir DIR [--update] [--config nome]\n");
+}
+
+int main(int argc, char** argv)
+{
+    const char* dir = NULL;
+    const char* only = NULL;
+    char path[GOLDEN_PATH_LEN];
+    int update = 0;
+    Uint16 c, s;
+    Uint32 failed = 0, checked = 0;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) {
+            update = 1;
+        } else if (strcmp(argv[i], "--dir") == 0 && i + 1 < argc) {
+            dir = argv[++i];
+        } else if (strcmp(argv[i], "--config") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (!dir) {
+        usage();
+        return 2;
+    }
+    if (only && !hostChainFind(only)) {
+        fprintf(stderr, "golden_test: configuração desconhecida: %s\n", only);
+        return 2;
+    }
+
+    if (update) {
+        snprintf(path, sizeof(path), "%s/input", dir);
+        if (makeDir(dir) != 0 || makeDir(path) != 0) return 2;
+        snprintf(path, sizeof(path), "%s/expected", dir);
+        if (makeDir(path) != 0) return 2;
+
+        for (s = 0; s < GOLDEN_SIGNAL_COUNT; s++) {
+            s_signals[s].generate(s_input);
+            snprintf(path, sizeof(path), "%s/input/%s.q15", dir, s_signals[s].name);
+            if (writeVector(path, s_input, GOLDEN_WORDS) != 0) return 2;
+        }
+    }
+
+    for (c = 0; c < g_hostChainConfigCount; c++) {
+        const HostChainConfig* cfg = &g_hostChainConfigs[c];
+        Uint16 blocks = goldenBlocks(cfg);
+        Uint32 words = (Uint32)blocks * AUDIO_BLOCK_SIZE;
+
+        if (only && strcmp(only, cfg->name) != 0) continue;
+        if (blocks > GOLDEN_MAX_BLOCKS) {
+            fprintf(stderr, "golden_test: %s precisa de %u blocos (GOLDEN_MAX_BLOCKS)\n",
+                    cfg->name, blocks);
+            return 2;
+        }
+
+        if (update) {
+            snprintf(path, sizeof(path), "%s/expected/%s", dir, cfg->name);
+            if (makeDir(path) != 0) return 2;
+        }
+
+        for (s = 0; s < GOLDEN_SIGNAL_COUNT; s++) {
+            const char* sig = s_signals[s].name;
+
+            snprintf(path, sizeof(path), "%s/input/%s.q15", dir, sig);
+            if (readVector(path, s_input, GOLDEN_WORDS) != 0) return 2;
+
+            render(cfg, s_input, s_output, blocks);
+
+            snprintf(path, sizeof(path), "%s/expected/%s/%s.q15", dir, cfg->name, sig);
+            if (update) {
+                if (writeVector(path, s_output, words) != 0) return 2;
+                continue;
+            }
+            if (readVector(path, s_expected, words) != 0) return 2;
+
+            checked++;
+            if (compare(cfg->name, sig, s_output, s_expected, words) != 0) failed++;
+        }
+    }
+
+    if (update) {
+        printf("golden_test: vetores regravados em %s\n", dir);
+        return 0;
+    }
+    printf("golden_test: %lu de %lu vetores idênticos\n",
+           (unsigned long)(checked - failed), (unsigned long)checked);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,338 @@
+//////////////////////////////////////////////////////////////////////////////
+// ref_compare.c - Precisão dos kernels Q15 contra os modelos em double
+//
+// Para cada configuração de effect_chain.c, passa os mesmos sinais pelo
+// kernel (processAudioBlock) e pelo modelo de referência (ref_models.c) e
+// reporta:
+//
+//   snr        10*log10(sum(ref^2) / sum((fx - ref)^2)) em ruído + varredura
+//   max_err    maior |fx - ref| em LSB de 16 bits, em todos os sinais
+//   thdn_fx    THD+N da saída do kernel para um seno de 997 Hz (-12 dBFS),
+//              medida na frequência de saída (997 Hz vezes a razão do pitch
+//              shift, quando ativo)
+//   thdn_ref   o mesmo para a referência. Flanger, tremolo e pitch geram
+//              bandas laterais por projeto; o que a quantização acrescenta
+//              é a diferença entre as duas colunas.
+//
+// As entradas são quantizadas para Q15 antes de ir para os dois caminhos:
+// o erro medido é só o do processamento. A saída da referência é limitada
+// a [-1, 1), como a do kernel.
+//
+// Uso:
+//   ref_compare [--config nome] [--out resultado.csv]
+//               [--baseline baseline.csv] [--tolerance dB]
+//
+// Com --baseline sai com código 1 se o SNR de alguma configuração cair, ou
+// o THD+N do kernel subir, mais que --tolerance (padrão 0.5 dB) em relação
+// ao baseline versionado. Assim cada otimização mostra quanto de precisão
+// custa; se a perda for aceita, o baseline é regravado no mesmo commit.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dma.h"
+#include "effect_chain.h"
+#include "ref_models.h"
+#include "pitch_shift.h"
+
+#define CMP_SECONDS      2
+#define CMP_BLOCKS       ((CMP_SECONDS * AUDIO_SAMPLE_RATE) / AUDIO_BLOCK_FRAMES)
+#define CMP_WORDS        (CMP_BLOCKS * AUDIO_BLOCK_SIZE)
+#define CMP_LEVEL        0.25           // -12 dBFS: sem saturação nos kernels
+#define CMP_SINE_HZ      997.0
+#define CMP_MAX_RESULTS  64
+#define CMP_NAME_LEN     32
+
+static Int16  s_in[CMP_WORDS];
+static Int16  s_fx[CMP_WORDS];
+static double s_refIn[CMP_WORDS];
+static double s_ref[CMP_WORDS];
+
+typedef struct {
+    double sigPower;
+    double errPower;
+    double maxErr;
+} ErrorAcc;
+
+typedef enum { SIG_NOISE, SIG_SWEEP, SIG_SINE, SIG_COUNT } CmpSignal;
+
+typedef struct {
+    char   config[CMP_NAME_LEN];
+    double snr;
+    double maxErrLsb;
+    double thdnFx;
+    double thdnRef;
+} CmpResult;
+
+// ---------------------------------------------------------------------------
+// Sinais
+// ---------------------------------------------------------------------------
+
+static void makeSignal(CmpSignal sig)
+{
+    const double frames = (double)CMP_WORDS / AUDIO_NUM_CHANNELS;
+    Uint32 seed = 0xC0FFEEu;
+    Uint32 i;
+
+    for (i = 0; i < CMP_WORDS; i++) {
+        double t = (double)(i / AUDIO_NUM_CHANNELS) / AUDIO_SAMPLE_RATE;
+        double v;
+
+        switch (sig) {
+            case SIG_NOISE:
+                seed = seed * 1664525u + 1013904223u;
+                v = CMP_LEVEL * ((double)(seed >> 8) / 8388608.0 - 1.0);
+                break;
+            case SIG_SWEEP: {
+                const double f0 = 20.0, f1 = 20000.0;
+                const double T = frames / AUDIO_SAMPLE_RATE;
+                const double k = log(f1 / f0);
+                v = CMP_LEVEL * sin(2.0 * M_PI * f0 * T / k * (exp(t * k / T) - 1.0));
+                break;
+            }
+            default:
+                v = CMP_LEVEL * sin(2.0 * M_PI * CMP_SINE_HZ * t);
+                break;
+        }
+        s_in[i] = (Int16)floor(v * 32768.0 + 0.5);
+        s_refIn[i] = (double)s_in[i] / 32768.0;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Execução
+// ---------------------------------------------------------------------------
+
+static int run(const HostChainConfig* cfg)
+{
+    Uint32 b, i;
+
+    hostChainApply(cfg);
+    if (refChainInit(cfg) != 0) return -1;
+
+    for (b = 0; b < CMP_BLOCKS; b++) {
+        hostChainProcess(&s_in[b * AUDIO_BLOCK_SIZE], &s_fx[b * AUDIO_BLOCK_SIZE]);
+    }
+    refChainProcess(s_refIn, s_ref, CMP_WORDS);
+
+    for (i = 0; i < CMP_WORDS; i++) {
+        if (s_ref[i] > 32767.0 / 32768.0) s_ref[i] = 32767.0 / 32768.0;
+        if (s_ref[i] < -1.0)              s_ref[i] = -1.0;
+    }
+    return 0;
+}
+
+static void accumulate(ErrorAcc* acc)
+{
+    Uint32 i;
+
+    for (i = 0; i < CMP_WORDS; i++) {
+        double e = (double)s_fx[i] / 32768.0 - s_ref[i];
+        acc->sigPower += s_ref[i] * s_ref[i];
+        acc->errPower += e * e;
+        if (fabs(e) > acc->maxErr) acc->maxErr = fabs(e);
+    }
+}
+
+// THD+N do canal esquerdo na segunda metade do sinal (após o transiente):
+// ajusta DC + seno + cosseno em 'hz' por mínimos quadrados e mede o resíduo
+// em relação à fundamental.
+static double thdn(const Int16* fx, const double* ref, double hz)
+{
+    const Uint32 first = CMP_WORDS / 2;
+    double s[3][3] = { { 0 } }, r[3] = { 0 }, coef[3];
+    double fund = 0.0, resid = 0.0;
+    Uint32 i;
+    int a, b, c;
+
+    for (i = first; i < CMP_WORDS; i += AUDIO_NUM_CHANNELS) {
+        double t = (double)(i / AUDIO_NUM_CHANNELS) / AUDIO_SAMPLE_RATE;
+        double basis[3] = { 1.0, sin(2.0 * M_PI * hz * t),
+                                 cos(2.0 * M_PI * hz * t) };
+        double y = fx ? (double)fx[i] / 32768.0 : ref[i];
+
+        for (a = 0; a < 3; a++) {
+            r[a] += basis[a] * y;
+            for (b = 0; b < 3; b++) s[a][b] += basis[a] * basis[b];
+        }
+    }
+
+    // Eliminação de Gauss 3x3 (matriz bem condicionada)
+    for (a = 0; a < 3; a++) {
+        for (b = a + 1; b < 3; b++) {
+            double f = s[b][a] / s[a][a];
+            for (c = a; c < 3; c++) s[b][c] -= f * s[a][c];
+            r[b] -= f * r[a];
+        }
+    }
+    for (a = 2; a >= 0; a--) {
+        double v = r[a];
+        for (c = a + 1; c < 3; c++) v -= s[a][c] * coef[c];
+        coef[a] = v / s[a][a];
+    }
+
+    for (i = first; i < CMP_WORDS; i += AUDIO_NUM_CHANNELS) {
+        double t = (double)(i / AUDIO_NUM_CHANNELS) / AUDIO_SAMPLE_RATE;
+        double f = coef[1] * sin(2.0 * M_PI * hz * t)
+                 + coef[2] * cos(2.0 * M_PI * hz * t);
+        double y = fx ? (double)fx[i] / 32768.0 : ref[i];
+        double e = y - coef[0] - f;
+
+        fund  += f * f;
+        resid += e * e;
+    }
+    if (fund <= 0.0) return 0.0;
+    return 10.0 * log10((resid > 0.0 ? resid : 1e-30) / fund);
+}
+
+
+// Lê um CSV gerado por --out (retorna o número de linhas, -1 em erro)
+static int loadBaseline(const char* path, CmpResult* rows, int maxRows)
+{
+    FILE* f = fopen(path, "r");
+    char line[256];
+    int n = 0;
+
+    if (!f) return -1;
+    while (n < maxRows && fgets(line, sizeof(line), f)) {
+        CmpResult* r = &rows[n];
+        if (sscanf(line, "%31[^,],%lf,%lf,%lf,%lf", r->config, &r->snr,
+                   &r->maxErrLsb, &r->thdnFx, &r->thdnRef) == 5) {
+            n++;
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+static int writeResults(const char* path, const CmpResult* rows, int n)
+{
+    FILE* f = fopen(path, "w");
+    int i;
+
+    if (!f) return -1;
+    fprintf(f, "config,snr_db,max_err_lsb,thdn_fx_db,thdn_ref_db\n");
+    for (i = 0; i < n; i++) {
+        fprintf(f, "%s,%.2f,%.1f,%.2f,%.2f\n", rows[i].config, rows[i].snr,
+                rows[i].maxErrLsb, rows[i].thdnFx, rows[i].thdnRef);
+    }
+    return fclose(f);
+}
+
+static void measure(const HostChainConfig* cfg, CmpResult* r)
+{
+    double outHz = CMP_SINE_HZ;
+    ErrorAcc acc;
+    int sig;
+
+    if (cfg->pitchEnabled) outHz *= (double)cfg->pitchFreq / ROOT_FREQ_HZ;
+
+    memset(&acc, 0, sizeof(acc));
+    memset(r, 0, sizeof(*r));
+    strncpy(r->config, cfg->name, CMP_NAME_LEN - 1);
+
+    for (sig = SIG_NOISE; sig < SIG_COUNT; sig++) {
+        ErrorAcc part;
+
+        makeSignal((CmpSignal)sig);
+        if (run(cfg) != 0) {
+            fprintf(stderr, "ref_compare: sem memória\n");
+            exit(2);
+        }
+
+        memset(&part, 0, sizeof(part));
+        accumulate(&part);
+        if (part.maxErr > acc.maxErr) acc.maxErr = part.maxErr;
+        if (sig == SIG_SINE) {
+            r->thdnFx  = thdn(s_fx, NULL, outHz);
+            r->thdnRef = thdn(NULL, s_ref, outHz);
+        } else {
+            acc.sigPower += part.sigPower;
+            acc.errPower += part.errPower;
+        }
+    }
+
+    r->snr = acc.errPower > 0.0 ? 10.0 * log10(acc.sigPower / acc.errPower) : 999.0;
+    r->maxErrLsb = acc.maxErr * 32768.0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "uso: ref_compare [--config nome] [--out resultado.csv]\n"
+        "                 [--baseline baseline.csv] [--tolerance dB]\n");
+}
+
+int main(int argc, char** argv)
+{
+    static CmpResult results[CMP_MAX_RESULTS];
+    static CmpResult baseline[CMP_MAX_RESULTS];
+    const char* only = NULL;
+    const char* outPath = NULL;
+    const char* basePath = NULL;
+    double tolerance = 0.5;
+    int nResults = 0, nBaseline = 0;
+    int failed = 0;
+    Uint16 c;
+    int i, j;
+
+    for (i = 1; i < argc; i++) {
+        const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (!v) { usage(); return 2; }
+        if      (strcmp(argv[i], "--config") == 0)    only = v;
+        else if (strcmp(argv[i], "--out") == 0)       outPath = v;
+        else if (strcmp(argv[i], "--baseline") == 0)  basePath = v;
+        else if (strcmp(argv[i], "--tolerance") == 0) tolerance = atof(v);
+        else { usage(); return 2; }
+        i++;
+    }
+    if (only && !hostChainFind(only)) {
+        fprintf(stderr, "ref_compare: configuração desconhecida: %s\n", only);
+        return 2;
+    }
+    if (basePath) {
+        nBaseline = loadBaseline(basePath, baseline, CMP_MAX_RESULTS);
+        if (nBaseline < 0) {
+            fprintf(stderr, "ref_compare: não foi possível ler %s\n", basePath);
+            return 2;
+        }
+    }
+
+    printf("%-20s %9s %12s %11s %12s\n",
+           "config", "snr(dB)", "max_err(LSB)", "thdn_fx(dB)", "thdn_ref(dB)");
+
+    for (c = 0; c < g_hostChainConfigCount && nResults < CMP_MAX_RESULTS; c++) {
+        const HostChainConfig* cfg = &g_hostChainConfigs[c];
+        CmpResult* r = &results[nResults];
+
+        if (only && strcmp(only, cfg->name) != 0) continue;
+
+        measure(cfg, r);
+        nResults++;
+
+        printf("%-20s %9.2f %12.1f %11.2f %12.2f", r->config, r->snr,
+               r->maxErrLsb, r->thdnFx, r->thdnRef);
+
+        for (j = 0; j < nBaseline; j++) {
+            const CmpResult* b = &baseline[j];
+
+            if (strcmp(b->config, r->config) != 0) continue;
+            if (r->snr < b->snr - tolerance || r->thdnFx > b->thdnFx + tolerance) {
+                printf("  <- PIOROU (baseline: snr %.2f, thdn %.2f)", b->snr, b->thdnFx);
+                failed = 1;
+            }
+            break;
+        }
+        printf("\n");
+    }
+    refChainFree();
+
+    if (outPath && writeResults(outPath, results, nResults) != 0) {
+        fprintf(stderr, "ref_compare: não foi possível gravar %s\n", outPath);
+        return 2;
+    }
+    return failed;
+}
@@ -0,0 +1,536 @@
+//////////////////////////////////////////////////////////////////////////////
+// transition_test.c - Trocas de efeito com o DMA de áudio rodando
+//
+// Reproduz o main loop da placa com audioDmaRunning = 1: um tom constante
+// passa bloco a bloco por processAudioBlock() (a ISR) e, entre um bloco e
+// o seguinte, effectControllerPoll() dá um passo (o main loop). A cadeia
+// percorre as configurações de effect_chain.c em sequência, cada uma pedida
+// com hostChainRequest() como um toque no SW1.
+//
+// Em cada troca confere:
+//   - a cadeia chega ao pedido em no máximo TRANSITION_MAX_BLOCKS blocos;
+//   - quando a configuração ativa muda, há rampa se e somente se as duas
+//     cabem juntas no orçamento da ISR (EFFECT_COST_*, mesmo cálculo de
+//     xfadeFits); senão a troca é imediata;
+//   - durante a rampa (e na emenda com o bloco seguinte) nenhuma amostra
+//     salta mais que o maior salto do tom em regime, medido em cada
+//     configuração com o DMA parado, mais o passo da rampa. O efeito que
+//     entra começa com as linhas zeradas e o primeiro eco é um degrau de
+//     até TONE_AMPLITUDE: ele é tolerado com o ganho que a rampa já deu.
+//
+// E em cada poll (InitBegin/InitStep e effectClearChunk são interceptados
+// com --wrap do ld, ver CMakeLists.txt):
+//   - nenhum poll zera mais que EFFECT_INIT_CHUNK_WORDS palavras;
+//   - enquanto um init (ou a montagem de um preset) não terminou,
+//     effectControllerBusy() fica em 1 e a ISR não recebe publicação nova;
+//   - a ISR só toca efeitos já inicializados.
+//
+// Troca de preset do reverb com a cauda do anterior (HALL -> ROOM 2 ->
+// STAGE, reverbStageSwap também interceptado):
+//   - no bloco da troca e no seguinte, com o tom tocando, nenhum salto
+//     acima do limite (o dry muda de ganho em rampa);
+//   - com a entrada em silêncio desde o pedido, a cauda do HALL continua
+//     soando nos blocos logo após a troca;
+//   - a cauda sai exatamente uma volta da linha mais longa (all-pass
+//     incluído) depois do último bloco com pico >= REVERB_TAIL_FLOOR;
+//   - só então os bancos dela voltam: ROOM 2 -> STAGE é montado ao lado
+//     de novo, sem reinício.
+//
+// Publicação pela metade (effectParamsBegin sem effectParamsCommit): um
+// latch com seq ímpar, direto ou pelo bloco da ISR, mantém a cópia ativa
+// antiga; após o commit o valor novo entra, e uma mudança de reverbStage
+// causa exatamente um reverbStageSwap (só contado aqui: não há preset
+// montado).
+//
+// Uso:
+//   transition_test        (ctest)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "dma.h"
+#include "effects_controller.h"
+#include "effect_chain.h"
+
+#define TONE_AMPLITUDE   8192        // -12 dBFS
+#define TONE_HZ_LEFT     100.0
+#define TONE_HZ_RIGHT    75.0
+
+#define REF_WARMUP_BLOCKS   8        // Início dos efeitos (linhas vazias)
+#define REF_BLOCKS          24
+#define SETTLE_BLOCKS       8        // Em regime antes de cada pedido
+#define TAIL_AUDIBLE_BLOCKS 4        // Cauda conferida logo após a troca
+#define TAIL_MAX_BLOCKS     4000     // ~21 s: a cauda do HALL sai bem antes
+
+// Limpeza das duas fatias da arena em partes de EFFECT_INIT_CHUNK_WORDS,
+// mais fades, transições e a cauda do reverb
+#define TRANSITION_MAX_BLOCKS \
+    ((EFFECT_ARENA_FAST_WORDS + EFFECT_ARENA_EXT_WORDS) / EFFECT_INIT_CHUNK_WORDS + 32)
+
+// Maior variação por quadro que a rampa acrescenta: |to - from| / 512
+#define RAMP_STEP   (65536L >> (15 - EFFECT_XFADE_SHIFT))
+
+typedef struct {
+    EffectParams active;        // Parâmetros do bloco
+    Uint8        ramp;          // Transição em curso no bloco
+    long         maxStep;       // Maior |x[n] - x[n-1]| do bloco (L e R)
+    long         rampStep;      // Idem, menos o degrau de eco tolerado
+    long         firstStep;     // |x[0] - último do bloco anterior|
+    Int16        peak;          // Maior |x| (como a cauda mede: ~x se < 0)
+    Uint8        swapped;       // reverbStageSwap neste bloco
+} BlockInfo;
+
+static Int16  s_in[AUDIO_BLOCK_SIZE];
+static Int16  s_out[AUDIO_BLOCK_SIZE];
+static Uint32 s_frame;
+static Int16  s_last[AUDIO_NUM_CHANNELS];
+static long   s_limit;
+static Uint32 s_failures;
+
+// Inits em curso (um bit por InitBegin/InitStep) e palavras zeradas no poll
+#define INIT_FLANGER   0x01u
+#define INIT_REVERB    0x02u
+#define INIT_CONV      0x04u
+#define INIT_PITCH     0x08u
+#define INIT_STAGE     0x10u
+
+static Uint8  s_initOpen;
+static Uint32 s_pollWords;
+static Uint32 s_initPolls;      // Polls com um init em curso ao final
+static Uint32 s_swaps;          // Chamadas de reverbStageSwap
+static Uint32 s_stageBegins;    // Chamadas de reverbStageBegin
+static Uint32 s_reverbInits;    // Chamadas de reverbInitBegin
+static Uint8  s_silence;        // Entrada em silêncio em vez do tom
+static Uint8  s_swapCountOnly;  // reverbStageSwap só contado
+
+static void fail(const char* config, const char* what, long value)
+{
+    fprintf(stderr, "  %s: %s (%ld)\n", config, what, value);
+    s_failures++;
+}
+
+// ---------------------------------------------------------------------------
+// Interceptação (-Wl,--wrap=...)
+// ---------------------------------------------------------------------------
+
+Uint16 __real_effectClearChunk(Int16* buf, Uint16 len, Uint16* pos, Uint16 words);
+void   __real_flangerInitBegin(void);
+Uint8  __real_flangerInitStep(Uint16 words);
+void   __real_reverbInitBegin(void);
+Uint8  __real_reverbInitStep(Uint16 words);
+void   __real_convReverbInitBegin(void);
+Uint8  __real_convReverbInitStep(Uint16 words);
+void   __real_pitchShiftInitBegin(Uint8 mode);
+Uint8  __real_pitchShiftInitStep(Uint16 words);
+void   __real_reverbStageBegin(void);
+Uint8  __real_reverbStageStep(Uint16 words);
+void   __real_reverbStageSwap(void);
+
+Uint16 __wrap_effectClearChunk(Int16* buf, Uint16 len, Uint16* pos, Uint16 words)
+{
+    Uint16 cleared = __real_effectClearChunk(buf, len, pos, words);
+
+    s_pollWords += cleared;
+    return cleared;
+}
+
+static Uint8 initDone(Uint8 bit, Uint8 ready)
+{
+    if (ready) s_initOpen &= (Uint8)~bit;
+    return ready;
+}
+
+void  __wrap_flangerInitBegin(void)     { s_initOpen |= INIT_FLANGER; __real_flangerInitBegin(); }
+void  __wrap_reverbInitBegin(void)      { s_initOpen |= INIT_REVERB;  s_reverbInits++; __real_reverbInitBegin(); }
+void  __wrap_convReverbInitBegin(void)  { s_initOpen |= INIT_CONV;    __real_convReverbInitBegin(); }
+void  __wrap_pitchShiftInitBegin(Uint8 mode) { s_initOpen |= INIT_PITCH; __real_pitchShiftInitBegin(mode); }
+void  __wrap_reverbStageBegin(void)     { s_initOpen |= INIT_STAGE;   s_stageBegins++; __real_reverbStageBegin(); }
+
+Uint8 __wrap_flangerInitStep(Uint16 w)    { return initDone(INIT_FLANGER, __real_flangerInitStep(w)); }
+Uint8 __wrap_reverbInitStep(Uint16 w)     { return initDone(INIT_REVERB,  __real_reverbInitStep(w)); }
+Uint8 __wrap_convReverbInitStep(Uint16 w) { return initDone(INIT_CONV,    __real_convReverbInitStep(w)); }
+Uint8 __wrap_pitchShiftInitStep(Uint16 w) { return initDone(INIT_PITCH,   __real_pitchShiftInitStep(w)); }
+Uint8 __wrap_reverbStageStep(Uint16 w)    { return initDone(INIT_STAGE,   __real_reverbStageStep(w)); }
+
+void __wrap_reverbStageSwap(void)
+{
+    s_swaps++;
+    if (!s_swapCountOnly) __real_reverbStageSwap();
+}
+
+// ---------------------------------------------------------------------------
+
+static void genTone(void)
+{
+    Uint16 i;
+
+    for (i = 0; i < AUDIO_BLOCK_FRAMES; i++, s_frame++) {
+        double t = (double)s_frame / AUDIO_SAMPLE_RATE;
+
+        s_in[2 * i]     = s_silence ? 0 :
+                          (Int16)(TONE_AMPLITUDE * sin(2.0 * M_PI * TONE_HZ_LEFT * t));
+        s_in[2 * i + 1] = s_silence ? 0 :
+                          (Int16)(TONE_AMPLITUDE * sin(2.0 * M_PI * TONE_HZ_RIGHT * t));
+    }
+}
+
+// Um bloco da ISR. O latch aqui é o mesmo que processAudioBlock faz logo
+// em seguida (no mesmo bloco ele não muda mais nada)
+static void runBlock(BlockInfo* b)
+{
+    Uint16 pos = 0;
+    Uint32 swaps = s_swaps;
+    Uint16 i, ch;
+
+    genTone();
+    b->active  = *effectParamsLatch();
+    b->ramp    = effectXfadeFrom(&pos) != 0;
+    b->swapped = s_swaps != swaps;
+    b->maxStep = b->rampStep = b->firstStep = 0;
+    b->peak    = 0;
+
+    hostChainProcess(s_in, s_out);
+
+    for (i = 0; i < AUDIO_BLOCK_FRAMES; i++) {
+        // Ganho da rampa neste quadro (Q15), como em crossfadeBlock
+        long g = b->ramp ? (long)(pos + i) << EFFECT_XFADE_SHIFT : 0;
+
+        for (ch = 0; ch < AUDIO_NUM_CHANNELS; ch++) {
+            Int16 x = s_out[2 * i + ch];
+            Int16 mag = x < 0 ? ~x : x;
+            long d = labs((long)x - s_last[ch]);
+            long r = d - ((g * TONE_AMPLITUDE) >> 15);
+
+            if (mag > b->peak) b->peak = mag;
+
+            if (d > b->maxStep)  b->maxStep = d;
+            if (r > b->rampStep) b->rampStep = r;
+            if (i == 0 && d > b->firstStep) b->firstStep = d;
+            s_last[ch] = s_out[2 * i + ch];
+        }
+    }
+}
+
+// Mesmo cálculo de xfadeFits (effects_controller.c) sobre as macros de custo
+static Uint32 effectCost(Uint8 effect)
+{
+    switch (effect) {
+        case EFFECT_FLANGER:     return EFFECT_COST_FLANGER;
+        case EFFECT_TREMOLO:     return EFFECT_COST_TREMOLO;
+        case EFFECT_REVERB:      return EFFECT_COST_REVERB;
+        case EFFECT_CONV_REVERB: return EFFECT_COST_CONV_REVERB;
+        default:                 return EFFECT_COST_LOOPBACK;
+    }
+}
+
+static int expectRamp(const EffectParams* from, const EffectParams* to)
+{
+    Uint32 budget = (EFFECT_CPU_HZ / AUDIO_SAMPLE_RATE) * AUDIO_BLOCK_FRAMES *
+                    EFFECT_XFADE_BUDGET_PCT / 100UL;
+    Uint32 perWord = EFFECT_COST_XFADE + effectCost(from->effect);
+
+    if (to->effect != from->effect) perWord += effectCost(to->effect);
+    if (from->pitchEnabled || to->pitchEnabled) {
+        perWord += g_pitch.mode == PITCH_MODE_VOCODER    ? EFFECT_COST_PITCH_VOCODER :
+                   g_pitch.mode == PITCH_MODE_GRAIN_SYNC ? EFFECT_COST_PITCH_SYNC
+                                                         : EFFECT_COST_PITCH;
+    }
+    return EFFECT_COST_ISR_BLOCK + perWord * AUDIO_BLOCK_SIZE <= budget;
+}
+
+static int chainChanged(const EffectParams* a, const EffectParams* b)
+{
+    return a->effect != b->effect || a->pitchEnabled != b->pitchEnabled;
+}
+
+// Um passo do main loop, com as regras do init em partes
+static void poll(const char* config, const EffectParams* active)
+{
+    if (!g_effectController.effectInitialized[active->effect] ||
+        (active->pitchEnabled && (s_initOpen & INIT_PITCH))) {
+        fail(config, "ISR usando um efeito sem init", active->effect);
+    }
+
+    s_pollWords = 0;
+    effectControllerPoll();
+
+    if (s_pollWords > EFFECT_INIT_CHUNK_WORDS) {
+        fail(config, "poll zerou mais que EFFECT_INIT_CHUNK_WORDS", (long)s_pollWords);
+    }
+    if (s_initOpen) {
+        s_initPolls++;
+        if (!effectControllerBusy()) fail(config, "livre com init em curso", s_initOpen);
+    }
+}
+
+// Maior salto do tom em regime, em todas as configurações (DMA parado)
+static long referenceStep(void)
+{
+    BlockInfo b;
+    long ref = 0;
+    Uint16 c, k;
+
+    audioDmaRunning = 0;
+    for (c = 0; c < g_hostChainConfigCount; c++) {
+        hostChainApply(&g_hostChainConfigs[c]);
+        for (k = 0; k < REF_BLOCKS; k++) {
+            runBlock(&b);
+            if (k >= REF_WARMUP_BLOCKS && b.maxStep > ref) ref = b.maxStep;
+        }
+    }
+    return ref;
+}
+
+// Pede 'cfg' e leva a cadeia até ele, um poll por bloco
+static void transition(const HostChainConfig* cfg, Uint32* ramps, Uint32* cuts)
+{
+    BlockInfo b;
+    EffectParams prev = *effectParamsLatch();
+    Uint8 prevRamp = 0;
+    Uint8 prevOpen = 0;
+    Uint8 prevSwap = 0;
+    Uint16 blocks = 0;
+
+    hostChainRequest(cfg);
+
+    while (effectControllerBusy()) {
+        if (blocks++ >= TRANSITION_MAX_BLOCKS) {
+            fail(cfg->name, "não chegou ao pedido em TRANSITION_MAX_BLOCKS blocos", blocks);
+            return;
+        }
+        runBlock(&b);
+
+        // Init em curso desde o poll anterior: nada pode ter sido publicado
+        if (prevOpen && (chainChanged(&prev, &b.active) ||
+                         prev.reverbStage != b.active.reverbStage)) {
+            fail(cfg->name, "publicado com init em curso", s_initOpen);
+        }
+
+        if (chainChanged(&prev, &b.active)) {
+            if (b.ramp) (*ramps)++;
+            else        (*cuts)++;
+            if (b.ramp != expectRamp(&prev, &b.active)) {
+                fail(cfg->name, b.ramp ? "rampa sem orçamento" : "troca imediata com orçamento",
+                     b.active.effect);
+            }
+        }
+        if (b.ramp && b.rampStep > s_limit) {
+            fail(cfg->name, "salto durante a rampa", b.rampStep);
+        }
+        if (prevRamp && !b.ramp && b.firstStep > s_limit) {
+            fail(cfg->name, "salto no fim da rampa", b.firstStep);
+        }
+        if ((b.swapped || prevSwap) && b.maxStep > s_limit) {
+            fail(cfg->name, "salto na troca de preset", b.maxStep);
+        }
+
+        prev = b.active;
+        prevRamp = b.ramp;
+        prevSwap = b.swapped;
+        poll(cfg->name, &b.active);
+        prevOpen = s_initOpen != 0;
+    }
+
+    if (prev.effect != cfg->effect || prev.pitchEnabled != cfg->pitchEnabled) {
+        fail(cfg->name, "cadeia ativa diferente do pedido", prev.effect);
+    }
+    if (cfg->effect == EFFECT_REVERB && g_reverb.preset != cfg->preset) {
+        fail(cfg->name, "preset ativo diferente do pedido", g_reverb.preset);
+    }
+}
+
+// Atraso da linha com realimentação mais longa mais o do all-pass mais
+// longo do preset atual (Schroeder), como longestPath em reverb.c
+static Uint16 schroederHold(void)
+{
+    Uint16 line = 0, ap = 0;
+    Uint16 i;
+
+    for (i = 0; i < REVERB_NUM_COMBS; i++) {
+        if (g_reverb.left.comb[i].delay_samples > line)  line = g_reverb.left.comb[i].delay_samples;
+        if (g_reverb.right.comb[i].delay_samples > line) line = g_reverb.right.comb[i].delay_samples;
+    }
+    for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
+        if (g_reverb.left.allpass[i].delay_samples > ap)  ap = g_reverb.left.allpass[i].delay_samples;
+        if (g_reverb.right.allpass[i].delay_samples > ap) ap = g_reverb.right.allpass[i].delay_samples;
+    }
+    return line + ap;
+}
+
+static void tailCase(void)
+{
+    const HostChainConfig* room2 = hostChainFind("reverb_room2");
+    const HostChainConfig* stage = hostChainFind("reverb_stage");
+    BlockInfo b;
+    Uint32 swaps, stageBegins, inits;
+    Uint32 k, swapAt = 0, lastLoud = 0, holdBlocks;
+    int swapped = 0;
+
+    audioDmaRunning = 0;
+    hostChainApply(hostChainFind("reverb_hall"));
+    audioDmaRunning = 1;
+
+    // HALL cheio, depois silêncio na entrada junto com o pedido de ROOM 2
+    for (k = 0; k < 4 * SETTLE_BLOCKS; k++) {
+        runBlock(&b);
+        poll("tail", &b.active);
+    }
+    holdBlocks = (schroederHold() + AUDIO_BLOCK_FRAMES - 1) / AUDIO_BLOCK_FRAMES;
+    swaps = s_swaps;
+    s_silence = 1;
+    hostChainRequest(room2);
+
+    for (k = 0; k < TAIL_MAX_BLOCKS && (!swapped || reverbTailBusy()); k++) {
+        runBlock(&b);
+        poll("tail", &b.active);
+
+        if (b.swapped) {
+            swapped = 1;
+            swapAt = lastLoud = k;
+            if (!reverbTailBusy()) fail("tail", "troca sem cauda", 0);
+        }
+        if (!swapped) continue;
+
+        // O ROOM 2 recebe só silêncio: tudo que sai é a cauda do HALL
+        if (k - swapAt < TAIL_AUDIBLE_BLOCKS && b.peak < REVERB_TAIL_FLOOR) {
+            fail("tail", "cauda muda logo após a troca", (long)(k - swapAt));
+        }
+        if (b.peak >= REVERB_TAIL_FLOOR) lastLoud = k;
+        if (reverbTailBusy() && reverbStageFits()) {
+            fail("tail", "bancos da cauda livres com ela tocando", (long)k);
+        }
+    }
+
+    if (!swapped || s_swaps - swaps != 1) {
+        fail("tail", "HALL -> ROOM 2 sem exatamente uma troca", (long)(s_swaps - swaps));
+        return;
+    }
+    if (reverbTailBusy()) {
+        fail("tail", "cauda ainda tocando após TAIL_MAX_BLOCKS", (long)k);
+        return;
+    }
+    // Saiu no bloco em que completou holdBlocks blocos abaixo do piso
+    if (k - 1 != lastLoud + holdBlocks) {
+        fail("tail", "cauda saiu fora da volta da linha mais longa",
+             (long)(k - 1) - (long)(lastLoud + holdBlocks));
+    }
+
+    // Bancos da cauda de volta: STAGE é montado ao lado do ROOM 2
+    stageBegins = s_stageBegins;
+    inits = s_reverbInits;
+    swaps = s_swaps;
+    s_silence = 0;
+    hostChainRequest(stage);
+    for (k = 0; k < TRANSITION_MAX_BLOCKS && effectControllerBusy(); k++) {
+        runBlock(&b);
+        poll("tail", &b.active);
+    }
+    runBlock(&b);
+    if (s_stageBegins - stageBegins != 1 || s_reverbInits != inits ||
+        s_swaps - swaps != 1 || g_reverb.preset != stage->preset) {
+        fail("tail", "ROOM 2 -> STAGE não foi montado ao lado", g_reverb.preset);
+    }
+    audioDmaRunning = 0;
+}
+
+static int sameParams(const EffectParams* a, const EffectParams* b)
+{
+    return a->effect == b->effect && a->pitchEnabled == b->pitchEnabled &&
+           a->reverbStage == b->reverbStage && a->pitchDelayRate == b->pitchDelayRate;
+}
+
+// Latches (direto e pelo bloco da ISR) com a escrita aberta: nada muda
+static void halfPublished(const char* what, const EffectParams* old)
+{
+    BlockInfo b;
+
+    if (!sameParams(effectParamsLatch(), old)) fail(what, "latch com seq ímpar mudou a ativa", 0);
+    runBlock(&b);
+    if (!sameParams(&b.active, old) || !sameParams(effectParamsLatch(), old)) {
+        fail(what, "bloco com seq ímpar mudou a ativa", 0);
+    }
+}
+
+static void seqlockCase(void)
+{
+    BlockInfo b;
+    EffectParams old;
+    volatile EffectParams* p;
+    Int32 rate;
+    Uint32 swaps;
+
+    audioDmaRunning = 0;
+    hostChainApply(hostChainFind("reverb_hall"));
+    audioDmaRunning = 1;
+    runBlock(&b);
+
+    // Taxa do pitch: só um campo, sem swap
+    old = *effectParamsLatch();
+    rate = old.pitchDelayRate + 12345;
+    swaps = s_swaps;
+    p = effectParamsBegin();
+    p->pitchDelayRate = rate;
+    halfPublished("seqlock/pitchDelayRate", &old);
+    effectParamsCommit();
+    if (effectParamsLatch()->pitchDelayRate != rate || g_pitch.delay_rate != rate) {
+        fail("seqlock/pitchDelayRate", "valor publicado não entrou", 0);
+    }
+    if (s_swaps != swaps) fail("seqlock/pitchDelayRate", "reverbStageSwap sem troca de preset", 0);
+
+    // reverbStage: exatamente um swap, só depois do commit
+    s_swapCountOnly = 1;
+    old = *effectParamsLatch();
+    swaps = s_swaps;
+    p = effectParamsBegin();
+    p->reverbStage++;
+    halfPublished("seqlock/reverbStage", &old);
+    if (s_swaps != swaps) fail("seqlock/reverbStage", "swap antes do commit", (long)(s_swaps - swaps));
+    effectParamsCommit();
+    effectParamsLatch();
+    runBlock(&b);
+    runBlock(&b);
+    if (b.active.reverbStage != (Uint8)(old.reverbStage + 1) || s_swaps - swaps != 1) {
+        fail("seqlock/reverbStage", "não houve exatamente um swap", (long)(s_swaps - swaps));
+    }
+    s_swapCountOnly = 0;
+    audioDmaRunning = 0;
+}
+
+int main(void)
+{
+    BlockInfo b;
+    Uint32 ramps = 0, cuts = 0;
+    Uint16 c, k;
+
+    s_limit = referenceStep() + RAMP_STEP;
+
+    hostChainApply(&g_hostChainConfigs[0]);
+    audioDmaRunning = 1;
+
+    // Todas as configurações em sequência e de volta à primeira
+    for (c = 1; c <= g_hostChainConfigCount; c++) {
+        const HostChainConfig* cfg = &g_hostChainConfigs[c % g_hostChainConfigCount];
+
+        for (k = 0; k < SETTLE_BLOCKS; k++) {
+            runBlock(&b);
+            poll(cfg->name, &b.active);
+        }
+        transition(cfg, &ramps, &cuts);
+    }
+    audioDmaRunning = 0;
+
+    tailCase();
+    seqlockCase();
+
+    // As duas saídas do orçamento precisam ter sido exercitadas
+    if (ramps == 0) fail("sequência", "nenhuma troca em rampa", 0);
+    if (cuts == 0)  fail("sequência", "nenhuma troca imediata", 0);
+    if (s_initPolls == 0) fail("sequência", "nenhum init em partes", 0);
+
+    printf("transition_test: %u trocas (%lu em rampa, %lu imediatas), limite de salto %ld, "
+           "%lu polls com init em curso, %lu falhas\n", g_hostChainConfigCount,
+           (unsigned long)ramps, (unsigned long)cuts, s_limit,
+           (unsigned long)s_initPolls, (unsigned long)s_failures);
+    return s_failures ? 1 : 0;
+}
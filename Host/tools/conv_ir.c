@@ -0,0 +1,311 @@
+//////////////////////////////////////////////////////////////////////////////
+// conv_ir.c - Gera conv_ir.h (espectros da IR do reverb por convolução)
+//
+// Lê uma resposta ao impulso medida (WAV de 48 kHz; estéreo vira mono pela
+// média dos canais) ou, sem --ir, monta a IR sintética de referência: som
+// direto, reflexões iniciais e cauda de ruído com decaimento exponencial.
+//
+//   - o silêncio antes do som direto é cortado (latência) e a IR é
+//     normalizada para pico 1.0;
+//   - a IR é cortada em até --partitions partições de CONV_PART_FRAMES
+//     quadros, com fade-out de cosseno na última;
+//   - cada partição, completada com zeros até CONV_FFT_POINTS, passa por
+//     uma DFT em double; os bins 0..N/2 de todas são quantizados para Q15
+//     com um expoente comum (CONV_IR_EXP) no formato de conv_reverb.h.
+//
+// Uso:
+//   conv_ir [--ir resposta.wav] [--partitions P] [--out conv_ir.h]
+//           [--check conv_ir.h]
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "conv_reverb.h"
+#include "wav_io.h"
+
+#define FS                48000.0
+#define HEADER_TEXT_MAX   (CONV_MAX_PARTITIONS * CONV_IR_PART_WORDS * 9 + 4096)
+#define MAX_FRAMES        (CONV_MAX_PARTITIONS * CONV_PART_FRAMES)
+#define DEFAULT_PARTITIONS 32
+#define ONSET_LEVEL       0.01          // Início da IR: -40 dB do pico
+#define WORDS_PER_LINE    12
+
+// IR sintética: sala pequena (T60 de 0.3 s, cauda a partir de 8 ms)
+#define SYN_DIRECT        1.0
+#define SYN_TAIL_START_MS 8.0
+#define SYN_TAIL_GAIN     0.05
+#define SYN_T60_S         0.3
+
+static const double s_synReflections[][2] = {     // { ms, ganho }
+    {  3.1,  0.42 }, {  5.3, -0.35 }, {  7.9,  0.30 }, { 11.2, -0.26 },
+    { 13.7,  0.22 }, { 17.3,  0.19 }, { 21.9, -0.16 }, { 26.4,  0.13 },
+};
+
+static double s_ir[MAX_FRAMES];
+static Int16  s_spectra[CONV_MAX_PARTITIONS * CONV_IR_PART_WORDS];
+
+static Uint32 syntheticIr(Uint32 frames)
+{
+    const Uint32 start = (Uint32)(SYN_TAIL_START_MS * FS / 1000.0);
+    Uint32 seed = 0x1234567u;
+    Uint32 n, i;
+
+    memset(s_ir, 0, sizeof(s_ir));
+    s_ir[0] = SYN_DIRECT;
+    for (i = 0; i < sizeof(s_synReflections) / sizeof(s_synReflections[0]); i++) {
+        s_ir[(Uint32)(s_synReflections[i][0] * FS / 1000.0)] += s_synReflections[i][1];
+    }
+    for (n = start; n < frames; n++) {
+        double t = (double)(n - start) / FS;
+
+        seed = seed * 1664525u + 1013904223u;
+        s_ir[n] += SYN_TAIL_GAIN * ((double)(seed >> 8) / 8388608.0 - 1.0) *
+                   exp(-6.907755 * t / SYN_T60_S);
+    }
+    return frames;
+}
+
+// Retorna os quadros lidos (a partir do som direto), 0 em erro
+static Uint32 measuredIr(const char* path)
+{
+    WavAudio wav;
+    char err[128];
+    Uint32 n, first = 0, frames;
+    double peak = 0.0;
+
+    if (wavRead(path, &wav, err, sizeof(err)) != 0) {
+        fprintf(stderr, "conv_ir: %s: %s\n", path, err);
+        return 0;
+    }
+    if (wav.sampleRate != (Uint32)FS) {
+        fprintf(stderr, "conv_ir: %s: a IR deve ser de 48 kHz (tem %lu Hz)\n",
+                path, (unsigned long)wav.sampleRate);
+        wavFree(&wav);
+        return 0;
+    }
+
+    for (n = 0; n < wav.frames; n++) {
+        double v = fabs(((double)wav.stereo[2 * n] + wav.stereo[2 * n + 1]) / 2.0);
+        if (v > peak) peak = v;
+    }
+    while (first < wav.frames &&
+           fabs(((double)wav.stereo[2 * first] + wav.stereo[2 * first + 1]) / 2.0) <
+           ONSET_LEVEL * peak) {
+        first++;
+    }
+
+    frames = wav.frames - first;
+    if (frames > MAX_FRAMES) frames = MAX_FRAMES;
+    memset(s_ir, 0, sizeof(s_ir));
+    for (n = 0; n < frames; n++) {
+        s_ir[n] = ((double)wav.stereo[2 * (first + n)] + wav.stereo[2 * (first + n) + 1]) / 2.0;
+    }
+    wavFree(&wav);
+    return frames;
+}
+
+// Corta em 'parts' partições, com fade-out na última, e normaliza o pico
+static void shapeIr(Uint16 parts)
+{
+    const Uint32 frames = (Uint32)parts * CONV_PART_FRAMES;
+    const Uint32 fadeStart = frames - CONV_PART_FRAMES;
+    double peak = 0.0;
+    Uint32 n;
+
+    for (n = fadeStart; n < frames; n++) {
+        s_ir[n] *= 0.5 + 0.5 * cos(M_PI * (double)(n - fadeStart) / CONV_PART_FRAMES);
+    }
+    for (n = frames; n < MAX_FRAMES; n++) s_ir[n] = 0.0;
+
+    for (n = 0; n < frames; n++) {
+        if (fabs(s_ir[n]) > peak) peak = fabs(s_ir[n]);
+    }
+    if (peak > 0.0) {
+        for (n = 0; n < frames; n++) s_ir[n] /= peak;
+    }
+}
+
+// Bins 0..N/2 de cada partição; retorna o expoente comum
+static int buildSpectra(Uint16 parts)
+{
+    static double re[CONV_MAX_PARTITIONS][CONV_FFT_POINTS / 2 + 1];
+    static double im[CONV_MAX_PARTITIONS][CONV_FFT_POINTS / 2 + 1];
+    double maxAbs = 0.0, scale;
+    int exponent;
+    Uint16 p, k, n;
+
+    for (p = 0; p < parts; p++) {
+        const double* h = &s_ir[(Uint32)p * CONV_PART_FRAMES];
+
+        for (k = 0; k <= CONV_FFT_POINTS / 2; k++) {
+            double sr = 0.0, si = 0.0;
+
+            for (n = 0; n < CONV_PART_FRAMES; n++) {
+                double a = 2.0 * M_PI * (double)((Uint32)k * n % CONV_FFT_POINTS) / CONV_FFT_POINTS;
+                sr += h[n] * cos(a);
+                si -= h[n] * sin(a);
+            }
+            re[p][k] = sr;
+            im[p][k] = si;
+            if (fabs(sr) > maxAbs) maxAbs = fabs(sr);
+            if (fabs(si) > maxAbs) maxAbs = fabs(si);
+        }
+    }
+
+    // Menor expoente com o maior componente abaixo de 32767
+    exponent = (int)ceil(log2(maxAbs / 32767.0));
+    scale = ldexp(1.0, -exponent);
+
+    for (p = 0; p < parts; p++) {
+        Int16* out = &s_spectra[(Uint32)p * CONV_IR_PART_WORDS];
+
+        out[0] = (Int16)floor(re[p][0] * scale + 0.5);
+        out[1] = (Int16)floor(re[p][CONV_FFT_POINTS / 2] * scale + 0.5);
+        for (k = 1; k < CONV_FFT_POINTS / 2; k++) {
+            out[2 * k]     = (Int16)floor(re[p][k] * scale + 0.5);
+            out[2 * k + 1] = (Int16)floor(im[p][k] * scale + 0.5);
+        }
+    }
+    return exponent;
+}
+
+static void buildHeader(char* out, size_t cap, const char* source, Uint16 parts,
+                        int exponent)
+{
+    const Uint32 words = (Uint32)parts * CONV_IR_PART_WORDS;
+    Uint16 guard = 1;
+    size_t n = 0;
+    Uint32 i;
+
+    while ((1u << (guard - 1)) < parts) guard++;
+
+#define EMIT(...)  do { if (n < cap) n += (size_t)snprintf(out + n, cap - n, __VA_ARGS__); } while (0)
+
+    EMIT("/* conv_ir.h - GERADO por Host/tools/conv_ir: não editar.\n"
+         " * Fonte: %s; regravar com\n"
+         " *   cmake --build build --target conv_ir_update\n"
+         " * Espectros no formato de conv_reverb.h: valor * 2^CONV_IR_EXP. */\n"
+         "\n"
+         "#ifndef CONV_IR_H_\n"
+         "#define CONV_IR_H_\n"
+         "\n"
+         "#define CONV_IR_PARTITIONS  %u\n"
+         "#define CONV_IR_FRAMES      %lu      // %.1f ms\n"
+         "#define CONV_IR_EXP         (%d)\n"
+         "#define CONV_IR_GUARD       %u       // Bits de guarda da soma das partições\n"
+         "\n"
+         "#endif /* CONV_IR_H_ */\n"
+         "\n"
+         "// Tabela: só em conv_reverb.c (#define CONV_IR_TABLE antes do #include)\n"
+         "#if defined(CONV_IR_TABLE) && !defined(CONV_IR_TABLE_H_)\n"
+         "#define CONV_IR_TABLE_H_\n"
+         "\n"
+         "#pragma DATA_SECTION(s_convIr, \".efx:ir\")\n"
+         "static const Int16 s_convIr[CONV_IR_PARTITIONS * CONV_IR_PART_WORDS] = {\n",
+         source, parts, (unsigned long)parts * CONV_PART_FRAMES,
+         (double)parts * CONV_PART_FRAMES * 1000.0 / FS, exponent, guard);
+
+    for (i = 0; i < words; i++) {
+        if (i % WORDS_PER_LINE == 0) EMIT("   ");
+        EMIT(" %6d%s", s_spectra[i], i + 1 < words ? "," : "");
+        if (i % WORDS_PER_LINE == WORDS_PER_LINE - 1 || i + 1 == words) EMIT("\n");
+    }
+    EMIT("};\n\n#endif /* CONV_IR_TABLE */\n");
+
+#undef EMIT
+}
+
+static int writeText(const char* path, const char* text)
+{
+    FILE* f = fopen(path, "w");
+
+    if (!f) return -1;
+    fputs(text, f);
+    return fclose(f);
+}
+
+static int sameAsFile(const char* path, const char* text)
+{
+    static char buf[HEADER_TEXT_MAX];
+    size_t len;
+    FILE* f = fopen(path, "r");
+
+    if (!f) return 0;
+    len = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[len] = '\0';
+    return strcmp(buf, text) == 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "uso: conv_ir [--ir resposta.wav] [--partitions P] [--out conv_ir.h]\n"
+        "             [--check conv_ir.h]\n");
+}
+
+int main(int argc, char** argv)
+{
+    static char text[HEADER_TEXT_MAX];
+    const char* irPath = NULL;
+    const char* outPath = NULL;
+    const char* checkPath = NULL;
+    const char* source;
+    long maxParts = DEFAULT_PARTITIONS;
+    Uint32 frames;
+    Uint16 parts;
+    int exponent;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (!v) { usage(); return 2; }
+
+        if      (strcmp(a, "--ir") == 0)         irPath = v;
+        else if (strcmp(a, "--partitions") == 0) maxParts = atol(v);
+        else if (strcmp(a, "--out") == 0)        outPath = v;
+        else if (strcmp(a, "--check") == 0)      checkPath = v;
+        else { usage(); return 2; }
+        i++;
+    }
+    if (maxParts < 1 || maxParts > CONV_MAX_PARTITIONS) {
+        fprintf(stderr, "conv_ir: --partitions deve estar entre 1 e %d\n", CONV_MAX_PARTITIONS);
+        return 2;
+    }
+
+    if (irPath) {
+        const char* slash = strrchr(irPath, '/');
+
+        frames = measuredIr(irPath);
+        if (frames == 0) return 1;
+        source = slash ? slash + 1 : irPath;
+    } else {
+        frames = syntheticIr((Uint32)maxParts * CONV_PART_FRAMES);
+        source = "IR sintética (sala pequena, T60 de 0.3 s)";
+    }
+
+    parts = (Uint16)((frames + CONV_PART_FRAMES - 1) / CONV_PART_FRAMES);
+    if (parts > maxParts) parts = (Uint16)maxParts;
+
+    shapeIr(parts);
+    exponent = buildSpectra(parts);
+    buildHeader(text, sizeof(text), source, parts, exponent);
+
+    printf("IR: %s\n%u partições de %u quadros (%.1f ms), expoente %d\n",
+           source, parts, CONV_PART_FRAMES,
+           (double)parts * CONV_PART_FRAMES * 1000.0 / FS, exponent);
+
+    if (outPath && writeText(outPath, text) != 0) {
+        fprintf(stderr, "conv_ir: não foi possível gravar %s\n", outPath);
+        return 2;
+    }
+    if (checkPath && !sameAsFile(checkPath, text)) {
+        fprintf(stderr, "conv_ir: %s desatualizado; rode o alvo conv_ir_update\n", checkPath);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,431 @@
+//////////////////////////////////////////////////////////////////////////////
+// dma_sim.c - Simulador do ping-pong de DMA com detecção de perda de prazo
+//
+// Reproduz no PC o esquema RxBuffer/TxBuffer de dma.c em um relógio virtual
+// de 48 kHz estéreo (uma palavra a cada 1/96000 s):
+//
+//   - a "DMA de Rx" escreve uma palavra da entrada em RxBuffer[pos] e a
+//     "DMA de Tx" lê TxBuffer[pos] para a saída, com pos circular;
+//   - em pos == meio e pos == fim é gerada a interrupção de Rx; se ela já
+//     estiver pendente, a nova é perdida (um único bit de IFR), como no DSP;
+//   - a ISR real (dmaRxIsr, ligada por configAudioDma via IRQ_plug) roda
+//     quando a CPU está livre. Seu custo vem de um modelo de ciclos do C5502
+//     ou do tempo medido no PC multiplicado por um fator de escala;
+//   - a palavra k do bloco só fica pronta em início + custo * (k+1)/N. Se a
+//     DMA de Tx a lê antes disso, toca o conteúdo antigo: o bloco conta
+//     como glitch (clique audível).
+//
+// Uso:
+//   dma_sim [--config NOME|all] [--blocks N] [--cost model|host]
+//           [--cpu-mhz MHz] [--host-scale S] [--cycles arquivo.csv]
+//           [--jitter-us J] [--wav-in entrada.wav] [--wav-out saida.wav]
+//           [--fail-on-glitch]
+//
+// O arquivo de --cycles tem linhas "componente,ciclos" (ver s_cycleModel)
+// e substitui as estimativas padrão por valores medidos na placa.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "dma.h"
+#include "effects_controller.h"
+#include "reverb.h"
+#include "host_stubs.h"
+#include "effect_chain.h"
+#include "wav_io.h"
+
+// Buffers de dma.c (a declaração fica aqui para não mexer nos #pragma)
+extern Uint16 RxBuffer[AUDIO_BUFFER_SIZE];
+extern Uint16 TxBuffer[AUDIO_BUFFER_SIZE];
+
+#define WORD_RATE        ((double)AUDIO_SAMPLE_RATE * AUDIO_NUM_CHANNELS)
+#define WORD_PERIOD_S    (1.0 / WORD_RATE)
+#define BLOCK_PERIOD_S   ((double)AUDIO_BLOCK_SIZE * WORD_PERIOD_S)
+
+// ---------------------------------------------------------------------------
+// Modelo de ciclos do C5502
+// ---------------------------------------------------------------------------
+// Estimativas por palavra (amostra de um canal) com -O3, incluindo as
+// esperas de acesso à CE0 dos buffers .efx:* que mem_plan deixa fora da
+// DARAM. São um ponto de partida: meça com o profiler do CCS e passe os
+// valores com --cycles. Os padrões são a tabela EFFECT_COST_* de
+// effects_controller.h, que também decide se uma transição cabe na ISR.
+// Flanger, tremolo e pitch dividem o LFO/phasor entre L e R (custo médio).
+
+typedef struct {
+    char   name[24];
+    double cycles;
+} CycleEntry;
+
+static CycleEntry s_cycleModel[] = {
+    { "isr_block",    EFFECT_COST_ISR_BLOCK },  // Entrada/saída da ISR + despacho (por bloco)
+    { "loopback",     EFFECT_COST_LOOPBACK },   // Cópia Rx -> Tx
+    { "pitch",        EFFECT_COST_PITCH },      // Dois grãos interpolados + crossfade
+    { "pitch_pv",     EFFECT_COST_PITCH_VOCODER }, // FFT + IFFT de 1024 pontos por canal e bloco
+    { "pitch_sync",   EFFECT_COST_PITCH_SYNC }, // Grãos + AMDF do período por bloco
+    { "flanger",      EFFECT_COST_FLANGER },    // LFO + leitura interpolada na CE0
+    { "tremolo",      EFFECT_COST_TREMOLO },
+    { "reverb_hall",  172.0 },                  // 4 combs + 2 all-pass por bloco, linhas na CE0
+    { "reverb_room2", 172.0 },
+    { "reverb_stage", EFFECT_COST_REVERB },     // + damping nos combs
+    { "reverb_fdn_hall", EFFECT_COST_REVERB_FDN }, // 8 linhas + Householder para L e R
+    { "reverb_fdn_room", EFFECT_COST_REVERB_FDN },
+    { "reverb_plate", EFFECT_COST_REVERB_PLATE }, // Difusores + tanque em oito, taps na CE0
+    { "conv_reverb",  EFFECT_COST_CONV_REVERB }, // FFT + IFFT + bins de cada partição da IR
+};
+
+#define CYCLE_MODEL_COUNT (sizeof(s_cycleModel) / sizeof(s_cycleModel[0]))
+
+static double cycleOf(const char* name)
+{
+    Uint16 i;
+
+    for (i = 0; i < CYCLE_MODEL_COUNT; i++) {
+        if (strcmp(s_cycleModel[i].name, name) == 0) return s_cycleModel[i].cycles;
+    }
+    return 0.0;
+}
+
+static int loadCycleModel(const char* path)
+{
+    FILE* f = fopen(path, "r");
+    char line[128];
+
+    if (!f) return -1;
+    while (fgets(line, sizeof(line), f)) {
+        char name[24];
+        double cycles;
+        Uint16 i;
+
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%23[^,],%lf", name, &cycles) != 2) continue;
+        for (i = 0; i < CYCLE_MODEL_COUNT; i++) {
+            if (strcmp(s_cycleModel[i].name, name) == 0) {
+                s_cycleModel[i].cycles = cycles;
+                break;
+            }
+        }
+        if (i == CYCLE_MODEL_COUNT) {
+            fprintf(stderr, "dma_sim: componente desconhecido em %s: %s\n",
+                    path, name);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+// Ciclos de um bloco para a configuração
+static double modelBlockCycles(const HostChainConfig* cfg)
+{
+    static const char* reverbNames[REVERB_PRESET_COUNT] = {
+        "reverb_hall", "reverb_room2", "reverb_stage",
+        "reverb_fdn_hall", "reverb_fdn_room", "reverb_plate"
+    };
+    double perWord = 0.0;
+
+    if (cfg->pitchEnabled) {
+        perWord += cycleOf(cfg->pitchMode == PITCH_MODE_VOCODER    ? "pitch_pv"
+                         : cfg->pitchMode == PITCH_MODE_GRAIN_SYNC ? "pitch_sync"
+                                                                   : "pitch");
+    }
+
+    switch (cfg->effect) {
+        case EFFECT_FLANGER: perWord += cycleOf("flanger"); break;
+        case EFFECT_TREMOLO: perWord += cycleOf("tremolo"); break;
+        case EFFECT_REVERB:  perWord += cycleOf(reverbNames[cfg->preset]); break;
+        case EFFECT_CONV_REVERB: perWord += cycleOf("conv_reverb"); break;
+        default:
+            if (!cfg->pitchEnabled) perWord += cycleOf("loopback");
+            break;
+    }
+    return cycleOf("isr_block") + perWord * AUDIO_BLOCK_SIZE;
+}
+
+// ---------------------------------------------------------------------------
+// Simulação
+// ---------------------------------------------------------------------------
+
+typedef enum { COST_MODEL, COST_HOST } CostSource;
+
+typedef struct {
+    CostSource source;
+    double     cpuHz;
+    double     hostScale;
+    double     jitterS;
+    long       blocks;
+    const WavAudio* input;      // NULL = sinal sintético
+    Int16*     output;          // NULL = não guarda a saída
+} SimOptions;
+
+typedef struct {
+    long   isrCalls;
+    long   lostIrqs;            // Interrupção chegou com outra pendente
+    long   glitchBlocks;        // Blocos com palavras tocadas antes de prontas
+    long   staleWords;
+    long   rxOverruns;          // ISR começou depois da DMA voltar à metade
+    double maxCostS;
+    double sumCostS;
+} SimStats;
+
+static Uint32 s_seed;
+
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1.0e-9 * (double)ts.tv_nsec;
+}
+
+static double uniform01(void)
+{
+    s_seed = s_seed * 1664525u + 1013904223u;
+    return (double)(s_seed >> 8) / 16777216.0;
+}
+
+static Int16 inputWord(const SimOptions* o, long w)
+{
+    if (o->input && o->input->frames) {
+        long n = (long)o->input->frames * 2;
+        return o->input->stereo[w % n];
+    } else {
+        // 440 Hz em L, 660 Hz em R, com ruído leve
+        long frame = w / 2;
+        double f = (w & 1) ? 660.0 : 440.0;
+        double v = 0.5 * sin(2.0 * M_PI * f * frame / AUDIO_SAMPLE_RATE)
+                 + 0.05 * (uniform01() - 0.5);
+        return (Int16)(v * 32767.0);
+    }
+}
+
+static void simulate(const HostChainConfig* cfg, const SimOptions* o,
+                     SimStats* st)
+{
+    static Uint16 oldTx[AUDIO_BLOCK_SIZE];
+    const Uint16 rxEvent = hostDmaEventId(DMA_CHA1);
+    const long totalWords = o->blocks * AUDIO_BLOCK_SIZE;
+    const double modelCostS = modelBlockCycles(cfg) / o->cpuHz;
+
+    IRQ_IsrPtr isr;
+    int    pending = 0;
+    double pendingSince = 0.0;
+    double busyUntil = 0.0;
+
+    // ISR em andamento (ou a última executada)
+    int    inflight = 0;
+    Uint16 inflightHalf = 0;
+    double inflightStart = 0.0;
+    double inflightCost = 0.0;
+    long   inflightStale = 0;
+
+    long w;
+    Uint16 pos = 0;
+
+    memset(st, 0, sizeof(*st));
+    s_seed = 1;
+
+    hostChainApply(cfg);
+    configAudioDma();
+    startAudioDma();
+
+    isr = hostIrqIsr(rxEvent);
+    if (!isr || !hostIrqEnabled(rxEvent)) {
+        fprintf(stderr, "dma_sim: configAudioDma não ligou a ISR de Rx\n");
+        exit(2);
+    }
+
+    for (w = 0; w < totalWords; w++) {
+        double t = (double)w * WORD_PERIOD_S;
+
+        // 1) CPU livre e interrupção pendente: executa a ISR
+        if (pending && busyUntil <= t) {
+            double start = pendingSince > busyUntil ? pendingSince : busyUntil;
+            Uint16 half = dmaPingPongFlag;    // ISR processa PING se flag == 0
+            Uint16 base = half ? AUDIO_BLOCK_SIZE : 0;
+            double cost;
+
+            if (inflight && inflightStale > 0) st->glitchBlocks++;
+
+            memcpy(oldTx, &TxBuffer[base], sizeof(oldTx));
+
+            if (o->source == COST_HOST) {
+                double h0 = nowS();
+                isr();
+                cost = (nowS() - h0) * o->hostScale;
+            } else {
+                isr();
+                cost = modelCostS;
+            }
+            cost += o->jitterS * uniform01();
+
+            // A DMA de Rx já voltou a escrever nesta metade?
+            if (start > pendingSince + BLOCK_PERIOD_S) st->rxOverruns++;
+
+            inflight      = 1;
+            inflightHalf  = half;
+            inflightStart = start;
+            inflightCost  = cost;
+            inflightStale = 0;
+
+            busyUntil = start + cost;
+            pending = 0;
+            st->isrCalls++;
+            st->sumCostS += cost;
+            if (cost > st->maxCostS) st->maxCostS = cost;
+        }
+
+        // 2) DMA de Rx: escreve a palavra recebida
+        RxBuffer[pos] = (Uint16)inputWord(o, w);
+
+        // 3) DMA de Tx: lê a palavra a transmitir
+        {
+            Uint16 half = pos >= AUDIO_BLOCK_SIZE;
+            Uint16 k = (Uint16)(pos - (half ? AUDIO_BLOCK_SIZE : 0));
+            Uint16 value = TxBuffer[pos];
+
+            if (inflight && half == inflightHalf &&
+                t < inflightStart + inflightCost * (k + 1) / AUDIO_BLOCK_SIZE) {
+                value = oldTx[k];
+                inflightStale++;
+                st->staleWords++;
+            }
+            if (o->output) o->output[w] = (Int16)value;
+        }
+
+        // 4) Avança; meio e fim do buffer geram a interrupção de Rx
+        pos++;
+        if (pos == AUDIO_BLOCK_SIZE || pos == AUDIO_BUFFER_SIZE) {
+            if (pending) {
+                st->lostIrqs++;
+            } else {
+                pending = 1;
+                pendingSince = t + WORD_PERIOD_S;
+            }
+            if (pos == AUDIO_BUFFER_SIZE) pos = 0;
+        }
+    }
+    if (inflight && inflightStale > 0) st->glitchBlocks++;
+
+    stopAudioDma();
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "uso: dma_sim [--config NOME|all] [--blocks N] [--cost model|host]\n"
+        "             [--cpu-mhz MHz] [--host-scale S] [--cycles arquivo.csv]\n"
+        "             [--jitter-us J] [--wav-in entrada.wav] [--wav-out saida.wav]\n"
+        "             [--fail-on-glitch]\n");
+}
+
+int main(int argc, char** argv)
+{
+    SimOptions o;
+    const char* only = "all";
+    const char* wavIn = NULL;
+    const char* wavOut = NULL;
+    int failOnGlitch = 0;
+    long totalGlitches = 0;
+    WavAudio wav;
+    Uint16 c;
+    int i;
+
+    memset(&o, 0, sizeof(o));
+    o.source    = COST_MODEL;
+    o.cpuHz     = 200.0e6;    // PLL: 20 MHz x 10 (pll.c)
+    o.hostScale = 1.0;
+    o.blocks    = 2000;
+
+    for (i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(a, "--fail-on-glitch") == 0) { failOnGlitch = 1; continue; }
+        if (!v) { usage(); return 2; }
+
+        if      (strcmp(a, "--config") == 0)     only = v;
+        else if (strcmp(a, "--blocks") == 0)     o.blocks = atol(v);
+        else if (strcmp(a, "--cpu-mhz") == 0)    o.cpuHz = atof(v) * 1.0e6;
+        else if (strcmp(a, "--host-scale") == 0) o.hostScale = atof(v);
+        else if (strcmp(a, "--jitter-us") == 0)  o.jitterS = atof(v) * 1.0e-6;
+        else if (strcmp(a, "--wav-in") == 0)     wavIn = v;
+        else if (strcmp(a, "--wav-out") == 0)    wavOut = v;
+        else if (strcmp(a, "--cost") == 0) {
+            if      (strcmp(v, "model") == 0) o.source = COST_MODEL;
+            else if (strcmp(v, "host") == 0)  o.source = COST_HOST;
+            else { usage(); return 2; }
+        } else if (strcmp(a, "--cycles") == 0) {
+            if (loadCycleModel(v) != 0) {
+                fprintf(stderr, "dma_sim: não foi possível ler %s\n", v);
+                return 2;
+            }
+        } else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+    if (o.blocks < 2 || o.cpuHz <= 0.0) {
+        usage();
+        return 2;
+    }
+    if (wavOut && strcmp(only, "all") == 0) {
+        fprintf(stderr, "dma_sim: --wav-out exige uma única --config\n");
+        return 2;
+    }
+
+    if (wavIn) {
+        char err[128];
+        if (wavRead(wavIn, &wav, err, sizeof(err)) != 0) {
+            fprintf(stderr, "dma_sim: %s: %s\n", wavIn, err);
+            return 2;
+        }
+        o.input = &wav;
+    }
+    if (wavOut) {
+        o.output = (Int16*)malloc((size_t)o.blocks * AUDIO_BLOCK_SIZE * sizeof(Int16));
+        if (!o.output) return 2;
+    }
+
+    printf("Bloco: %d palavras, período %.3f ms; custo: %s",
+           AUDIO_BLOCK_SIZE, 1.0e3 * BLOCK_PERIOD_S,
+           o.source == COST_MODEL ? "modelo de ciclos" : "tempo do host");
+    if (o.source == COST_MODEL) printf(" @ %.0f MHz", o.cpuHz / 1.0e6);
+    else                        printf(" x %.2f", o.hostScale);
+    printf("\n\n%-20s %9s %9s %8s %8s %8s %9s %8s\n", "config", "medio(ms)",
+           "max(ms)", "carga(%)", "glitches", "perdidas", "atrasadas", "overrun");
+
+    for (c = 0; c < g_hostChainConfigCount; c++) {
+        const HostChainConfig* cfg = &g_hostChainConfigs[c];
+        SimStats st;
+
+        if (strcmp(only, "all") != 0 && strcmp(only, cfg->name) != 0) continue;
+
+        simulate(cfg, &o, &st);
+        totalGlitches += st.glitchBlocks;
+
+        printf("%-20s %9.3f %9.3f %8.1f %8ld %8ld %9ld %8ld\n", cfg->name,
+               1.0e3 * st.sumCostS / (st.isrCalls ? st.isrCalls : 1),
+               1.0e3 * st.maxCostS, 100.0 * st.maxCostS / BLOCK_PERIOD_S,
+               st.glitchBlocks, st.lostIrqs, st.staleWords, st.rxOverruns);
+    }
+
+    if (wavOut) {
+        if (wavWriteStereo16(wavOut, o.output,
+                             (Uint32)(o.blocks * AUDIO_BLOCK_FRAMES),
+                             AUDIO_SAMPLE_RATE) != 0) {
+            fprintf(stderr, "dma_sim: não foi possível gravar %s\n", wavOut);
+            return 2;
+        }
+        free(o.output);
+    }
+    if (wavIn) wavFree(&wav);
+
+    return (failOnGlitch && totalGlitches) ? 1 : 0;
+}
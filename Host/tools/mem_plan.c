@@ -0,0 +1,247 @@
+//////////////////////////////////////////////////////////////////////////////
+// mem_plan.c - Planejador de memória dos buffers de efeito (DARAM x CE0)
+//
+// Lê o catálogo de Final_Project_Pro_MAX/inc/mem_plan.h (tamanho e acessos
+// por quadro de cada buffer) e decide o tier de cada seção .efx:*:
+//
+//   1. buffers com MEM_TIER_DARAM entram primeiro (falha se não couberem);
+//   2. os demais, em ordem de acessos da CPU por palavra (o mais quente e
+//      menor primeiro), entram na DARAM enquanto houver espaço;
+//   3. o resto vai para a CE0.
+//
+// Mostra a ocupação da DARAM e o tráfego esperado na CE0 (acessos da CPU,
+// que param o pipeline, e palavras de DMA) em cada configuração da cadeia.
+//
+// Uso:
+//   mem_plan [--budget PALAVRAS] [--cmd effects_mem.cmd] [--check effects_mem.cmd]
+//
+// --cmd grava o arquivo de linker; --check compara com o arquivo existente
+// e falha se estiver desatualizado (usado pelo ctest).
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem_plan.h"
+#include "effects_controller.h"
+#include "effect_chain.h"
+
+#define CMD_TEXT_MAX    4096
+
+typedef struct {
+    const char* name;
+    const char* section;
+    Uint32      words;
+    Uint16      cpuPerFrame;    // Acessos da CPU por quadro estéreo
+    Uint16      dmaPerFrame;    // Palavras de DMA por quadro estéreo
+    Uint16      effects;        // MEM_EFX_*
+    Uint16      tier;           // MEM_TIER_*
+    int         inDaram;        // Resultado do plano
+} PlanBuffer;
+
+#define PLAN_ENTRY(n, sec, w, cpu, dma, efx, tier) \
+    { #n, sec, (Uint32)(w), cpu, dma, efx, tier, 0 },
+
+static PlanBuffer s_buffers[] = {
+    MEM_PLAN_BUFFERS(PLAN_ENTRY)
+};
+
+#define NUM_BUFFERS  (sizeof(s_buffers) / sizeof(s_buffers[0]))
+
+// Mais quente por palavra primeiro; empate: menor primeiro
+static int hotterFirst(const void* pa, const void* pb)
+{
+    const PlanBuffer* a = *(const PlanBuffer* const*)pa;
+    const PlanBuffer* b = *(const PlanBuffer* const*)pb;
+    double da = (double)a->cpuPerFrame / (double)a->words;
+    double db = (double)b->cpuPerFrame / (double)b->words;
+
+    if (da != db) return da > db ? -1 : 1;
+    if (a->words != b->words) return a->words < b->words ? -1 : 1;
+    return strcmp(a->name, b->name);
+}
+
+// Retorna as palavras usadas na DARAM, ou -1 se um buffer obrigatório
+// não couber
+static long plan(Uint32 budget)
+{
+    PlanBuffer* order[NUM_BUFFERS];
+    Uint32 used = 0;
+    Uint16 i;
+
+    for (i = 0; i < NUM_BUFFERS; i++) {
+        s_buffers[i].inDaram = 0;
+        if (s_buffers[i].tier == MEM_TIER_DARAM) {
+            if (used + s_buffers[i].words > budget) {
+                fprintf(stderr, "mem_plan: %s (%lu palavras) precisa da DARAM e não cabe\n",
+                        s_buffers[i].name, (unsigned long)s_buffers[i].words);
+                return -1;
+            }
+            s_buffers[i].inDaram = 1;
+            used += s_buffers[i].words;
+        }
+        order[i] = &s_buffers[i];
+    }
+
+    qsort(order, NUM_BUFFERS, sizeof(order[0]), hotterFirst);
+
+    for (i = 0; i < NUM_BUFFERS; i++) {
+        PlanBuffer* b = order[i];
+
+        if (b->inDaram || b->cpuPerFrame == 0) continue;
+        if (used + b->words <= budget) {
+            b->inDaram = 1;
+            used += b->words;
+        }
+    }
+    return (long)used;
+}
+
+static Uint16 configEffects(const HostChainConfig* cfg)
+{
+    Uint16 mask = 0;
+
+    if (cfg->effect == EFFECT_FLANGER) mask |= MEM_EFX_FLANGER;
+    if (cfg->effect == EFFECT_REVERB)  mask |= MEM_EFX_REVERB;
+    if (cfg->effect == EFFECT_CONV_REVERB) mask |= MEM_EFX_CONV;
+    if (cfg->pitchEnabled)             mask |= MEM_EFX_PITCH;
+    return mask;
+}
+
+static void printReport(Uint32 budget, long used)
+{
+    Uint16 i, c;
+
+    printf("%-12s %-20s %8s %6s %6s  %s\n",    // "seção": 7 bytes em UTF-8
+           "buffer", "seção", "palavras", "CPU/q", "DMA/q", "tier");
+    for (i = 0; i < NUM_BUFFERS; i++) {
+        const PlanBuffer* b = &s_buffers[i];
+
+        printf("%-12s %-18s %8lu %6u %6u  %s%s\n", b->name, b->section,
+               (unsigned long)b->words, b->cpuPerFrame, b->dmaPerFrame,
+               b->inDaram ? "DARAM" : "CE0",
+               b->tier == MEM_TIER_DARAM ? " (obrigatório)" : "");
+    }
+    printf("\nDARAM: %ld de %lu palavras (%ld livres)\n",
+           used, (unsigned long)budget, (long)budget - used);
+
+    printf("\nTráfego na CE0 (%d quadros/s, bloco de %d quadros):\n",
+           AUDIO_SAMPLE_RATE, AUDIO_BLOCK_FRAMES);
+    printf("%-20s %10s %10s %12s %12s\n",
+           "config", "CPU/quadro", "DMA/quadro", "CPU/bloco", "palavras/s");
+    for (c = 0; c < g_hostChainConfigCount; c++) {
+        const HostChainConfig* cfg = &g_hostChainConfigs[c];
+        Uint16 mask = configEffects(cfg);
+        Uint32 cpu = 0, dma = 0;
+
+        for (i = 0; i < NUM_BUFFERS; i++) {
+            const PlanBuffer* b = &s_buffers[i];
+
+            if (b->inDaram || !(b->effects & mask)) continue;
+            cpu += b->cpuPerFrame;
+            dma += b->dmaPerFrame;
+        }
+        printf("%-20s %10lu %10lu %12lu %12lu\n", cfg->name,
+               (unsigned long)cpu, (unsigned long)dma,
+               (unsigned long)cpu * AUDIO_BLOCK_FRAMES,
+               (unsigned long)(cpu + dma) * AUDIO_SAMPLE_RATE);
+    }
+}
+
+// Texto do arquivo de linker (determinístico: ordem do catálogo)
+static void buildCmd(char* out, size_t cap, Uint32 budget, long used)
+{
+    size_t n;
+    Uint16 i;
+
+    n = (size_t)snprintf(out, cap,
+        "/* effects_mem.cmd - GERADO por Host/tools/mem_plan: não editar.\n"
+        " * Catálogo em inc/mem_plan.h; regravar com\n"
+        " *   cmake --build build --target mem_plan_update\n"
+        " * DARAM: %ld de %lu palavras reservadas aos efeitos. */\n"
+        "\n"
+        "SECTIONS\n"
+        "{\n",
+        used, (unsigned long)budget);
+
+    for (i = 0; i < NUM_BUFFERS && n < cap; i++) {
+        const PlanBuffer* b = &s_buffers[i];
+
+        // Na CE0 a seção começa em fronteira de banco (0x10000 bytes =
+        // EFFECT_MEM_BANK_WORDS palavras): nenhum banco cruza página
+        n += (size_t)snprintf(out + n, cap - n, "   %-18s > %-5s%s  /* %6lu palavras */\n",
+                              b->section, b->inDaram ? "DARAM" : "CE0",
+                              b->inDaram ? "" : " align(0x10000)",
+                              (unsigned long)b->words);
+    }
+    if (n < cap) snprintf(out + n, cap - n, "}\n");
+}
+
+static int writeText(const char* path, const char* text)
+{
+    FILE* f = fopen(path, "w");
+
+    if (!f) return -1;
+    fputs(text, f);
+    return fclose(f);
+}
+
+static int sameAsFile(const char* path, const char* text)
+{
+    char buf[CMD_TEXT_MAX];
+    size_t len;
+    FILE* f = fopen(path, "r");
+
+    if (!f) return 0;
+    len = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[len] = '\0';
+    return strcmp(buf, text) == 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "uso: mem_plan [--budget PALAVRAS] [--cmd effects_mem.cmd]\n"
+        "              [--check effects_mem.cmd]\n");
+}
+
+int main(int argc, char** argv)
+{
+    Uint32 budget = MEM_PLAN_DARAM_WORDS;
+    const char* cmdPath = NULL;
+    const char* checkPath = NULL;
+    char text[CMD_TEXT_MAX];
+    long used;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (!v) { usage(); return 2; }
+
+        if      (strcmp(a, "--budget") == 0) budget = (Uint32)atol(v);
+        else if (strcmp(a, "--cmd") == 0)    cmdPath = v;
+        else if (strcmp(a, "--check") == 0) checkPath = v;
+        else { usage(); return 2; }
+        i++;
+    }
+
+    used = plan(budget);
+    if (used < 0) return 1;
+
+    printReport(budget, used);
+    buildCmd(text, sizeof(text), budget, used);
+
+    if (cmdPath && writeText(cmdPath, text) != 0) {
+        fprintf(stderr, "mem_plan: não foi possível gravar %s\n", cmdPath);
+        return 2;
+    }
+    if (checkPath && !sameAsFile(checkPath, text)) {
+        fprintf(stderr, "mem_plan: %s desatualizado; rode o alvo mem_plan_update\n",
+                checkPath);
+        return 1;
+    }
+    return 0;
+}
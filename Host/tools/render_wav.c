@@ -0,0 +1,416 @@
+//////////////////////////////////////////////////////////////////////////////
+// render_wav.c - Renderizador offline de WAV com a cadeia real da placa
+//
+// Passa arquivos WAV pelo mesmo caminho Q15 da ISR de DMA
+// (processAudioBlock em Final_Project_Pro_MAX/src/dma.c), bloco a bloco.
+// Aceita arquivos e diretórios; cada arquivo é renderizado em um processo
+// filho (os efeitos usam estado global), com até -j processos em paralelo.
+//
+// Uso:
+//   render_wav [opções] -o DIR_SAIDA ENTRADA...
+//
+//   --config NOME      configuração pronta (ver --list), ex.: stage_pitch_b
+//   --effect E         loopback | flanger | tremolo | reverb | conv
+//   --preset P         hall | room2 | stage | fdn_hall | fdn_room | plate (reverb)
+//   --note N           off | B | D | F | Gb | frequência em Hz (pitch shift)
+//   --pitch-mode M     grain | sync (grãos no período) | pv (vocoder de fase)
+//   --tail MS          silêncio extra no fim para a cauda do efeito
+//   --resample         converte a entrada para 48 kHz (interpolação linear)
+//   -j N               processos em paralelo (padrão: núcleos disponíveis)
+//   --list             lista as configurações prontas
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "dma.h"
+#include "effects_controller.h"
+#include "effect_chain.h"
+#include "wav_io.h"
+
+#define PATH_LEN 1024
+
+typedef struct {
+    char in[PATH_LEN];
+    char out[PATH_LEN];
+} RenderJob;
+
+static RenderJob* s_jobs = NULL;
+static int s_jobCount = 0;
+static int s_jobCap = 0;
+
+// ---------------------------------------------------------------------------
+// Reamostragem linear para AUDIO_SAMPLE_RATE (apenas com --resample)
+// ---------------------------------------------------------------------------
+
+static int resampleTo48k(WavAudio* wav)
+{
+    Uint32 frames, n;
+    Int16* dst;
+    double step;
+
+    if (wav->sampleRate == AUDIO_SAMPLE_RATE || wav->frames == 0) return 0;
+
+    frames = (Uint32)((unsigned long long)wav->frames * AUDIO_SAMPLE_RATE /
+                      wav->sampleRate);
+    dst = (Int16*)malloc((size_t)frames * 2 * sizeof(Int16) + 1);
+    if (!dst) return -1;
+
+    step = (double)wav->sampleRate / (double)AUDIO_SAMPLE_RATE;
+    for (n = 0; n < frames; n++) {
+        double pos = n * step;
+        Uint32 k = (Uint32)pos;
+        Uint32 k1 = k + 1 < wav->frames ? k + 1 : k;
+        double frac = pos - (double)k;
+        int c;
+
+        for (c = 0; c < 2; c++) {
+            double a = wav->stereo[2 * k + c];
+            double b = wav->stereo[2 * k1 + c];
+            dst[2 * n + c] = (Int16)(a + frac * (b - a));
+        }
+    }
+
+    free(wav->stereo);
+    wav->stereo = dst;
+    wav->frames = frames;
+    wav->sampleRate = AUDIO_SAMPLE_RATE;
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Renderização de um arquivo (roda no processo filho)
+// ---------------------------------------------------------------------------
+
+static int renderFile(const RenderJob* job, const HostChainConfig* cfg,
+                      Uint32 tailMs, int resample)
+{
+    WavAudio wav;
+    char err[128];
+    Int16 in[AUDIO_BLOCK_SIZE];
+    Int16* out;
+    Uint32 totalFrames, blocks, b, i;
+    int rc;
+
+    if (wavRead(job->in, &wav, err, sizeof(err)) != 0) {
+        fprintf(stderr, "render_wav: %s: %s\n", job->in, err);
+        return 1;
+    }
+    if (resample && resampleTo48k(&wav) != 0) {
+        wavFree(&wav);
+        fprintf(stderr, "render_wav: %s: memória insuficiente\n", job->in);
+        return 1;
+    }
+    if (wav.sampleRate != AUDIO_SAMPLE_RATE) {
+        fprintf(stderr, "render_wav: aviso: %s está a %lu Hz; os efeitos "
+                "são calibrados para %d Hz\n", job->in,
+                (unsigned long)wav.sampleRate, AUDIO_SAMPLE_RATE);
+    }
+
+    totalFrames = wav.frames + (Uint32)((unsigned long long)tailMs *
+                                        wav.sampleRate / 1000u);
+    blocks = (totalFrames + AUDIO_BLOCK_FRAMES - 1) / AUDIO_BLOCK_FRAMES;
+
+    out = (Int16*)malloc((size_t)blocks * AUDIO_BLOCK_SIZE * sizeof(Int16) + 1);
+    if (!out) {
+        wavFree(&wav);
+        fprintf(stderr, "render_wav: %s: memória insuficiente\n", job->in);
+        return 1;
+    }
+
+    hostChainApply(cfg);
+
+    for (b = 0; b < blocks; b++) {
+        for (i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+            Uint32 k = b * AUDIO_BLOCK_SIZE + i;
+            in[i] = k < wav.frames * 2u ? wav.stereo[k] : 0;
+        }
+        hostChainProcess(in, &out[(size_t)b * AUDIO_BLOCK_SIZE]);
+    }
+
+    rc = wavWriteStereo16(job->out, out, totalFrames, wav.sampleRate);
+    if (rc != 0) {
+        fprintf(stderr, "render_wav: não foi possível gravar %s\n", job->out);
+    }
+
+    free(out);
+    wavFree(&wav);
+    return rc != 0;
+}
+
+// ---------------------------------------------------------------------------
+// Lista de trabalhos
+// ---------------------------------------------------------------------------
+
+static int hasWavExtension(const char* name)
+{
+    size_t n = strlen(name);
+    return n > 4 && strcasecmp(name + n - 4, ".wav") == 0;
+}
+
+static int addJob(const char* in, const char* outDir)
+{
+    const char* base = strrchr(in, '/');
+    RenderJob* job;
+
+    if (s_jobCount == s_jobCap) {
+        int cap = s_jobCap ? 2 * s_jobCap : 64;
+        RenderJob* p = (RenderJob*)realloc(s_jobs, (size_t)cap * sizeof(RenderJob));
+        if (!p) return -1;
+        s_jobs = p;
+        s_jobCap = cap;
+    }
+
+    job = &s_jobs[s_jobCount];
+    base = base ? base + 1 : in;
+    if (snprintf(job->in, PATH_LEN, "%s", in) >= PATH_LEN ||
+        snprintf(job->out, PATH_LEN, "%s/%s", outDir, base) >= PATH_LEN) {
+        fprintf(stderr, "render_wav: caminho longo demais: %s\n", in);
+        return -1;
+    }
+    if (strcmp(job->in, job->out) == 0) {
+        fprintf(stderr, "render_wav: saída sobrescreveria a entrada: %s\n", in);
+        return -1;
+    }
+    s_jobCount++;
+    return 0;
+}
+
+static int cmpNames(const void* a, const void* b)
+{
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+// Adiciona os .wav de um diretório (não recursivo, ordem alfabética)
+static int addDirectory(const char* dir, const char* outDir)
+{
+    DIR* d = opendir(dir);
+    struct dirent* e;
+    char** names = NULL;
+    int n = 0, cap = 0, i, rc = 0;
+
+    if (!d) {
+        fprintf(stderr, "render_wav: não foi possível abrir %s\n", dir);
+        return -1;
+    }
+    while ((e = readdir(d)) != NULL) {
+        if (!hasWavExtension(e->d_name)) continue;
+        if (n == cap) {
+            char** p;
+            cap = cap ? 2 * cap : 64;
+            p = (char**)realloc(names, (size_t)cap * sizeof(char*));
+            if (!p) { rc = -1; break; }
+            names = p;
+        }
+        names[n] = (char*)malloc(PATH_LEN);
+        if (!names[n]) { rc = -1; break; }
+        snprintf(names[n], PATH_LEN, "%s/%s", dir, e->d_name);
+        n++;
+    }
+    closedir(d);
+
+    qsort(names, (size_t)n, sizeof(char*), cmpNames);
+    for (i = 0; i < n; i++) {
+        if (rc == 0 && addJob(names[i], outDir) != 0) rc = -1;
+        free(names[i]);
+    }
+    free(names);
+    return rc;
+}
+
+// ---------------------------------------------------------------------------
+// Execução paralela: um processo por arquivo, no máximo 'workers' por vez
+// ---------------------------------------------------------------------------
+
+static int runJobs(const HostChainConfig* cfg, Uint32 tailMs, int resample,
+                   int workers)
+{
+    int next = 0, running = 0, failures = 0;
+
+    fflush(stdout);
+    fflush(stderr);
+
+    while (next < s_jobCount || running > 0) {
+        int status;
+        pid_t pid;
+
+        while (running < workers && next < s_jobCount) {
+            pid = fork();
+            if (pid < 0) {
+                perror("render_wav: fork");
+                failures++;
+                next++;
+                continue;
+            }
+            if (pid == 0) {
+                _exit(renderFile(&s_jobs[next], cfg, tailMs, resample));
+            }
+            next++;
+            running++;
+        }
+
+        pid = wait(&status);
+        if (pid < 0) break;
+        running--;
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failures++;
+    }
+    return failures;
+}
+
+// ---------------------------------------------------------------------------
+// Opções
+// ---------------------------------------------------------------------------
+
+static int parseNote(const char* s, HostChainConfig* cfg)
+{
+    static const struct { const char* name; float hz; } notes[] = {
+        { "B", 493.88f }, { "D", 293.66f }, { "F", 349.23f }, { "Gb", 369.99f }
+    };
+    Uint16 i;
+    char* end;
+    double hz;
+
+    if (strcasecmp(s, "off") == 0) {
+        cfg->pitchEnabled = 0;
+        return 0;
+    }
+    for (i = 0; i < sizeof(notes) / sizeof(notes[0]); i++) {
+        if (strcasecmp(s, notes[i].name) == 0) {
+            cfg->pitchEnabled = 1;
+            cfg->pitchFreq = notes[i].hz;
+            return 0;
+        }
+    }
+    hz = strtod(s, &end);
+    if (*end != '\0' || hz <= 0.0) return -1;
+    cfg->pitchEnabled = 1;
+    cfg->pitchFreq = (float)hz;
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "uso: render_wav [--config NOME | --effect E [--preset P] [--note N]\n"
+        "                 [--pitch-mode M]]\n"
+        "                [--tail MS] [--resample] [-j N] -o DIR_SAIDA ENTRADA...\n"
+        "     render_wav --list\n");
+}
+
+int main(int argc, char** argv)
+{
+    HostChainConfig custom = { "custom", EFFECT_LOOPBACK, REVERB_PRESET_HALL, 0, 0.0f,
+                               PITCH_MODE_GRAIN };
+    const HostChainConfig* cfg = &custom;
+    const char* outDir = NULL;
+    Uint32 tailMs = 0;
+    int resample = 0;
+    long workers = sysconf(_SC_NPROCESSORS_ONLN);
+    int firstInput = argc;
+    int i, failures;
+    struct stat st;
+
+    for (i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(a, "--list") == 0) {
+            Uint16 c;
+            for (c = 0; c < g_hostChainConfigCount; c++) {
+                printf("%s\n", g_hostChainConfigs[c].name);
+            }
+            return 0;
+        } else if (strcmp(a, "--config") == 0 && v) {
+            cfg = hostChainFind(v);
+            if (!cfg) {
+                fprintf(stderr, "render_wav: configuração desconhecida: %s\n", v);
+                return 2;
+            }
+            i++;
+        } else if (strcmp(a, "--effect") == 0 && v) {
+            if      (strcmp(v, "loopback") == 0) custom.effect = EFFECT_LOOPBACK;
+            else if (strcmp(v, "flanger") == 0)  custom.effect = EFFECT_FLANGER;
+            else if (strcmp(v, "tremolo") == 0)  custom.effect = EFFECT_TREMOLO;
+            else if (strcmp(v, "reverb") == 0)   custom.effect = EFFECT_REVERB;
+            else if (strcmp(v, "conv") == 0)     custom.effect = EFFECT_CONV_REVERB;
+            else { usage(); return 2; }
+            i++;
+        } else if (strcmp(a, "--preset") == 0 && v) {
+            if      (strcmp(v, "hall") == 0)  custom.preset = REVERB_PRESET_HALL;
+            else if (strcmp(v, "room2") == 0) custom.preset = REVERB_PRESET_ROOM_2;
+            else if (strcmp(v, "stage") == 0) custom.preset = REVERB_PRESET_STAGE;
+            else if (strcmp(v, "fdn_hall") == 0) custom.preset = REVERB_PRESET_FDN_HALL;
+            else if (strcmp(v, "fdn_room") == 0) custom.preset = REVERB_PRESET_FDN_ROOM;
+            else if (strcmp(v, "plate") == 0) custom.preset = REVERB_PRESET_PLATE;
+            else { usage(); return 2; }
+            i++;
+        } else if (strcmp(a, "--note") == 0 && v) {
+            if (parseNote(v, &custom) != 0) { usage(); return 2; }
+            i++;
+        } else if (strcmp(a, "--pitch-mode") == 0 && v) {
+            if      (strcmp(v, "grain") == 0) custom.pitchMode = PITCH_MODE_GRAIN;
+            else if (strcmp(v, "pv") == 0)    custom.pitchMode = PITCH_MODE_VOCODER;
+            else if (strcmp(v, "sync") == 0)  custom.pitchMode = PITCH_MODE_GRAIN_SYNC;
+            else { usage(); return 2; }
+            i++;
+        } else if (strcmp(a, "--tail") == 0 && v) {
+            tailMs = (Uint32)strtoul(v, NULL, 10);
+            i++;
+        } else if (strcmp(a, "--resample") == 0) {
+            resample = 1;
+        } else if (strcmp(a, "-j") == 0 && v) {
+            workers = atol(v);
+            i++;
+        } else if (strcmp(a, "-o") == 0 && v) {
+            outDir = v;
+            i++;
+        } else if (a[0] == '-') {
+            usage();
+            return 2;
+        } else {
+            firstInput = i;
+            break;
+        }
+    }
+
+    if (!outDir || firstInput >= argc) {
+        usage();
+        return 2;
+    }
+    if (workers < 1) workers = 1;
+
+    if (stat(outDir, &st) != 0 && mkdir(outDir, 0777) != 0) {
+        fprintf(stderr, "render_wav: não foi possível criar %s\n", outDir);
+        return 2;
+    }
+
+    for (i = firstInput; i < argc; i++) {
+        int rc;
+
+        if (stat(argv[i], &st) != 0) {
+            fprintf(stderr, "render_wav: %s não existe\n", argv[i]);
+            return 2;
+        }
+        rc = S_ISDIR(st.st_mode) ? addDirectory(argv[i], outDir)
+                                 : addJob(argv[i], outDir);
+        if (rc != 0) return 2;
+    }
+
+    printf("render_wav: %d arquivo(s), config '%s', %ld processo(s)\n",
+           s_jobCount, cfg->name, workers);
+
+    failures = runJobs(cfg, tailMs, resample, (int)workers);
+    free(s_jobs);
+
+    if (failures) {
+        fprintf(stderr, "render_wav: %d arquivo(s) com erro\n", failures);
+        return 1;
+    }
+    return 0;
+}
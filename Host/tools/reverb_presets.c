@@ -0,0 +1,459 @@
+//////////////////////////////////////////////////////////////////////////////
+// reverb_presets.c - Gera reverb_presets.h a partir de reverb_preset_cfg.h
+//
+// Converte cada preset de ms/ganho em float para o que initReverb usa:
+//
+//   - atraso em amostras (mesmo arredondamento do antigo msToSamples) e
+//     ganhos Q15 (float_to_q15), com o spread do canal direito; nos
+//     presets da FDN o ganho de cada linha vem do t60;
+//   - posição fixa de cada linha: combs longos (com janelas de DMA) nos
+//     bancos da CE0, por first-fit decrescente, sem cruzar banco; combs
+//     curtos e all-pass no pool da DARAM, em ordem (CE0 se lotar). As
+//     linhas da FDN seguem a mesma regra dos combs; no plate os
+//     difusores de entrada vão para o pool e o tanque para a CE0.
+//
+// O header gerado tem um #error por preset: se um preset não couber em
+// REVERB_MEM_SIZE ou REVERB_FAST_MEM_SIZE, o firmware não compila.
+// Também mostra quais trocas de preset cabem com a cauda do anterior
+// (os dois presets juntos nos REVERB_MEM_BANKS bancos); as outras passam
+// pelo reinício do reverb.
+//
+// Uso:
+//   reverb_presets [--out reverb_presets.h] [--check reverb_presets.h]
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "reverb_preset_cfg.h"
+#include "fixed_point.h"
+
+#define FS_FLOAT         48000.0f
+#define HEADER_TEXT_MAX  32768
+#define MAX_EXT_LINES    (2 * (REVERB_NUM_COMBS + REVERB_NUM_ALLPASSES) + REVERB_FDN_LINES + \
+                          REVERB_PLATE_DIFFUSERS + 2 * REVERB_PLATE_TANK_LINES)
+
+static const char* const s_presetNames[REVERB_PRESET_COUNT] = {
+    "HALL", "ROOM_2", "STAGE", "FDN_HALL", "FDN_ROOM", "PLATE"
+};
+
+typedef struct {
+    ReverbPresetLayout layout;
+    Uint16 extBanks;            // Bancos da CE0 usados
+    int    fits;
+} PresetPlan;
+
+// Mesma conversão que initReverb fazia em tempo de execução
+static Uint16 msToSamples(float ms)
+{
+    return (Uint16)(ms * (FS_FLOAT / 1000.0f));
+}
+
+static int longerFirst(const void* pa, const void* pb)
+{
+    const ReverbLineLayout* a = *(const ReverbLineLayout* const*)pa;
+    const ReverbLineLayout* b = *(const ReverbLineLayout* const*)pb;
+
+    if (a->delay_samples != b->delay_samples) {
+        return a->delay_samples > b->delay_samples ? -1 : 1;
+    }
+    return a < b ? -1 : (a > b ? 1 : 0);    // Estável: ordem da tabela
+}
+
+static void placeFast(ReverbLineLayout* line, Uint16* fastUsed,
+                      ReverbLineLayout** ext, Uint16* numExt)
+{
+    if ((Uint32)*fastUsed + line->delay_samples <= REVERB_FAST_MEM_SIZE) {
+        line->ext = 0;
+        line->offset = *fastUsed;
+        *fastUsed += line->delay_samples;
+    } else {
+        ext[(*numExt)++] = line;
+    }
+}
+
+// Linha longa (com janelas de DMA) na CE0; o resto no pool da DARAM
+static void placeLine(ReverbLineLayout* line, Uint16* fastUsed,
+                      ReverbLineLayout** ext, Uint16* numExt)
+{
+    if (line->delay_samples >= 2u * REVERB_WINDOW_LEN) ext[(*numExt)++] = line;
+    else placeFast(line, fastUsed, ext, numExt);
+}
+
+// First-fit decrescente nos bancos da CE0
+static void placeExt(PresetPlan* plan, ReverbLineLayout** ext, Uint16 numExt,
+                     Uint16 fastUsed)
+{
+    ReverbPresetLayout* L = &plan->layout;
+    Uint32 bankUsed[MAX_EXT_LINES];
+    Uint16 i, b;
+
+    L->fastWords = fastUsed;
+
+    qsort(ext, numExt, sizeof(ext[0]), longerFirst);
+    memset(bankUsed, 0, sizeof(bankUsed));
+    for (i = 0; i < numExt; i++) {
+        ReverbLineLayout* line = ext[i];
+
+        for (b = 0; b < plan->extBanks; b++) {
+            if (bankUsed[b] + line->delay_samples <= REVERB_MEM_BANK_WORDS) break;
+        }
+        if (b == plan->extBanks) plan->extBanks++;
+
+        line->ext    = 1;
+        line->bank   = (Uint8)b;
+        line->offset = (Uint16)bankUsed[b];
+        bankUsed[b] += line->delay_samples;
+        L->extWords += line->delay_samples;
+    }
+
+    L->extBanks = (Uint8)plan->extBanks;
+    if (plan->extBanks > REVERB_MEM_BANKS || fastUsed > REVERB_FAST_MEM_SIZE) {
+        plan->fits = 0;
+    }
+}
+
+static void planPreset(const ReverbPresetCfg* p, PresetPlan* plan)
+{
+    ReverbPresetLayout* L = &plan->layout;
+    ReverbLineLayout* ext[MAX_EXT_LINES];
+    Uint16 numExt = 0, fastUsed = 0;
+    Uint16 ch, i;
+
+    memset(plan, 0, sizeof(*plan));
+    plan->fits = 1;
+
+    L->engine          = REVERB_ENGINE_SCHROEDER;
+    L->wet_gain_Q15    = float_to_q15(p->wet_gain);
+    L->dry_gain_Q15    = float_to_q15(p->dry_gain);
+    L->comb_damp_shift = p->comb_damp_shift;
+
+    for (ch = 0; ch < 2; ch++) {
+        for (i = 0; i < REVERB_NUM_COMBS; i++) {
+            ReverbLineLayout* c = &L->comb[ch][i];
+            Uint16 samples = msToSamples(p->comb_ms[i]);
+
+            if (ch == 1) samples += REVERB_SPREAD;
+            if (samples < 2) samples = 2;
+
+            c->delay_samples = samples;
+            c->gain_Q15      = float_to_q15(p->comb_gains[i]);
+            placeLine(c, &fastUsed, ext, &numExt);
+        }
+        for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
+            ReverbLineLayout* ap = &L->allpass[ch][i];
+            Uint16 samples = msToSamples(p->ap_ms[i]);
+
+            if (samples < 2) samples = 2;
+
+            ap->delay_samples = samples;
+            ap->gain_Q15      = float_to_q15(p->ap_gains[i]);
+            placeFast(ap, &fastUsed, ext, &numExt);
+        }
+    }
+    placeExt(plan, ext, numExt, fastUsed);
+}
+
+static void planFdnPreset(const ReverbFdnCfg* p, PresetPlan* plan)
+{
+    ReverbPresetLayout* L = &plan->layout;
+    ReverbLineLayout* ext[MAX_EXT_LINES];
+    Uint16 numExt = 0, fastUsed = 0;
+    Uint16 i;
+
+    memset(plan, 0, sizeof(*plan));
+    plan->fits = 1;
+
+    L->engine       = REVERB_ENGINE_FDN;
+    L->wet_gain_Q15 = float_to_q15(p->wet_gain);
+    L->dry_gain_Q15 = float_to_q15(p->dry_gain);
+
+    for (i = 0; i < REVERB_FDN_LINES; i++) {
+        ReverbLineLayout* line = &L->fdn[i];
+        Uint16 samples = msToSamples(p->line_ms[i]);
+
+        if (samples < 2) samples = 2;
+
+        // Mesma queda em dB por segundo em todas as linhas
+        line->delay_samples = samples;
+        line->gain_Q15 = float_to_q15(powf(10.0f, -3.0f * (float)samples /
+                                           (p->t60_ms * (FS_FLOAT / 1000.0f))));
+        L->fdn_damp_shift[i] = p->damp_shift[i];
+        placeLine(line, &fastUsed, ext, &numExt);
+    }
+
+    placeExt(plan, ext, numExt, fastUsed);
+}
+
+static void planPlatePreset(const ReverbPlateCfg* p, PresetPlan* plan, const char* name)
+{
+    ReverbPresetLayout* L = &plan->layout;
+    ReverbLineLayout* ext[MAX_EXT_LINES];
+    Uint16 numExt = 0, fastUsed = 0;
+    Uint16 depth = msToSamples(p->mod_depth_ms);
+    Uint16 h, i;
+
+    memset(plan, 0, sizeof(*plan));
+    plan->fits = 1;
+
+    L->engine           = REVERB_ENGINE_PLATE;
+    L->wet_gain_Q15     = float_to_q15(p->wet_gain);
+    L->dry_gain_Q15     = float_to_q15(p->dry_gain);
+    L->plate_damp_shift = p->damp_shift;
+    L->plate_mod_depth  = (Uint8)depth;
+    L->plate_mod_inc    = (Uint32)((double)p->mod_hz / FS_FLOAT * 4294967296.0);
+
+    for (i = 0; i < REVERB_PLATE_DIFFUSERS; i++) {
+        ReverbLineLayout* ap = &L->plate_diffuser[i];
+        Uint16 samples = msToSamples(p->diffuser_ms[i]);
+
+        if (samples < 2) samples = 2;
+
+        ap->delay_samples = samples;
+        ap->gain_Q15      = float_to_q15(p->input_diffusion[i / 2]);
+        placeFast(ap, &fastUsed, ext, &numExt);
+    }
+
+    for (h = 0; h < 2; h++) {
+        for (i = 0; i < REVERB_PLATE_TANK_LINES; i++) {
+            ReverbLineLayout* line = &L->plate_tank[h][i];
+            Uint16 samples = msToSamples(p->tank_ms[h][i]);
+
+            if (i == REVERB_PLATE_MOD) {
+                if (samples <= depth) {
+                    fprintf(stderr, "reverb_presets: %s: excursão maior que o all-pass modulado\n",
+                            name);
+                    plan->fits = 0;
+                }
+                samples += depth + 1;   // Leitura até delay + depth, interpolada
+            }
+
+            line->delay_samples = samples;
+            line->gain_Q15 = float_to_q15(i == REVERB_PLATE_MOD ? p->decay_diffusion[0] :
+                                          i == REVERB_PLATE_AP  ? p->decay_diffusion[1] :
+                                                                  p->decay);
+            ext[numExt++] = line;
+        }
+    }
+
+    // Um tap mais perto do fim da linha que uma janela leria, na cauda,
+    // amostras que o trecho atual já reescreveu
+    for (h = 0; h < 2; h++) {
+        for (i = 0; i < REVERB_PLATE_TAPS; i++) {
+            const ReverbLineLayout* line =
+                &L->plate_tank[REVERB_PLATE_TAP_HALF(h, i)][REVERB_PLATE_TAP_LINE(i)];
+            Uint16 samples = msToSamples(p->tap_ms[h][i]);
+
+            if (samples < 1 || samples + REVERB_WINDOW_LEN > line->delay_samples) {
+                fprintf(stderr, "reverb_presets: %s: tap %u da saída %u fora da linha\n",
+                        name, i, h);
+                plan->fits = 0;
+            }
+            L->plate_tap[h][i] = samples;
+        }
+    }
+
+    placeExt(plan, ext, numExt, fastUsed);
+}
+
+static size_t emitLine(char* out, size_t cap, const ReverbLineLayout* l, const char* sep)
+{
+    return (size_t)snprintf(out, cap, "{ %5u, %6d, %u, %u, %5u }%s",
+                            l->delay_samples, l->gain_Q15, l->ext, l->bank,
+                            l->offset, sep);
+}
+
+static void buildHeader(char* out, size_t cap, const PresetPlan* plans)
+{
+    size_t n = 0;
+    Uint16 p, ch, i;
+
+#define EMIT(...)  do { if (n < cap) n += (size_t)snprintf(out + n, cap - n, __VA_ARGS__); } while (0)
+
+    EMIT("/* reverb_presets.h - GERADO por Host/tools/reverb_presets: não editar.\n"
+         " * Fonte: reverb_preset_cfg.h; regravar com\n"
+         " *   cmake --build build --target reverb_presets_update\n"
+         " * Linha: { atraso, ganho Q15, ext (CE0), banco, offset } */\n"
+         "\n"
+         "#ifndef REVERB_PRESETS_H_\n"
+         "#define REVERB_PRESETS_H_\n"
+         "\n"
+         "#include \"reverb.h\"\n"
+         "\n");
+
+    for (p = 0; p < REVERB_PRESET_COUNT; p++) {
+        const char* name = s_presetNames[p];
+
+        EMIT("#define REVERB_%s_EXT_BANKS   %u\n", name, plans[p].extBanks);
+        EMIT("#define REVERB_%s_FAST_WORDS  %u\n", name, plans[p].layout.fastWords);
+        EMIT("#if REVERB_%s_EXT_BANKS > REVERB_MEM_BANKS || "
+             "REVERB_%s_FAST_WORDS > REVERB_FAST_MEM_SIZE\n", name, name);
+        EMIT("#error \"Preset %s não cabe em REVERB_MEM_SIZE/REVERB_FAST_MEM_SIZE\"\n", name);
+        EMIT("#endif\n\n");
+    }
+
+    EMIT("static const ReverbPresetLayout REVERB_PRESETS[REVERB_PRESET_COUNT] = {\n");
+    for (p = 0; p < REVERB_PRESET_COUNT; p++) {
+        const ReverbPresetLayout* L = &plans[p].layout;
+
+        EMIT("    // %s\n    {\n        %u,              // engine\n        {\n",
+             s_presetNames[p], L->engine);
+        for (ch = 0; ch < 2; ch++) {
+            EMIT("            { ");
+            for (i = 0; i < REVERB_NUM_COMBS; i++) {
+                if (n < cap) n += emitLine(out + n, cap - n, &L->comb[ch][i],
+                                           i + 1 < REVERB_NUM_COMBS ? ",\n              " : "");
+            }
+            EMIT(" }%s\n", ch == 0 ? "," : "");
+        }
+        EMIT("        },\n        {\n");
+        for (ch = 0; ch < 2; ch++) {
+            EMIT("            { ");
+            for (i = 0; i < REVERB_NUM_ALLPASSES; i++) {
+                if (n < cap) n += emitLine(out + n, cap - n, &L->allpass[ch][i],
+                                           i + 1 < REVERB_NUM_ALLPASSES ? ",\n              " : "");
+            }
+            EMIT(" }%s\n", ch == 0 ? "," : "");
+        }
+        EMIT("        },\n        { ");
+        for (i = 0; i < REVERB_FDN_LINES; i++) {
+            if (n < cap) n += emitLine(out + n, cap - n, &L->fdn[i],
+                                       i + 1 < REVERB_FDN_LINES ? ",\n          " : "");
+        }
+        EMIT(" },\n        { ");
+        for (i = 0; i < REVERB_FDN_LINES; i++) {
+            EMIT("%u%s", L->fdn_damp_shift[i], i + 1 < REVERB_FDN_LINES ? ", " : "");
+        }
+        EMIT(" },    // fdn_damp_shift\n        { ");
+        for (i = 0; i < REVERB_PLATE_DIFFUSERS; i++) {
+            if (n < cap) n += emitLine(out + n, cap - n, &L->plate_diffuser[i],
+                                       i + 1 < REVERB_PLATE_DIFFUSERS ? ",\n          " : "");
+        }
+        EMIT(" },\n        {\n");
+        for (ch = 0; ch < 2; ch++) {
+            EMIT("            { ");
+            for (i = 0; i < REVERB_PLATE_TANK_LINES; i++) {
+                if (n < cap) n += emitLine(out + n, cap - n, &L->plate_tank[ch][i],
+                                           i + 1 < REVERB_PLATE_TANK_LINES ? ",\n              " : "");
+            }
+            EMIT(" }%s\n", ch == 0 ? "," : "");
+        }
+        EMIT("        },\n        {\n");
+        for (ch = 0; ch < 2; ch++) {
+            EMIT("            { ");
+            for (i = 0; i < REVERB_PLATE_TAPS; i++) {
+                EMIT("%u%s", L->plate_tap[ch][i], i + 1 < REVERB_PLATE_TAPS ? ", " : "");
+            }
+            EMIT(" }%s\n", ch == 0 ? "," : "");
+        }
+        EMIT("        },              // plate_tap\n");
+        EMIT("        %u, %u, %luUL,      // plate: excursão, damping, passo do LFO\n",
+             L->plate_mod_depth, L->plate_damp_shift, (unsigned long)L->plate_mod_inc);
+        EMIT("        %d, %d,     // wet, dry (Q15)\n", L->wet_gain_Q15, L->dry_gain_Q15);
+        EMIT("        %u, %u,           // comb_damp_shift, bancos da CE0\n",
+             L->comb_damp_shift, L->extBanks);
+        EMIT("        %luUL, %u      // palavras na CE0, na DARAM\n",
+             (unsigned long)L->extWords, L->fastWords);
+        EMIT("    }%s\n", p + 1 < REVERB_PRESET_COUNT ? "," : "");
+    }
+    EMIT("};\n\n#endif /* REVERB_PRESETS_H_ */\n");
+
+#undef EMIT
+}
+
+static int writeText(const char* path, const char* text)
+{
+    FILE* f = fopen(path, "w");
+
+    if (!f) return -1;
+    fputs(text, f);
+    return fclose(f);
+}
+
+static int sameAsFile(const char* path, const char* text)
+{
+    static char buf[HEADER_TEXT_MAX];
+    size_t len;
+    FILE* f = fopen(path, "r");
+
+    if (!f) return 0;
+    len = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[len] = '\0';
+    return strcmp(buf, text) == 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "uso: reverb_presets [--out reverb_presets.h] [--check reverb_presets.h]\n");
+}
+
+int main(int argc, char** argv)
+{
+    static char text[HEADER_TEXT_MAX];
+    PresetPlan plans[REVERB_PRESET_COUNT];
+    const char* outPath = NULL;
+    const char* checkPath = NULL;
+    int allFit = 1;
+    Uint16 p;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (!v) { usage(); return 2; }
+
+        if      (strcmp(a, "--out") == 0)   outPath = v;
+        else if (strcmp(a, "--check") == 0) checkPath = v;
+        else { usage(); return 2; }
+        i++;
+    }
+
+    printf("%-8s %10s %6s %12s\n", "preset", "CE0", "bancos", "DARAM");
+    for (p = 0; p < REVERB_PRESET_COUNT; p++) {
+        if (p < REVERB_PRESET_FDN_FIRST) {
+            planPreset(&REVERB_PRESET_CFG[p], &plans[p]);
+        } else if (p < REVERB_PRESET_PLATE_FIRST) {
+            planFdnPreset(&REVERB_FDN_CFG[p - REVERB_PRESET_FDN_FIRST], &plans[p]);
+        } else {
+            planPlatePreset(&REVERB_PLATE_CFG[p - REVERB_PRESET_PLATE_FIRST], &plans[p],
+                            s_presetNames[p]);
+        }
+        printf("%-8s %10lu %6u %12u%s\n", s_presetNames[p],
+               (unsigned long)plans[p].layout.extWords, plans[p].extBanks,
+               plans[p].layout.fastWords, plans[p].fits ? "" : "  NÃO CABE");
+        if (!plans[p].fits) allFit = 0;
+    }
+
+    printf("\ntroca de preset (%u bancos):\n", REVERB_MEM_BANKS);
+    for (p = 0; p < REVERB_PRESET_COUNT; p++) {
+        Uint16 q;
+
+        for (q = 0; q < REVERB_PRESET_COUNT; q++) {
+            Uint16 banks = plans[p].extBanks + plans[q].extBanks;
+
+            if (q == p) continue;
+            printf("  %-8s -> %-8s %2u bancos  %s\n", s_presetNames[p], s_presetNames[q],
+                   banks, banks <= REVERB_MEM_BANKS ? "com cauda" : "reinício");
+        }
+    }
+
+    buildHeader(text, sizeof(text), plans);
+
+    if (outPath && writeText(outPath, text) != 0) {
+        fprintf(stderr, "reverb_presets: não foi possível gravar %s\n", outPath);
+        return 2;
+    }
+    if (checkPath && !sameAsFile(checkPath, text)) {
+        fprintf(stderr, "reverb_presets: %s desatualizado; rode o alvo reverb_presets_update\n",
+                checkPath);
+        return 1;
+    }
+    if (!allFit) {
+        fprintf(stderr, "reverb_presets: há preset que não cabe na memória do reverb\n");
+        return 1;
+    }
+    return 0;
+}